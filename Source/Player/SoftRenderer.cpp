@@ -10,7 +10,7 @@ void SoftRenderer::OnTick()
 {
 	if (!_AllInitialized)
 	{
-		// ս ī ʱȭ.
+		// 퍼포먼스 카운터 초기화.
 		if (!_PerformanceCheckInitialized)
 		{
 			if (_PerformanceInitFunc && _PerformanceMeasureFunc)
@@ -25,13 +25,13 @@ void SoftRenderer::OnTick()
 			}
 		}
 
-		// ũ ũ Ȯ
+		// 스크린 크기 확인
 		if (_ScreenSize.HasZero())
 		{
 			return;
 		}
 
-		// Ʈ  ʱȭ.
+		// 소프트 렌더러 초기화.
 		if (!_RendererInitialized)
 		{
 			_RendererInitialized = GetRenderer().Init(_ScreenSize);
@@ -42,11 +42,22 @@ void SoftRenderer::OnTick()
 			}
 		}
 
-		//   ʱȭ
+		// 작업 스레드 생성
+		if (!_JobSystem.IsInitialized())
+		{
+			if (!_JobSystem.Init())
+			{
+				assert(false);
+				return;
+			}
+		}
+
+		// 게임 엔진 초기화
 		_GameEngineInitialized = GetGameEngine().IsInitialized();
 		if (!_GameEngineInitialized)
 		{
 			GetGameEngine().OnScreenResize(_ScreenSize);
+			GetGameEngine().SetJobSystem(&_JobSystem);
 			InputManager& input = GetGameEngine().GetInputManager();
 			if (!input.IsInputReady())
 			{
@@ -64,6 +75,10 @@ void SoftRenderer::OnTick()
 			{
 				LoadScene2D();
 			}
+			else if (_LoadScene3DFunc)
+			{
+				_LoadScene3DFunc(Get3DGameEngine());
+			}
 			else
 			{
 				LoadScene3D();
@@ -84,7 +99,7 @@ void SoftRenderer::OnTick()
 		{
 			PreUpdate();
 
-			//   ü Լ  
+			// 게임 엔진 교체로 함수 리셋 진행
 			if (!_AllInitialized)
 			{
 				GetSystemInput().UpdateSystemInput();
@@ -94,12 +109,26 @@ void SoftRenderer::OnTick()
 			if (_GameEngineType == GameEngineType::DD)
 			{
 				Update2D(_FrameTime / 1000.f);
+
+				// 게임 로직으로 움직인 물체를 씬 격자에 반영한 후 렌더링
+				Get2DGameEngine().UpdateSceneGrid();
 				Render2D();
 			}
 			else
 			{
-				Update3D(_FrameTime / 1000.f);
-				LateUpdate3D(_FrameTime / 1000.f);
+				if (_Update3DFunc)
+				{
+					_Update3DFunc(Get3DGameEngine(), _FrameTime / 1000.f);
+				}
+				else
+				{
+					Update3D(_FrameTime / 1000.f);
+					LateUpdate3D(_FrameTime / 1000.f);
+				}
+
+				// 게임 로직으로 움직인 물체의 월드 트랜스폼을 계산하고 씬 트리에 반영한 후 렌더링
+				Get3DGameEngine().UpdateWorldTransforms();
+				Get3DGameEngine().UpdateSceneTree();
 				Render3D();
 			}
 
@@ -112,7 +141,7 @@ void SoftRenderer::OnResize(const ScreenPoint& InNewScreenSize)
 {
 	_ScreenSize = InNewScreenSize;
 
-	// ũⰡ Ǹ   ʱȭ
+	// 크기가 변경되면 렌더러와 엔진 초기화
 	if (_RendererInitialized)
 	{
 		GetRenderer().Init(InNewScreenSize);
@@ -127,6 +156,7 @@ void SoftRenderer::OnResize(const ScreenPoint& InNewScreenSize)
 void SoftRenderer::OnShutdown()
 {
 	GetRenderer().Shutdown();
+	_JobSystem.Shutdown();
 }
 
 void SoftRenderer::SetDefaultGameEngine(GameEngineType InGameEngineType)
@@ -136,17 +166,17 @@ void SoftRenderer::SetDefaultGameEngine(GameEngineType InGameEngineType)
 
 void SoftRenderer::PreUpdate()
 {
-	//   .
+	// 성능 측정 시작.
 	_FrameTimeStamp = _PerformanceMeasureFunc();
 	if (_FrameCount == 0)
 	{
 		_StartTimeStamp = _FrameTimeStamp;
 	}
 
-	//  .
+	// 배경 지우기.
 	GetRenderer().Clear(_BackgroundColor);
 
-	//  ðȭ
+	// 버퍼 시각화
 	const SystemInputManager& sinput = GetSystemInput();
 
 	if (sinput.IsReleased(SystemInputButton::F1)) { _CurrentDrawMode = DrawMode::Normal; }
@@ -161,14 +191,17 @@ void SoftRenderer::PreUpdate()
 
 void SoftRenderer::PostUpdate()
 {
-	//  .
+	// 렌더링 마무리.
 	GetRenderer().EndFrame();
 
-	// Է  Ʈ
+	// 프레임 동안 사용한 임시 메모리를 모두 비운다. 이 시점에는 작업 스레드에서 실행 중인 작업이 없다.
+	FrameArena::ResetAll();
+
+	// 입력 상태 업데이트
 	GetGameEngine().GetInputManager().UpdateInput();
 	GetSystemInput().UpdateSystemInput();
 
-	//   .
+	// 성능 측정 마무리.
 	_FrameCount++;
 	INT64 currentTimeStamp = _PerformanceMeasureFunc();
 	INT64 frameCycles = currentTimeStamp - _FrameTimeStamp;
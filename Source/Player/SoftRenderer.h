@@ -43,61 +43,70 @@ FORCEINLINE bool operator&(FillMode InLhs, FillMode InRhs)
 class SoftRenderer
 {
 public:
-	// 
+	// 생성자
 	SoftRenderer(GameEngineType InGameEngineType, RendererInterface* InRSI);
 
-	//  ̺Ʈ ó
+	// 윈도우 이벤트 처리
 	void OnTick();
 	void OnResize(const ScreenPoint& InNewScreenSize);
 	void OnShutdown();
 
-	// α׷ ⺻ 
+	// 프로그램 기본 정보
 	SystemInputManager& GetSystemInput() { return _SystemInputManager; }
 	const ScreenPoint& GetScreenSize() { return _ScreenSize; }
 	float GetFrameFPS() const { return _FrameFPS; }
 	FORCEINLINE float GetElapsedTime() const { return _ElapsedTime; }
 
-	//  
+	// 성능 측정
 	std::function<float()> _PerformanceInitFunc;
 	std::function<INT64()> _PerformanceMeasureFunc;
 	std::function<void(InputManager&)> _InputBindingFunc;
 
-	//   ۷ 
+	// 3D 씬 교체. 설정하면 기본 씬의 로딩과 게임 로직 대신 호출한다.
+	std::function<void(DDD::GameEngine&)> _LoadScene3DFunc;
+	std::function<void(DDD::GameEngine&, float)> _Update3DFunc;
+
+	// 게임 엔진 레퍼런스 
 	FORCEINLINE EngineInterface& GetGameEngine() { return (_GameEngineType == GameEngineType::DD) ? static_cast<EngineInterface&>(_GameEngine2) : static_cast<EngineInterface&>(_GameEngine3); }
 	FORCEINLINE DD::GameEngine& Get2DGameEngine() { return _GameEngine2; }
 	FORCEINLINE DDD::GameEngine& Get3DGameEngine() { return _GameEngine3; }
 
+	// 작업 분배기
+	FORCEINLINE JobSystem& GetJobSystem() { return _JobSystem; }
+
 private:
-	//   
+	// 게임 엔진 설정
 	void SetDefaultGameEngine(GameEngineType InGameEngineType);
 
-	// ⺻  Լ
+	// 기본 루프 함수
 	void PreUpdate();
 	void PostUpdate();
 
-	//  ۷
+	// 렌더러 레퍼런스
 	FORCEINLINE RendererInterface& GetRenderer() { return *_RSIPtr.get(); }
 	FORCEINLINE void SetBackgroundColor(const LinearColor& InLinearColor) { _BackgroundColor = InLinearColor; }
 	FORCEINLINE void SetWireframeColor(const LinearColor& InLinearColor) { _WireframeColor = InLinearColor; }
 
-	// 2D ׷Ƚ 
+	// 2D 그래픽스 구현
 	void LoadScene2D();
 	void Update2D(float InDeltaSeconds);
 	void Render2D();
 	void DrawGizmo2D();
 	void DrawMesh2D(const class DD::Mesh& InMesh, const Matrix3x3& InMatrix, const LinearColor& InColor);
-	void DrawTriangle2D(std::vector<DD::Vertex2D>& InVertices, const LinearColor& InColor, FillMode InFillMode);
+	void DrawMeshInstanced2D(const class DD::Mesh& InMesh, const FrameVector<Matrix3x3>& InMatrices, const FrameVector<LinearColor>& InColors);
+	void DrawTriangle2D(FrameVector<DD::Vertex2D>& InVertices, const LinearColor& InColor, FillMode InFillMode);
 
 	int _Grid2DUnit = 10;
 
-	// 3D ׷Ƚ 
+	// 3D 그래픽스 구현
 	void LoadScene3D();
 	void Update3D(float InDeltaSeconds);
 	void LateUpdate3D(float InDeltaSeconds);
 	void Render3D();
 	void DrawGizmo3D();
-	void DrawMesh3D(const class DDD::Mesh& InMesh, const Matrix4x4& InMatrix, const LinearColor& InColor);
-	void DrawTriangle3D(std::vector<DDD::Vertex3D>& InVertices, const LinearColor& InColor, FillMode InFillMode, const size_t& InTexureKey);
+	void DrawMesh3D(const class DDD::Mesh& InMesh, const Matrix4x4& InMatrix, const LinearColor& InColor, size_t InLODIndex = 0);
+	void DrawMeshInstanced3D(const class DDD::Mesh& InMesh, const FrameVector<Matrix4x4>& InMatrices, const FrameVector<LinearColor>& InColors, size_t InLODIndex = 0);
+	void DrawTriangle3D(FrameVector<DDD::Vertex3D>& InVertices, const LinearColor& InColor, FillMode InFillMode, const size_t& InTexureKey);
 
 	bool IsDepthBufferDrawing() const { return _CurrentDrawMode == DrawMode::DepthBuffer; }
 	bool IsWireframeDrawing() const { return _CurrentDrawMode == DrawMode::Wireframe; }
@@ -109,26 +118,26 @@ private:
 	DrawMode _CurrentDrawMode = DrawMode::Normal;
 
 private:
-	// ʱȭ  
+	// 초기화 점검 변수
 	bool _PerformanceCheckInitialized = false;
 	bool _RendererInitialized = false;
 	bool _GameEngineInitialized = false;
 	bool _TickEnabled = false;
 	bool _AllInitialized = false;
 
-	// ȭ ũ
+	// 화면 크기
 	ScreenPoint _ScreenSize;
 
-	//  
+	// 배경 색상
 	LinearColor _BackgroundColor = LinearColor::WhiteSmoke;
 
-	// ̾ 
+	// 와이어프레임 색상
 	LinearColor _WireframeColor = LinearColor::DimGray;
 
-	//  ׸ 
+	// 본을 그릴 색상
 	LinearColor _BoneWireframeColor = LinearColor::Red;
 
-	//  
+	// 성능 측정
 	long long _StartTimeStamp = 0;
 	long long _FrameTimeStamp = 0;
 	long _FrameCount = 0;
@@ -138,14 +147,17 @@ private:
 	float _AverageFPS = 0.f;
 	float _FrameFPS = 0.f;
 
-	//  ̽
+	// 렌더러 인터페이스
 	std::unique_ptr<RendererInterface> _RSIPtr;
 	GameEngineType _GameEngineType = GameEngineType::DD;
 
-	//  
+	// 작업 분배기. 게임 엔진과 렌더링 로직이 함께 사용한다.
+	JobSystem _JobSystem;
+
+	// 게임 엔진
 	DD::GameEngine _GameEngine2;
 	DDD::GameEngine _GameEngine3;
 
-	//  α׷ Է
+	// 응용 프로그램 입력
 	SystemInputManager _SystemInputManager;
 };
@@ -4,24 +4,24 @@
 #include <random>
 using namespace CK::DD;
 
-// ڸ ׸ Լ
+// 격자를 그리는 함수
 void SoftRenderer::DrawGizmo2D()
 {
     auto& r = GetRenderer();
     const auto& g = Get2DGameEngine();
 
-    // ׸ 
+    // 그리드 색상
     LinearColor gridColor(LinearColor(0.8f, 0.8f, 0.8f, 0.3f));
 
-    //   
+    // 뷰의 영역 계산
     Vector2 viewPos = g.GetMainCamera().GetTransform().GetPosition();
     Vector2 extent = Vector2(_ScreenSize.X * 0.5f, _ScreenSize.Y * 0.5f);
 
-    //  ϴܿ  ׸
+    // 좌측 하단에서부터 격자 그리기
     int xGridCount = _ScreenSize.X / _Grid2DUnit;
     int yGridCount = _ScreenSize.Y / _Grid2DUnit;
 
-    // ׸尡 ۵Ǵ ϴ ǥ  
+    // 그리드가 시작되는 좌하단 좌표 값 계산
     Vector2 minPos = viewPos - extent;
     Vector2 minGridPos = Vector2(ceilf(minPos.X / (float)_Grid2DUnit), ceilf(minPos.Y / (float)_Grid2DUnit)) * (float)_Grid2DUnit;
     ScreenPoint gridBottomLeft = ScreenPoint::ToScreenCoordinate(_ScreenSize, minGridPos - viewPos);
@@ -41,31 +41,41 @@ void SoftRenderer::DrawGizmo2D()
     r.DrawFullVerticalLine(worldOrigin.X, LinearColor::Green);
 }
 
-//  Ʈ 
-static const std::string PlayerGo("Player");
+// 게임 오브젝트 목록
+static const Name PlayerGo(L"Player");
 
-//   ε ϴ Լ
+// 최초 씬 로딩을 담당하는 함수
 void SoftRenderer::LoadScene2D()
 {
-    //   ε ϴ   ֿ ۷
+    // 최초 씬 로딩에서 사용하는 모듈 내 주요 레퍼런스
     auto& g = Get2DGameEngine();
 
-    // ÷̾  
+    // 플레이어의 생성과 설정
     constexpr float playerScale = 30.f;
     GameObject& goPlayer = g.CreateNewGameObject(PlayerGo);
     goPlayer.SetMesh(GameEngine::QuadMesh);
     goPlayer.GetTransform().SetScale(Vector2::One * playerScale);
     goPlayer.SetColor(LinearColor::Red);
 
-    // 100   Ʈ  
-    char name[64];
+    // 100개의 배경 게임 오브젝트를 한 번에 생성
+    constexpr int backgroundObjectCount = 100;
+    wchar_t name[64];
+    std::vector<Name> names;
+    names.reserve(backgroundObjectCount);
+    for (int i = 0; i < backgroundObjectCount; ++i)
+    {
+        std::swprintf(name, sizeof(name) / sizeof(wchar_t), L"GameObject%d", i);
+        names.emplace_back(name);
+    }
+    const std::vector<SlotHandle> handles = g.CreateNewGameObjects(names);
+
+    // 배경 게임 오브젝트의 설정
     constexpr float squareScale = 20.f;
     std::mt19937 generator(0);
     std::uniform_real_distribution<float> dist(-1000.f, 1000.f);
-    for (int i = 0; i < 100; ++i)
+    for (const SlotHandle& handle : handles)
     {
-        std::snprintf(name, sizeof(name), "GameObject%d", i);
-        GameObject& newGo = g.CreateNewGameObject(name);
+        GameObject& newGo = g.GetGameObject(handle);
         newGo.GetTransform().SetPosition(Vector2(dist(generator), dist(generator)));
         newGo.GetTransform().SetScale(Vector2::One * squareScale);
         newGo.SetMesh(GameEngine::QuadMesh);
@@ -73,14 +83,14 @@ void SoftRenderer::LoadScene2D()
     }
 }
 
-//   ϴ Լ
+// 게임 로직을 담당하는 함수
 void SoftRenderer::Update2D(float InDeltaSeconds)
 {
-    //   ϴ   ֿ ۷
+    // 게임 로직에서 사용하는 모듈 내 주요 레퍼런스
     auto& g = Get2DGameEngine();
     const InputManager& input = g.GetInputManager();
 
-    //    
+    // 게임 로직의 로컬 변수
     static float moveSpeed = 200.f;
     static float rotateSpeed = 180.f;
     static float scaleMin = 15.f;
@@ -89,17 +99,17 @@ void SoftRenderer::Update2D(float InDeltaSeconds)
     static float minDistance = 1.f;
     static float lerpSpeed = 2.f;
 
-    // ÷̾  ֿ ۷
+    // 플레이어에 대한 주요 레퍼런스
     GameObject& goPlayer = g.GetGameObject(PlayerGo);
     TransformComponent& transform = goPlayer.GetTransform();
 
-    // Է¿  ÷̾ ġ ũ 
+    // 입력에 따른 플레이어 위치와 크기의 변경
     transform.AddPosition(Vector2(input.GetAxis(InputAxis::XAxis), input.GetAxis(InputAxis::YAxis)).GetNormalize() * moveSpeed * InDeltaSeconds);
     float newScale = Math::Clamp(transform.GetScale().X + scaleSpeed * input.GetAxis(InputAxis::ZAxis) * InDeltaSeconds, scaleMin, scaleMax);
     transform.SetScale(Vector2::One * newScale);
     transform.AddRotation(input.GetAxis(InputAxis::WAxis) * rotateSpeed * InDeltaSeconds);
 
-    // ÷̾ ٴϴ ī޶ Ʈ
+    // 플레이어를 따라다니는 카메라의 트랜스폼
     TransformComponent& cameraTransform = g.GetMainCamera().GetTransform();
     Vector2 playerPos = transform.GetPosition();
     Vector2 cameraPos = cameraTransform.GetPosition();
@@ -115,63 +125,104 @@ void SoftRenderer::Update2D(float InDeltaSeconds)
     }
 }
 
-//   ϴ Լ
+// 렌더링 로직을 담당하는 함수
 void SoftRenderer::Render2D()
 {
-    //   ϴ   ֿ ۷
+    // 렌더링 로직에서 사용하는 모듈 내 주요 레퍼런스
     auto& r = GetRenderer();
     const auto& g = Get2DGameEngine();
     const auto& texture = g.GetTexture(GameEngine::BaseTexture);
 
-    // 濡  ׸
+    // 배경에 격자 그리기
     DrawGizmo2D();
 
-    //    
-    size_t totalObjectCount = g.GetScene().size();
+    // 렌더링 로직의 로컬 변수
+    size_t totalObjectCount = g.GetScene().GetSize();
     Matrix3x3 viewMatrix = g.GetMainCamera().GetViewMatrix();
 
-    //  ϴ   Ʈ ȸ
-    for (auto it = g.SceneBegin(); it != g.SceneEnd(); ++it)
-    {
-        //  Ʈ ۷ 
-        const GameObject& gameObject = *(*it);
-        if (!gameObject.HasMesh() || !gameObject.IsVisible())
+    // 씬 격자에서 화면 영역과 겹치는 게임 오브젝트만 골라내기. 격자에는 보이는 상태의 메시를 가진 오브젝트만 등록되어 있다.
+    FrameVector<const GameObject*> visibleObjects;
+    g.GetSceneGrid().Query(g.GetMainCamera().GetViewRectangle(), [&visibleObjects](void* InUserData) {
+        visibleObjects.push_back(static_cast<const GameObject*>(InUserData));
+    });
+
+    // 같은 메시를 사용하는 게임 오브젝트를 모아서 한 번에 그리기 위해 메시 별로 정렬.
+    // 격자를 방문하는 순서와 씬의 저장 순서는 오브젝트가 움직이거나 삭제될 때 바뀐다. 깊이 버퍼가 없으므로 같은 메시 안에서는 슬롯 번호 순으로 그려 겹친 물체의 앞뒤가 매 프레임 같도록 한다.
+    std::sort(visibleObjects.begin(), visibleObjects.end(), [](const GameObject* InLeft, const GameObject* InRight) {
+        if (InLeft->GetMeshKey() != InRight->GetMeshKey())
         {
-            continue;
+            return InLeft->GetMeshKey() < InRight->GetMeshKey();
         }
+        return InLeft->GetHandle().Index < InRight->GetHandle().Index;
+    });
+    FrameVector<Matrix3x3> instanceMatrices;
+    FrameVector<LinearColor> instanceColors;
+    instanceMatrices.reserve(visibleObjects.size());
+    instanceColors.reserve(visibleObjects.size());
+
+    // 화면에 보이는 게임 오브젝트의 순회
+    for (size_t oi = 0; oi < visibleObjects.size(); ++oi)
+    {
+        // 게임 오브젝트의 레퍼런스를 얻기
+        const GameObject& gameObject = *visibleObjects[oi];
 
-        //  ʿ  Ʈ ֿ ۷ 
-        const Mesh& mesh = g.GetMesh(gameObject.GetMeshKey());
+        // 렌더링에 필요한 게임 오브젝트의 주요 레퍼런스를 얻기
         const TransformComponent& transform = gameObject.GetTransform();
-        Matrix3x3 finalMatrix = viewMatrix * transform.GetModelingMatrix();
+        instanceMatrices.push_back(viewMatrix * transform.GetModelingMatrix());
+        instanceColors.push_back(gameObject.GetColor());
 
-        //  Ʈ  
-        DrawMesh2D(mesh, finalMatrix, gameObject.GetColor());
+        // 같은 메시를 사용하는 마지막 게임 오브젝트에서 모아둔 인스턴스의 렌더링 수행
+        const bool isLastInstance = (oi + 1 == visibleObjects.size()) || (visibleObjects[oi + 1]->GetMeshKey() != gameObject.GetMeshKey());
+        if (isLastInstance)
+        {
+            DrawMeshInstanced2D(g.GetMesh(gameObject.GetMeshKey()), instanceMatrices, instanceColors);
+            instanceMatrices.clear();
+            instanceColors.clear();
+        }
 
-        // ÷̾  ȭ鿡 
-        if (gameObject == PlayerGo)
+        // 플레이어의 정보를 화면에 출력
+        if (gameObject.GetName() == PlayerGo)
         {
-            r.PushStatisticText("Player Position : " + transform.GetPosition().ToString());
-            r.PushStatisticText("Player Rotation : " + std::to_string(transform.GetRotation()) + " (deg)");
-            r.PushStatisticText("Player Scale : " + std::to_string(transform.GetScale().X));
+            const Vector2 position = transform.GetPosition();
+            r.PushStatisticTextFormat("Player Position : (%.3f, %.3f)", position.X, position.Y);
+            r.PushStatisticTextFormat("Player Rotation : %f (deg)", transform.GetRotation());
+            r.PushStatisticTextFormat("Player Scale : %f", transform.GetScale().X);
         }
     }
 }
 
-// ޽ø ׸ Լ
+// 메시를 그리는 함수
 void SoftRenderer::DrawMesh2D(const class DD::Mesh& InMesh, const Matrix3x3& InMatrix, const LinearColor& InColor)
 {
-    // ޽  ľϱ   
+    FrameVector<Matrix3x3> matrices(1, InMatrix);
+    FrameVector<LinearColor> colors(1, InColor);
+    DrawMeshInstanced2D(InMesh, matrices, colors);
+}
+
+// 같은 메시를 인스턴스마다 다른 행렬과 색상으로 그리는 함수. 정점 속성의 변환은 메시 단위로 한 번만 수행한다.
+void SoftRenderer::DrawMeshInstanced2D(const class DD::Mesh& InMesh, const FrameVector<Matrix3x3>& InMatrices, const FrameVector<LinearColor>& InColors)
+{
+    assert(InMatrices.size() == InColors.size());
+    const size_t instanceCount = InMatrices.size();
+    if (instanceCount == 0)
+    {
+        return;
+    }
+
+    // 메시의 구조를 파악하기 위한 로컬 변수
     size_t vertexCount = InMesh.GetVertices().size();
     size_t indexCount = InMesh.GetIndices().size();
     size_t triangleCount = indexCount / 3;
 
-    // ޽     ۿ ε ۷ ȯ
-    std::vector<Vertex2D> vertices(vertexCount);
-    std::vector<size_t> indice(InMesh.GetIndices());
+    // 메시 정보를 렌더러가 사용할 정점 버퍼로 변환. 프레임 안에서만 사용하므로 프레임 아레나에 할당한다.
+    // 위치는 정점 셰이더가 바로 사용할 수 있도록 성분별 배열에 따로 기록하고, 모든 변환 작업이 읽기 전용으로 함께 사용한다.
+    FrameVector<Vertex2D> vertices(vertexCount);
+    PositionArray sourcePositions;
+    sourcePositions.Resize(vertexCount);
+    const std::vector<size_t>& indice = InMesh.GetIndices();
     for (size_t vi = 0; vi < vertexCount; ++vi)
     {
-        vertices[vi].Position = InMesh.GetVertices()[vi];
+        sourcePositions.Set(vi, InMesh.GetVertices()[vi]);
         if (InMesh.HasColor())
         {
             vertices[vi].Color = InMesh.GetColors()[vi];
@@ -183,10 +234,7 @@ void SoftRenderer::DrawMesh2D(const class DD::Mesh& InMesh, const Matrix3x3& InM
         }
     }
 
-    //  ȯ 
-    VertexShader2D(vertices, InMatrix);
-
-    // ׸ 
+    // 그리기모드 설정
     FillMode fm = FillMode::None;
     if (InMesh.HasColor())
     {
@@ -197,26 +245,56 @@ void SoftRenderer::DrawMesh2D(const class DD::Mesh& InMesh, const Matrix3x3& InM
         fm |= FillMode::Texture;
     }
 
-    // ޽ø ﰢ ɰ  ׸
-    for (int ti = 0; ti < triangleCount; ++ti)
+    // 메시를 삼각형으로 쪼개서 각각 그리기. 삼각형의 정점 배열은 한 번만 만들어 다시 사용
+    FrameVector<Vertex2D> tvs;
+    tvs.reserve(3);
+
+    // 인스턴스를 묶음 단위로 변환한 후 그린다. 변환은 작업 스레드에서 나누어 처리하고, 그리기는 렌더러를 사용하므로 이 스레드에서 진행한다.
+    // 변환 결과를 담는 버퍼가 인스턴스 수에 비례해 커지지 않도록 묶음의 정점 수를 제한한다.
+    constexpr size_t batchVertexBudget = 65536;
+    constexpr size_t vertexGrainSize = 2048;
+    const size_t instanceBatchSize = Math::Max<size_t>(batchVertexBudget / Math::Max<size_t>(vertexCount, 1), 1);
+    PositionArray positions;
+    positions.Resize(Math::Min(instanceCount, instanceBatchSize) * vertexCount);
+    for (size_t batchBegin = 0; batchBegin < instanceCount; batchBegin += instanceBatchSize)
     {
-        int bi0 = ti * 3, bi1 = ti * 3 + 1, bi2 = ti * 3 + 2;
-        std::vector<Vertex2D> tvs = { vertices[indice[bi0]] , vertices[indice[bi1]] , vertices[indice[bi2]] };
-        DrawTriangle2D(tvs, InColor, fm);
+        const size_t batchCount = Math::Min(instanceBatchSize, instanceCount - batchBegin);
+
+        // 정점 변환 진행. 인스턴스와 정점을 하나의 구간으로 펼쳐서 작업 스레드에 나눈다.
+        _JobSystem.ParallelFor(0, batchCount * vertexCount, vertexGrainSize, [&](size_t InBegin, size_t InEnd)
+        {
+            VertexShaderInstanced2D(sourcePositions, &InMatrices[batchBegin], InBegin, InEnd, positions);
+        });
+
+        for (size_t ii = 0; ii < batchCount; ++ii)
+        {
+            const size_t instanceOffset = ii * vertexCount;
+            for (size_t ti = 0; ti < triangleCount; ++ti)
+            {
+                tvs.resize(3);
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    const size_t vi = indice[ti * 3 + k];
+                    tvs[k] = vertices[vi];
+                    tvs[k].Position = positions.Get(instanceOffset + vi);
+                }
+                DrawTriangle2D(tvs, InColors[batchBegin + ii], fm);
+            }
+        }
     }
 }
 
-// ﰢ ׸ Լ
-void SoftRenderer::DrawTriangle2D(std::vector<DD::Vertex2D>& InVertices, const LinearColor& InColor, FillMode InFillMode)
+// 삼각형을 그리는 함수
+void SoftRenderer::DrawTriangle2D(FrameVector<DD::Vertex2D>& InVertices, const LinearColor& InColor, FillMode InFillMode)
 {
-    //   ϴ   ֿ ۷
+    // 렌더링 로직에서 사용하는 모듈 내 주요 레퍼런스
     auto& r = GetRenderer();
     const GameEngine& g = Get2DGameEngine();
     const Texture& texture = g.GetTexture(GameEngine::BaseTexture);
 
     if (IsWireframeDrawing())
     {
-        // ̾ ޽ø ׸
+        // 와이어프레임으로 메시를 그리기
         LinearColor finalColor = _WireframeColor;
         if (InColor != LinearColor::Error)
         {
@@ -229,22 +307,22 @@ void SoftRenderer::DrawTriangle2D(std::vector<DD::Vertex2D>& InVertices, const L
     }
     else
     {
-        // ﰢ ĥϱ
-        // ﰢ  
+        // 삼각형 칠하기
+        // 삼각형의 영역 설정
         Vector2 minPos(Math::Min3(InVertices[0].Position.X, InVertices[1].Position.X, InVertices[2].Position.X), Math::Min3(InVertices[0].Position.Y, InVertices[1].Position.Y, InVertices[2].Position.Y));
         Vector2 maxPos(Math::Max3(InVertices[0].Position.X, InVertices[1].Position.X, InVertices[2].Position.X), Math::Max3(InVertices[0].Position.Y, InVertices[1].Position.Y, InVertices[2].Position.Y));
 
-        // ߽ǥ   ͷ ȯ
+        // 무게중심좌표를 위해 점을 벡터로 변환
         Vector2 u = InVertices[1].Position - InVertices[0].Position;
         Vector2 v = InVertices[2].Position - InVertices[0].Position;
 
-        //  и  ( uv * uv - uu * vv )
+        // 공통 분모 값 ( uv * uv - uu * vv )
         float udotv = u.Dot(v);
         float vdotv = v.Dot(v);
         float udotu = u.Dot(u);
         float denominator = udotv * udotv - vdotv * udotu;
 
-        // ȭ ﰢ̸ ׸ 
+        // 퇴화 삼각형이면 그리기 생략
         if (denominator == 0.f)
         {
             return;
@@ -255,13 +333,13 @@ void SoftRenderer::DrawTriangle2D(std::vector<DD::Vertex2D>& InVertices, const L
         ScreenPoint lowerLeftPoint = ScreenPoint::ToScreenCoordinate(_ScreenSize, minPos);
         ScreenPoint upperRightPoint = ScreenPoint::ToScreenCoordinate(_ScreenSize, maxPos);
 
-        //   ȭ    Ŭ ó
+        // 두 점이 화면 밖을 벗어나는 경우 클리핑 처리
         lowerLeftPoint.X = Math::Max(0, lowerLeftPoint.X);
         lowerLeftPoint.Y = Math::Min(_ScreenSize.Y, lowerLeftPoint.Y);
         upperRightPoint.X = Math::Min(_ScreenSize.X, upperRightPoint.X);
         upperRightPoint.Y = Math::Max(0, upperRightPoint.Y);
 
-        // ﰢ     ϰ ĥ
+        // 삼각형 영역 내 모든 점을 점검하고 색칠
         for (int x = lowerLeftPoint.X; x <= upperRightPoint.X; ++x)
         {
             for (int y = upperRightPoint.Y; y <= lowerLeftPoint.Y; ++y)
@@ -4,34 +4,34 @@
 #include <random>
 using namespace CK::DDD;
 
-//  ׸
+// 기즈모 그리기
 void SoftRenderer::DrawGizmo3D()
 {
 	auto& r = GetRenderer();
 	const GameEngine& g = Get3DGameEngine();
 
-	//   ׸
-	std::vector<Vertex3D> viewGizmo = {
-		Vertex3D(Vector4(Vector3::Zero)),
-		Vertex3D(Vector4(Vector3::UnitX * _GizmoUnitLength)),
-		Vertex3D(Vector4(Vector3::UnitY * _GizmoUnitLength)),
-		Vertex3D(Vector4(Vector3::UnitZ * _GizmoUnitLength)),
-	};
+	// 뷰 기즈모 그리기
+	PositionArray viewGizmo;
+	viewGizmo.Resize(4);
+	viewGizmo.Set(0, Vector4(Vector3::Zero));
+	viewGizmo.Set(1, Vector4(Vector3::UnitX * _GizmoUnitLength));
+	viewGizmo.Set(2, Vector4(Vector3::UnitY * _GizmoUnitLength));
+	viewGizmo.Set(3, Vector4(Vector3::UnitZ * _GizmoUnitLength));
 
 	Matrix4x4 viewMatRotationOnly = g.GetMainCamera().GetViewMatrixRotationOnly();
 	Matrix4x4 pvMatrix = g.GetMainCamera().GetPerspectiveViewMatrix();
 	VertexShader3D(viewGizmo, viewMatRotationOnly);
 
-	//  ׸
-	Vector2 v0 = viewGizmo[0].Position.ToVector2() + _GizmoPositionOffset;
-	Vector2 v1 = viewGizmo[1].Position.ToVector2() + _GizmoPositionOffset;
-	Vector2 v2 = viewGizmo[2].Position.ToVector2() + _GizmoPositionOffset;
-	Vector2 v3 = viewGizmo[3].Position.ToVector2() + _GizmoPositionOffset;
+	// 축 그리기
+	Vector2 v0 = viewGizmo.Get(0).ToVector2() + _GizmoPositionOffset;
+	Vector2 v1 = viewGizmo.Get(1).ToVector2() + _GizmoPositionOffset;
+	Vector2 v2 = viewGizmo.Get(2).ToVector2() + _GizmoPositionOffset;
+	Vector2 v3 = viewGizmo.Get(3).ToVector2() + _GizmoPositionOffset;
 	r.DrawLine(v0, v1, LinearColor::Red);
 	r.DrawLine(v0, v2, LinearColor::Green);
 	r.DrawLine(v0, v3, LinearColor::Blue);
 
-	// ٴ 
+	// 바닥 기즈모
 	DrawMode prevShowMode = GetDrawMode();
 	SetDrawMode(DrawMode::Wireframe);
 	{
@@ -43,16 +43,16 @@ void SoftRenderer::DrawGizmo3D()
 	SetDrawMode(prevShowMode);
 }
 
-//  Ʈ ̸
-const std::wstring PlayerGo(L"Player");
-const std::wstring CameraTargetGo(L"CameraTarget");
+// 게임 오브젝트 이름
+const Name PlayerGo(L"Player");
+const Name CameraTargetGo(L"CameraTarget");
 
-//  ε
+// 씬 로딩
 void SoftRenderer::LoadScene3D()
 {
 	GameEngine& g = Get3DGameEngine();
 
-	// ÷̾
+	// 플레이어
 	constexpr float playerScale = 25.f;
 
 	GameObject& goPlayer = g.CreateNewGameObject(PlayerGo);
@@ -60,7 +60,7 @@ void SoftRenderer::LoadScene3D()
 	goPlayer.SetColor(LinearColor::White);
 	goPlayer.GetTransform().SetWorldScale(Vector3::One * playerScale);
 
-	// ĳ  ǥ ȭǥ
+	// 캐릭터 본을 표시할 화살표
 
 	Mesh& cm = g.GetMesh(goPlayer.GetMeshKey());
 	for (const auto& b : cm.GetBones())
@@ -74,65 +74,65 @@ void SoftRenderer::LoadScene3D()
 		g.GetBoneObjectPtrs().insert({ goBoneArrow.GetName(), &goBoneArrow });
 	}
 
-	// ī޶ 
+	// 카메라 릭
 	GameObject& goCameraTarget = g.CreateNewGameObject(CameraTargetGo);
 	goCameraTarget.GetTransform().SetWorldPosition(Vector3(0.f, 150.f, 0.f));
 	goCameraTarget.SetParent(goPlayer);
 
-	// ī޶ 
+	// 카메라 설정
 	CameraObject& mainCamera = g.GetMainCamera();
 	mainCamera.GetTransform().SetWorldPosition(Vector3(-500.f, 800.f, 1000.f));
 	mainCamera.SetLookAtRotation(goCameraTarget);
 }
 
-// ǽ  
+// 실습을 위한 변수
 
-//   ϴ Լ
+// 게임 로직을 담당하는 함수
 void SoftRenderer::Update3D(float InDeltaSeconds)
 {
-	//   ϴ   ֿ ۷
+	// 게임 로직에서 사용하는 모듈 내 주요 레퍼런스
 	GameEngine& g = Get3DGameEngine();
 	const InputManager& input = g.GetInputManager();
 
-	//    
+	// 게임 로직의 로컬 변수
 	static float fovSpeed = 100.f;
 	static float minFOV = 15.f;
 	static float maxFOV = 150.f;
 	static float rotateSpeed = 180.f;
 	static float moveSpeed = 500.f;
 
-	// Է¿  ī޶ þ߰ 
+	// 입력에 따른 카메라 시야각의 변경
 	CameraObject& camera = g.GetMainCamera();
 	float deltaFOV = input.GetAxis(InputAxis::WAxis) * fovSpeed * InDeltaSeconds;
 	camera.SetFOV(Math::Clamp(camera.GetFOV() + deltaFOV, minFOV, maxFOV));
 
-	//     Ʈ ۷
+	// 게임 로직에서 사용할 게임 오브젝트 레퍼런스
 	GameObject& goPlayer = g.GetGameObject(PlayerGo);
 	GameObject& goCameraTarget = g.GetGameObject(CameraTargetGo);
 
-	// Է¿  ̵
+	// 입력에 따른 이동
 	goPlayer.GetTransform().AddLocalYawRotation(-input.GetAxis(InputAxis::XAxis) * rotateSpeed * InDeltaSeconds);
 	goPlayer.GetTransform().AddLocalPosition(goPlayer.GetTransform().GetLocalZ() * -input.GetAxis(InputAxis::YAxis) * moveSpeed * InDeltaSeconds);
 
-	// ī޶ 
+	// 카메라의 설정
 	camera.SetLookAtRotation(goCameraTarget);
 }
 
-// ִϸ̼  ϴ Լ
+// 애니메이션 로직을 담당하는 함수
 void SoftRenderer::LateUpdate3D(float InDeltaSeconds)
 {
-	// ִϸ̼  ϴ   ֿ ۷
+	// 애니메이션 로직에서 사용하는 모듈 내 주요 레퍼런스
 	GameEngine& g = Get3DGameEngine();
 
-	// ִϸ̼   
-	// Ŀ:  ǵ ִϸ̼ 
+	// 애니메이션 로직의 로컬 변수
+	// 커브: 사전에 정의된 애니메이션 데이터
 	static AnimationCurve<Quaternion> curve({
-		// {ð, , }
+		// {시간, 기울기, 값}
 		Keyframe<Quaternion>{0.f, 0.f, Quaternion(Rotator(0.f, 30.f, 0.f))},
 		Keyframe<Quaternion>{3.f, 0.f, Quaternion(Rotator(0.f, 30.f, 90.f))},
 		Keyframe<Quaternion>{6.f, 0.f, Quaternion(Rotator(0.f, 30.f, 0.f))},
 	});
-	// : ִϸ̼ Ű ü
+	// 세션: 애니메이션을 실행시키는 객체
 	static AnimationSession<Quaternion> session(curve);
 	static float elapsedTime = 0.f;
 	static float neckLength = 5.f;
@@ -141,111 +141,138 @@ void SoftRenderer::LateUpdate3D(float InDeltaSeconds)
 	static float armLegDegree = 30.f;
 	elapsedTime += InDeltaSeconds;
 
-	// ִϸ̼  Ŀ  
+	// 매 프레임 찾는 본의 이름
+	static const Name neckBoneName(L"首");
+	static const Name leftArmBoneName(L"右肩P");
+	static const Name rightArmBoneName(L"左肩P");
+	static const Name leftLegBoneName(L"右足D");
+	static const Name rightLegBoneName(L"左足D");
+
+	// 애니메이션을 위한 커브 생성 
 	float neckCurrent = Math::FMod(elapsedTime, neckLength) * Math::TwoPI / neckLength;
 	float armLegCurrent = Math::FMod(elapsedTime, armLegLength) * Math::TwoPI / armLegLength;
 
 	float neckCurve = sinf(neckCurrent) * neckDegree;
 	float armLegCurve = sinf(armLegCurrent) * armLegDegree;
 	
-	// ĳ ۷
+	// 캐릭터 레퍼런스
 	GameObject& goPlayer = g.GetGameObject(PlayerGo);
 
-	// ĳ ޽
+	// 캐릭터 메시
 	Mesh& m = g.GetMesh(goPlayer.GetMeshKey());
 
-	//  ȸ
-	Bone& neckBone = m.GetBone(L"");
-	neckBone.GetTransform().SetLocalRotation(Rotator(neckCurve, 0.f, 0.f));
+	// 본의 로컬 트랜스폼은 스켈레톤에 기록하고, 월드 트랜스폼은 렌더링 전에 엔진에서 한 번에 계산
+	TransformHierarchy& skeleton = m.GetSkeleton();
+
+	// 목의 회전
+	const Bone& neckBone = m.GetBone(neckBoneName);
+	skeleton.SetLocalRotation(neckBone.GetNodeIndex(), Rotator(neckCurve, 0.f, 0.f));
 
-	//  ȸ
-	Bone& leftArmBone = m.GetBone(L"̷P");
+	// 팔의 회전
+	const Bone& leftArmBone = m.GetBone(leftArmBoneName);
 	//leftArmBone.GetTransform().SetLocalRotation(Rotator(0.f, 30.f, armLegCurve));
 	Quaternion newRotation = session.Next(InDeltaSeconds);
 	auto& r = GetRenderer();
-	r.PushStatisticText("Rotation : " + newRotation.ToString());
-	r.PushStatisticText("Time : " + std::to_string(session.GetTime()));
-	r.PushStatisticText("Index : " + std::to_string(session.GetIndex()));
-	leftArmBone.GetTransform().SetLocalRotation(newRotation);
+	const Rotator newRotator = newRotation.ToRotator();
+	r.PushStatisticTextFormat("Rotation : (Y : %.1f, R: %.1f, P : %.1f)", newRotator.Yaw, newRotator.Roll, newRotator.Pitch);
+	r.PushStatisticTextFormat("Time : %f", session.GetTime());
+	r.PushStatisticTextFormat("Index : %d", session.GetIndex());
+	skeleton.SetLocalRotation(leftArmBone.GetNodeIndex(), newRotation);
 
-	Bone& rightArmBone = m.GetBone(L"̷P");
-	rightArmBone.GetTransform().SetLocalRotation(Rotator(0.f, -30.f, -armLegCurve));
+	const Bone& rightArmBone = m.GetBone(rightArmBoneName);
+	skeleton.SetLocalRotation(rightArmBone.GetNodeIndex(), Rotator(0.f, -30.f, -armLegCurve));
 
-	// ٸ ȸ
-	Bone& leftLegBone = m.GetBone(L"D");
-	leftLegBone.GetTransform().SetLocalRotation(Rotator(0.f, 0.f, -armLegCurve));
+	// 다리의 회전
+	const Bone& leftLegBone = m.GetBone(leftLegBoneName);
+	skeleton.SetLocalRotation(leftLegBone.GetNodeIndex(), Rotator(0.f, 0.f, -armLegCurve));
 
-	Bone& rightLegBone = m.GetBone(L"D");
-	rightLegBone.GetTransform().SetLocalRotation(Rotator(0.f, 0.f, armLegCurve));
+	const Bone& rightLegBone = m.GetBone(rightLegBoneName);
+	skeleton.SetLocalRotation(rightLegBone.GetNodeIndex(), Rotator(0.f, 0.f, armLegCurve));
 
 }
 
-//   ϴ Լ
+// 렌더링 로직을 담당하는 함수
 void SoftRenderer::Render3D()
 {
-	//   ϴ   ֿ ۷
+	// 렌더링 로직에서 사용하는 모듈 내 주요 레퍼런스
 	const GameEngine& g = Get3DGameEngine();
 	auto& r = GetRenderer();
 	const CameraObject& mainCamera = g.GetMainCamera();
 
-	// 濡  ׸
+	// 배경에 기즈모 그리기
 	DrawGizmo3D();
 
-	//    
+	// 렌더링 로직의 로컬 변수
 	const Matrix4x4 pvMatrix = mainCamera.GetPerspectiveViewMatrix();
 
-	// ü ø ׽Ʈ   
-	size_t totalObjects = g.GetScene().size();
+	// 절두체 컬링 테스트를 위한 통계 변수
+	size_t totalObjects = g.GetScene().GetSize();
 	size_t culledObjects = 0;
 	size_t intersectedObjects = 0;
 	size_t renderedObjects = 0;
 
-	for (auto it = g.SceneBegin(); it != g.SceneEnd(); ++it)
+	// 월드 공간의 절두체는 프레임마다 한 번만 생성
+	const Frustum frustum = mainCamera.GetFrustum();
+
+	// 씬 트리에서 절두체와 겹치는 물체만 골라낸다. 트리에는 보이는 상태의 메시를 가진 오브젝트만 등록되어 있다.
+	const DynamicBoxTree& sceneTree = g.GetSceneTree();
+	FrameVector<std::pair<const GameObject*, BoundCheckResult>> visibleObjects;
+	visibleObjects.reserve(sceneTree.GetProxyCount());
+	sceneTree.Query(frustum, [&visibleObjects](void* InUserData, BoundCheckResult InResult) {
+		visibleObjects.emplace_back(static_cast<const GameObject*>(InUserData), InResult);
+	});
+	culledObjects = sceneTree.GetProxyCount() - visibleObjects.size();
+
+	// 같은 메시와 LOD를 사용하는 물체는 모아서 한 번에 그린다.
+	struct MeshInstance
 	{
-		const GameObject& gameObject = *(*it);
-		if (!gameObject.HasMesh() || !gameObject.IsVisible())
+		std::size_t MeshKey;
+		size_t LODIndex;
+		Matrix4x4 Matrix;
+		LinearColor Color;
+	};
+	FrameVector<MeshInstance> meshInstances;
+	meshInstances.reserve(visibleObjects.size());
+	FrameVector<Matrix4x4> boneMatrices;
+
+	for (const auto& visibleObject : visibleObjects)
+	{
+		// 렌더링에 필요한 게임 오브젝트의 주요 레퍼런스를 얻기
+		const GameObject& gameObject = *visibleObject.first;
+		const Mesh& mesh = g.GetMesh(gameObject.GetMeshKey());
+
+		// 완전히 안쪽에 있는 평면의 마스크. 자식 요소의 컬링에서 해당 평면의 검사를 생략한다.
+		BYTE insideMask = Frustum::AllPlanesMask;
+		if (visibleObject.second == BoundCheckResult::Intersect)
 		{
-			continue;
+			// 경계에 걸친 물체는 회전된 박스로 다시 판정해 월드 박스가 느슨해서 남은 물체를 걸러낸다.
+			insideMask = 0;
+			BYTE planeHint = gameObject.GetFrustumPlaneHint();
+			const OrientedBox worldOrientedBound(mesh.GetBoxBound(), gameObject.GetTransform().GetWorldAffine());
+			BoundCheckResult result = frustum.CheckBound(worldOrientedBound, planeHint, insideMask);
+			gameObject.SetFrustumPlaneHint(planeHint);
+			if (result == BoundCheckResult::Outside)
+			{
+				culledObjects++;
+				continue;
+			}
+
+			// 겹친 게임 오브젝트를 통계에 포함
+			intersectedObjects++;
 		}
 
-		//  ʿ  Ʈ ֿ ۷ 
-		const Mesh& mesh = g.GetMesh(gameObject.GetMeshKey());
 		const TransformComponent& transform = gameObject.GetTransform();
 
-		//   
+		// 최종 행렬 계산
 		Matrix4x4 finalMatrix = pvMatrix * transform.GetWorldMatrix();
 		LinearColor finalColor = gameObject.GetColor();
 
-		//  ȯ ķκ  İ ü 
-		Matrix4x4 finalTransposedMatrix = finalMatrix.Transpose();
-		std::array<Plane, 6> frustumPlanesFromMatrix = {
-			Plane(-(finalTransposedMatrix[3] - finalTransposedMatrix[1])), // up
-			Plane(-(finalTransposedMatrix[3] + finalTransposedMatrix[1])), // bottom
-			Plane(-(finalTransposedMatrix[3] - finalTransposedMatrix[0])), // right
-			Plane(-(finalTransposedMatrix[3] + finalTransposedMatrix[0])), // left 
-			Plane(-(finalTransposedMatrix[3] - finalTransposedMatrix[2])),  // far
-			Plane(-(finalTransposedMatrix[3] + finalTransposedMatrix[2])), // near
-		};
-		Frustum frustumFromMatrix(frustumPlanesFromMatrix);
-
-		// ٿ   ü ø 
-		Box boxBound = mesh.GetBoxBound();
-		auto checkResult = frustumFromMatrix.CheckBound(boxBound);
-		if (checkResult == BoundCheckResult::Outside)
-		{
-			culledObjects++;
-			continue;
-		}
-		else if (checkResult == BoundCheckResult::Intersect)
-		{
-			// ģ  Ʈ 迡 
-			intersectedObjects++;
-		}
-
-		// Ṵ̋ WireFrame   ׸
+		// 스키닝이고 WireFrame인 경우 본을 그리기
 		if (mesh.IsSkinnedMesh() && IsWireframeDrawing())
 		{
 			const Mesh& boneMesh = g.GetMesh(GameEngine::ArrowMesh);
+			const TransformHierarchy& skeleton = mesh.GetSkeleton();
+			BYTE planeHint = gameObject.GetFrustumPlaneHint();
 			for (const auto& b : mesh.GetBones())
 			{
 				if (!b.second.HasParent())
@@ -256,162 +283,255 @@ void SoftRenderer::Render3D()
 				const Bone& parentBone = mesh.GetBone(bone.GetParentName());
 				const Transform& tGameObject = transform.GetWorldTransform();
 
-				// 𵨸   ġ
-				const Transform& t1 = parentBone.GetTransform().GetWorldTransform();
-				const Transform& t2 = bone.GetTransform().GetWorldTransform();
+				// 모델링 공간에서의 본의 위치
+				const Transform t1 = skeleton.GetWorldTransform(parentBone.GetNodeIndex());
+				const Transform t2 = skeleton.GetWorldTransform(bone.GetNodeIndex());
 
-				//     ġ
+				// 게임 월드 공간에서의 본의 위치
 				const Transform& wt1 = t1.LocalToWorld(tGameObject);
 				const Transform& wt2 = t2.LocalToWorld(tGameObject);
 
 				Vector3 boneVector = wt2.GetPosition() - wt1.GetPosition();
 				Transform tboneObject(wt1.GetPosition(), Quaternion(boneVector), Vector3(10.f, 10.f, boneVector.Size()));
-				Matrix4x4 boneMatrix = pvMatrix * tboneObject.GetMatrix();
-				DrawMesh3D(boneMesh, boneMatrix, _BoneWireframeColor);
+				Matrix4x4 boneWorldMatrix = tboneObject.GetMatrix();
+
+				// 게임 오브젝트가 완전히 안쪽에 있는 평면은 건너뛰고, 인접한 본은 같은 평면에서 걸러질 가능성이 높으므로 판정 평면을 이어서 사용
+				BYTE boneInsideMask = insideMask;
+				if (frustum.CheckBound(OrientedBox(boneMesh.GetBoxBound(), tboneObject), planeHint, boneInsideMask) == BoundCheckResult::Outside)
+				{
+					continue;
+				}
+
+				boneMatrices.push_back(pvMatrix * boneWorldMatrix);
 			}
+			gameObject.SetFrustumPlaneHint(planeHint);
 		}
 
-		// ޽ ׸
-		DrawMesh3D(mesh, finalMatrix, gameObject.GetColor());
+		// 화면에 투영된 경계 구의 크기로 LOD를 골라 그릴 목록에 추가
+		const Sphere worldSphereBound(transform.GetWorldAffine().TransformPoint(mesh.GetSphereBound().Center), mesh.GetSphereBound().Radius * transform.GetWorldScale().Max());
+		const size_t lodIndex = mesh.SelectLOD(mainCamera.GetScreenSize(worldSphereBound));
+		meshInstances.push_back({ gameObject.GetMeshKey(), lodIndex, finalMatrix, gameObject.GetColor() });
 
-		// ׸ ü 迡 
+		// 그린 물체를 통계에 포함
 		renderedObjects++;
 
-		if (gameObject == PlayerGo)
+		if (gameObject.GetName() == PlayerGo)
+		{
+			const Vector3 playerPosition = gameObject.GetTransform().GetWorldPosition();
+			r.PushStatisticTextFormat("Player : (%.3f, %.3f, %.3f)", playerPosition.X, playerPosition.Y, playerPosition.Z);
+		}
+	}
+
+	// 본은 모두 같은 화살표 메시이므로 한 번에 그린다.
+	if (!boneMatrices.empty())
+	{
+		FrameVector<LinearColor> boneColors(boneMatrices.size(), _BoneWireframeColor);
+		DrawMeshInstanced3D(g.GetMesh(GameEngine::ArrowMesh), boneMatrices, boneColors);
+	}
+
+	// 메시와 LOD가 같은 물체끼리 정렬한 후 묶음마다 그리기
+	std::sort(meshInstances.begin(), meshInstances.end(), [](const MeshInstance& InLeft, const MeshInstance& InRight) {
+		return (InLeft.MeshKey != InRight.MeshKey) ? (InLeft.MeshKey < InRight.MeshKey) : (InLeft.LODIndex < InRight.LODIndex);
+	});
+	FrameVector<Matrix4x4> instanceMatrices;
+	FrameVector<LinearColor> instanceColors;
+	size_t end = 0;
+	for (size_t begin = 0; begin < meshInstances.size(); begin = end)
+	{
+		const MeshInstance& first = meshInstances[begin];
+		instanceMatrices.clear();
+		instanceColors.clear();
+		for (end = begin; end < meshInstances.size() && meshInstances[end].MeshKey == first.MeshKey && meshInstances[end].LODIndex == first.LODIndex; ++end)
 		{
-			r.PushStatisticText("Player : " + gameObject.GetTransform().GetWorldPosition().ToString());
+			instanceMatrices.push_back(meshInstances[end].Matrix);
+			instanceColors.push_back(meshInstances[end].Color);
 		}
+
+		DrawMeshInstanced3D(g.GetMesh(first.MeshKey), instanceMatrices, instanceColors, first.LODIndex);
 	}
 }
 
-// ޽ø ׸ Լ
-void SoftRenderer::DrawMesh3D(const Mesh& InMesh, const Matrix4x4& InMatrix, const LinearColor& InColor)
+// 메시를 그리는 함수
+void SoftRenderer::DrawMesh3D(const Mesh& InMesh, const Matrix4x4& InMatrix, const LinearColor& InColor, size_t InLODIndex)
+{
+	FrameVector<Matrix4x4> matrices(1, InMatrix);
+	FrameVector<LinearColor> colors(1, InColor);
+	DrawMeshInstanced3D(InMesh, matrices, colors, InLODIndex);
+}
+
+// 같은 메시를 인스턴스마다 다른 행렬과 색상으로 그리는 함수. 스키닝과 정점 속성의 변환은 메시 단위로 한 번만 수행한다.
+void SoftRenderer::DrawMeshInstanced3D(const Mesh& InMesh, const FrameVector<Matrix4x4>& InMatrices, const FrameVector<LinearColor>& InColors, size_t InLODIndex)
 {
-	size_t vertexCount = InMesh.GetVertices().size();
-	size_t indexCount = InMesh.GetIndices().size();
+	assert(InMatrices.size() == InColors.size());
+	const size_t instanceCount = InMatrices.size();
+	if (instanceCount == 0)
+	{
+		return;
+	}
+
+	// LOD는 원본 정점의 일부만 사용하므로 LOD의 정점만 변환한다.
+	const MeshLOD* lodPtr = (InLODIndex > 0) ? &InMesh.GetLOD(InLODIndex) : nullptr;
+	size_t vertexCount = (lodPtr != nullptr) ? lodPtr->Vertices.size() : InMesh.GetVertices().size();
+	const std::vector<size_t>& indice = (lodPtr != nullptr) ? lodPtr->Indices : InMesh.GetIndices();
+	size_t indexCount = indice.size();
 	size_t triangleCount = indexCount / 3;
 
-	//    ۿ ε ۷ ȯ
-	std::vector<Vertex3D> vertices(vertexCount);
-	std::vector<size_t> indice(InMesh.GetIndices());
-	for (size_t vi = 0; vi < vertexCount; ++vi)
+	// 렌더러가 사용할 정점 버퍼로 변환. 프레임 안에서만 사용하므로 프레임 아레나에 할당한다.
+	// 위치는 정점 셰이더가 바로 사용할 수 있도록 성분별 배열에 따로 기록하고, 모든 변환 작업이 읽기 전용으로 함께 사용한다.
+	FrameVector<Vertex3D> vertices(vertexCount);
+	PositionArray sourcePositions;
+	sourcePositions.Resize(vertexCount);
+
+	// 스키닝에 사용할 본의 행렬은 정점마다 계산하지 않고 그리기 전에 한 번만 계산
+	FrameUnorderedMap<Name, Affine3x4> skinMatrices;
+	if (InMesh.IsSkinnedMesh())
 	{
-		vertices[vi].Position = Vector4(InMesh.GetVertices()[vi]);
+		const TransformHierarchy& skeleton = InMesh.GetSkeleton();
+		skinMatrices.reserve(InMesh.GetBones().size());
+		for (const auto& b : InMesh.GetBones())
+		{
+			const Bone& bone = b.second;
+			skinMatrices.emplace(b.first, skeleton.GetWorldAffine(bone.GetNodeIndex()) * bone.GetInverseBindPoseMatrix());
+		}
+	}
 
-		// ġ  Ű  
-		if (InMesh.IsSkinnedMesh())
+	// 정점마다 독립적이므로 구간을 나누어 작업 스레드에서 처리
+	constexpr size_t vertexGrainSize = 2048;
+	_JobSystem.ParallelFor(0, vertexCount, vertexGrainSize, [&](size_t InBegin, size_t InEnd)
+	{
+		for (size_t vi = InBegin; vi < InEnd; ++vi)
 		{
-			Vector4 totalPosition = Vector4::Zero;
-			Weight w = InMesh.GetWeights()[vi];
-			for (size_t wi = 0; wi < InMesh.GetConnectedBones()[vi]; ++wi)
+			const size_t si = (lodPtr != nullptr) ? lodPtr->Vertices[vi] : vi;
+			Vector4 position(InMesh.GetVertices()[si]);
+
+			// 위치에 대해 스키닝 연산 수행
+			if (InMesh.IsSkinnedMesh())
 			{
-				const auto& boneName = w.Bones[wi];
-				if (InMesh.HasBone(boneName))
+				Vector4 totalPosition = Vector4::Zero;
+				const Weight& w = InMesh.GetWeights()[si];
+				for (size_t wi = 0; wi < InMesh.GetConnectedBones()[si]; ++wi)
 				{
-					const Transform& bindPoseTransform = InMesh.GetBindPose(boneName);
-					const Transform& boneTransform = InMesh.GetBone(boneName).GetTransform().GetWorldTransform();
-					Vector4 localPosition = boneTransform.GetMatrix() * bindPoseTransform.Inverse().GetMatrix() * vertices[vi].Position;
+					auto it = skinMatrices.find(w.Bones[wi]);
+					if (it != skinMatrices.end())
+					{
+						Vector4 localPosition(it->second.TransformPoint(position.ToVector3()));
 
-					totalPosition += localPosition * w.Values[wi];
+						totalPosition += localPosition * w.Values[wi];
+					}
 				}
+
+				position = totalPosition;
 			}
 
-			vertices[vi].Position = totalPosition;
+			sourcePositions.Set(vi, position);
+
+			if (InMesh.HasColor())
+			{
+				vertices[vi].Color = InMesh.GetColors()[si];
+			}
+
+			if (InMesh.HasUV())
+			{
+				vertices[vi].UV = InMesh.GetUVs()[si];
+			}
 		}
+	});
 
-		if (InMesh.HasColor())
+	// 동차좌표계에서 클리핑을 위한 설정
+	std::array<PerspectiveTest, 7> testPlanes = { {
+		{ TestFuncW0, EdgeFuncW0 },
+		{ TestFuncNY, EdgeFuncNY },
+		{ TestFuncPY, EdgeFuncPY },
+		{ TestFuncNX, EdgeFuncNX },
+		{ TestFuncPX, EdgeFuncPX },
+		{ TestFuncFar, EdgeFuncFar },
+		{ TestFuncNear, EdgeFuncNear }
+	} };
+
+	// 삼각형마다 사용하는 정점 배열은 메시 단위로 한 번만 만들어 다시 사용
+	FrameVector<Vertex3D> tvs;
+	FrameVector<Vertex3D> sub;
+	tvs.reserve(12);
+	sub.reserve(3);
+
+	// 텍스처가 이상하거나, 와이어프레임 렌더링 시 텍스처 인덱스 사용하지 않음
+	const auto& textureIndices = (lodPtr != nullptr) ? lodPtr->TextureIndices : InMesh.GetTextureIndices();
+	const bool useTextureIndices = !IsWireframeDrawing() && textureIndices.size() > 0;
+
+	// 인스턴스를 묶음 단위로 변환한 후 그린다. 변환은 작업 스레드에서 나누어 처리하고, 그리기는 렌더러를 사용하므로 이 스레드에서 진행한다.
+	// 변환 결과를 담는 버퍼가 인스턴스 수에 비례해 커지지 않도록 묶음의 정점 수를 제한한다. 정점이 많은 메시는 인스턴스 하나씩 처리한다.
+	constexpr size_t batchVertexBudget = 65536;
+	const size_t instanceBatchSize = Math::Max<size_t>(batchVertexBudget / Math::Max<size_t>(vertexCount, 1), 1);
+	PositionArray positions;
+	positions.Resize(Math::Min(instanceCount, instanceBatchSize) * vertexCount);
+	for (size_t batchBegin = 0; batchBegin < instanceCount; batchBegin += instanceBatchSize)
+	{
+		const size_t batchCount = Math::Min(instanceBatchSize, instanceCount - batchBegin);
+
+		// 정점 변환 진행. 인스턴스와 정점을 하나의 구간으로 펼쳐서 나누므로 정점이 많은 인스턴스 하나도 여러 작업이 나누어 처리한다.
+		_JobSystem.ParallelFor(0, batchCount * vertexCount, vertexGrainSize, [&](size_t InBegin, size_t InEnd)
 		{
-			vertices[vi].Color = InMesh.GetColors()[vi];
-		}
+			VertexShaderInstanced3D(sourcePositions, &InMatrices[batchBegin], InBegin, InEnd, positions);
+		});
 
-		if (InMesh.HasUV())
+		for (size_t ii = 0; ii < batchCount; ++ii)
 		{
-			vertices[vi].UV = InMesh.GetUVs()[vi];
-		}
-	}
+			const size_t instanceOffset = ii * vertexCount;
+			const LinearColor& instanceColor = InColors[batchBegin + ii];
 
-	//  ȯ 
-	VertexShader3D(vertices, InMatrix);
-
-	// ﰢ  ׸
-	const auto& textureIndices = InMesh.GetTextureIndices();
-	// ؽó ̻ϰų, ̾   ؽó ε  
-	if (IsWireframeDrawing() || textureIndices.size() == 0) {
-		for (int ti = 0; ti < triangleCount; ++ti) {
-			int bi0 = ti * 3, bi1 = ti * 3 + 1, bi2 = ti * 3 + 2;
-			std::vector<Vertex3D> tvs = { vertices[indice[bi0]] , vertices[indice[bi1]] , vertices[indice[bi2]] };
-
-			// ǥ迡 Ŭ  
-			std::vector<PerspectiveTest> testPlanes = {
-				{ TestFuncW0, EdgeFuncW0 },
-				{ TestFuncNY, EdgeFuncNY },
-				{ TestFuncPY, EdgeFuncPY },
-				{ TestFuncNX, EdgeFuncNX },
-				{ TestFuncPX, EdgeFuncPX },
-				{ TestFuncFar, EdgeFuncFar },
-				{ TestFuncNear, EdgeFuncNear }
-			};
+			// 변환된 위치로 삼각형을 만들어 클리핑 후 그리기
+			auto drawTriangle = [&](size_t InStartIndex, size_t InTextureKey) {
+				tvs.resize(3);
+				for (size_t k = 0; k < 3; ++k)
+				{
+					const size_t vi = indice[InStartIndex + k];
+					tvs[k] = vertices[vi];
+					tvs[k].Position = positions.Get(instanceOffset + vi);
+				}
 
-			// ǥ迡 Ŭ 
-			for (auto& p : testPlanes) {
-				p.ClipTriangles(tvs);
-			}
+				// 동차좌표계에서 클리핑 진행
+				for (auto& p : testPlanes) {
+					p.ClipTriangles(tvs);
+				}
 
-			size_t triangles = tvs.size() / 3;
-			for (size_t ti = 0; ti < triangles; ++ti) {
-				size_t si = ti * 3;
-				std::vector<Vertex3D> sub(tvs.begin() + si, tvs.begin() + si + 3);
-				DrawTriangle3D(sub, InColor, FillMode::Color, 0xFFFFFFFF);
-			}
-		}
-	}
-	
-	else for (const auto& t : textureIndices) {
-		for (size_t ti = t.StartIndex; ti < t.EndIndex; ti += 3) {
-			int bi0 = ti, bi1 = ti + 1, bi2 = ti + 2;
-			std::vector<Vertex3D> tvs = { vertices[indice[bi0]] , vertices[indice[bi1]] , vertices[indice[bi2]] };
-
-			// ǥ迡 Ŭ  
-			std::vector<PerspectiveTest> testPlanes = {
-				{ TestFuncW0, EdgeFuncW0 },
-				{ TestFuncNY, EdgeFuncNY },
-				{ TestFuncPY, EdgeFuncPY },
-				{ TestFuncNX, EdgeFuncNX },
-				{ TestFuncPX, EdgeFuncPX },
-				{ TestFuncFar, EdgeFuncFar },
-				{ TestFuncNear, EdgeFuncNear }
+				size_t triangles = tvs.size() / 3;
+				for (size_t ti = 0; ti < triangles; ++ti) {
+					size_t si = ti * 3;
+					sub.assign(tvs.begin() + si, tvs.begin() + si + 3);
+					DrawTriangle3D(sub, instanceColor, FillMode::Color, InTextureKey);
+				}
 			};
 
-			// ǥ迡 Ŭ 
-			for (auto& p : testPlanes) {
-				p.ClipTriangles(tvs);
+			// 삼각형 별로 그리기
+			if (!useTextureIndices) {
+				for (size_t ti = 0; ti < triangleCount; ++ti) {
+					drawTriangle(ti * 3, 0xFFFFFFFF);
+				}
 			}
-
-			size_t triangles = tvs.size() / 3;
-			for (size_t ti = 0; ti < triangles; ++ti) {
-				size_t si = ti * 3;
-				std::vector<Vertex3D> sub(tvs.begin() + si, tvs.begin() + si + 3);
-				DrawTriangle3D(sub, InColor, FillMode::Color, t.TextureKey);
+			else for (const auto& t : textureIndices) {
+				for (size_t ti = t.StartIndex; ti < t.EndIndex; ti += 3) {
+					drawTriangle(ti, t.TextureKey);
+				}
 			}
 		}
 	}
 }
 
-// ﰢ ׸ Լ
-void SoftRenderer::DrawTriangle3D(std::vector<Vertex3D>& InVertices, const LinearColor& InColor, FillMode InFillMode, const size_t& InTexureKey)
+// 삼각형을 그리는 함수
+void SoftRenderer::DrawTriangle3D(FrameVector<Vertex3D>& InVertices, const LinearColor& InColor, FillMode InFillMode, const size_t& InTexureKey)
 {
 	auto& r = GetRenderer();
 	const GameEngine& g = Get3DGameEngine();
 	const CameraObject& mainCamera = g.GetMainCamera();
 
-	// ī޶   
+	// 카메라의 근평면과 원평면 값
 	float n = mainCamera.GetNearZ();
 	float f = mainCamera.GetFarZ();
 
-	// Ŭ ǥ NDC ǥ 
+	// 클립 좌표를 NDC 좌표로 변경
 	for (auto& v : InVertices)
 	{
-		//   , ణ ش.
+		// 무한 원점인 경우, 약간 보정해준다.
 		if (v.Position.W == 0.f) v.Position.W = SMALL_NUMBER;
 
 		float invW = 1.f / v.Position.W;
@@ -420,7 +540,7 @@ void SoftRenderer::DrawTriangle3D(std::vector<Vertex3D>& InVertices, const Linea
 		v.Position.Z *= invW;
 	}
 
-	// ̽ ø
+	// 백페이스 컬링
 	Vector3 edge1 = (InVertices[1].Position - InVertices[0].Position).ToVector3();
 	Vector3 edge2 = (InVertices[2].Position - InVertices[0].Position).ToVector3();
 	Vector3 faceNormal = -edge1.Cross(edge2);
@@ -430,7 +550,7 @@ void SoftRenderer::DrawTriangle3D(std::vector<Vertex3D>& InVertices, const Linea
 		return;
 	}
 
-	// NDC ǥ ȭ ǥ ø
+	// NDC 좌표를 화면 좌표로 늘리기
 	for (auto& v : InVertices)
 	{
 		v.Position.X *= _ScreenSize.X * 0.5f;
@@ -453,22 +573,22 @@ void SoftRenderer::DrawTriangle3D(std::vector<Vertex3D>& InVertices, const Linea
 	{
 		const Texture& texture = g.GetTexture(InTexureKey);
 
-		// ﰢ ĥϱ
-		// ﰢ  
+		// 삼각형 칠하기
+		// 삼각형의 영역 설정
 		Vector2 minPos(Math::Min3(InVertices[0].Position.X, InVertices[1].Position.X, InVertices[2].Position.X), Math::Min3(InVertices[0].Position.Y, InVertices[1].Position.Y, InVertices[2].Position.Y));
 		Vector2 maxPos(Math::Max3(InVertices[0].Position.X, InVertices[1].Position.X, InVertices[2].Position.X), Math::Max3(InVertices[0].Position.Y, InVertices[1].Position.Y, InVertices[2].Position.Y));
 
-		// ߽ǥ   ͷ ȯ
+		// 무게중심좌표를 위해 점을 벡터로 변환
 		Vector2 u = InVertices[1].Position.ToVector2() - InVertices[0].Position.ToVector2();
 		Vector2 v = InVertices[2].Position.ToVector2() - InVertices[0].Position.ToVector2();
 
-		//  и  ( uu * vv - uv * uv )
+		// 공통 분모 값 ( uu * vv - uv * uv )
 		float udotv = u.Dot(v);
 		float vdotv = v.Dot(v);
 		float udotu = u.Dot(u);
 		float denominator = udotv * udotv - vdotv * udotu;
 
-		// ȭ ﰢ .
+		// 퇴화 삼각형 판정.
 		if (denominator == 0.f)
 		{
 			return;
@@ -479,18 +599,18 @@ void SoftRenderer::DrawTriangle3D(std::vector<Vertex3D>& InVertices, const Linea
 		ScreenPoint lowerLeftPoint = ScreenPoint::ToScreenCoordinate(_ScreenSize, minPos);
 		ScreenPoint upperRightPoint = ScreenPoint::ToScreenCoordinate(_ScreenSize, maxPos);
 
-		//   ȭ    Ŭ ó
+		// 두 점이 화면 밖을 벗어나는 경우 클리핑 처리
 		lowerLeftPoint.X = Math::Max(0, lowerLeftPoint.X);
 		lowerLeftPoint.Y = Math::Min(_ScreenSize.Y, lowerLeftPoint.Y);
 		upperRightPoint.X = Math::Min(_ScreenSize.X, upperRightPoint.X);
 		upperRightPoint.Y = Math::Max(0, upperRightPoint.Y);
 
-		//      z
+		// 각 정점마다 보존된 뷰 공간의 z값
 		float invZ0 = 1.f / InVertices[0].Position.W;
 		float invZ1 = 1.f / InVertices[1].Position.W;
 		float invZ2 = 1.f / InVertices[2].Position.W;
 
-		// ﰢ     ϰ ĥ
+		// 삼각형 영역 내 모든 점을 점검하고 색칠
 		for (int x = lowerLeftPoint.X; x <= upperRightPoint.X; ++x)
 		{
 			for (int y = upperRightPoint.Y; y <= lowerLeftPoint.Y; ++y)
@@ -505,37 +625,37 @@ void SoftRenderer::DrawTriangle3D(std::vector<Vertex3D>& InVertices, const Linea
 				float t = (wdotu * udotv - wdotv * udotu) * invDenominator;
 				float oneMinusST = 1.f - s - t;
 
-				//    и
+				// 투영보정에 사용할 공통 분모
 				float z = invZ0 * oneMinusST + invZ1 * s + invZ2 * t;
 				float invZ = 1.f / z;
 
 				if (((s >= 0.f) && (s <= 1.f)) && ((t >= 0.f) && (t <= 1.f)) && ((oneMinusST >= 0.f) && (oneMinusST <= 1.f)))
 				{
-					//  ׽
+					// 깊이 테스팅
 					float newDepth = InVertices[0].Position.Z * oneMinusST + InVertices[1].Position.Z * s + InVertices[2].Position.Z * t;
 					float prevDepth = r.GetDepthBufferValue(fragment);
 					if (newDepth < prevDepth)
 					{
-						// ȼ óϱ    ۿ 
+						// 픽셀을 처리하기 전 깊이 값을 버퍼에 보관
 						r.SetDepthBufferValue(fragment, newDepth);
 					}
 					else
 					{
-						// ̹ տ  ׷Ƿ ȼ׸ 
+						// 이미 앞에 무언가 그려져있으므로 픽셀그리기는 생략
 						continue;
 					}
 
 					if (IsDepthBufferDrawing())
 					{
-						// ī޶κ Ÿ  ϰ ϴ   ȯ
+						// 카메라로부터의 거리에 따라 균일하게 증감하는 흑백 값으로 변환
 						float grayScale = (invZ - n) / (f - n);
 
-						//   ׸
+						// 뎁스 버퍼 그리기
 						r.DrawPoint(fragment, LinearColor::White * grayScale);
 					}
 					else
 					{
-						//   UV ǥ
+						// 최종 보정보간된 UV 좌표
 						Vector2 targetUV = (InVertices[0].UV * oneMinusST * invZ0 + InVertices[1].UV * s * invZ1 + InVertices[2].UV * t * invZ2) * invZ;
 						r.DrawPoint(fragment, FragmentShader3D(texture.GetSample(targetUV), InColor));
 					}
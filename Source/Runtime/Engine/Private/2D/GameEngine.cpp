@@ -3,37 +3,29 @@
 #include <random>
 using namespace CK::DD;
 
-// ޽
+// 메시
 const std::size_t GameEngine::QuadMesh = std::hash<std::string>()("SM_Quad");
 
-// ؽó
+// 텍스처
 const std::size_t GameEngine::BaseTexture = std::hash<std::string>()("Base");
 const std::string GameEngine::CharacterTexturePath("CKMan.png");
 
-struct GameObjectCompare
-{
-	bool operator()(const std::unique_ptr<GameObject>& lhs, std::size_t rhs)
-	{
-		return lhs->GetHash() < rhs;
-	}
-};
-
 void GameEngine::OnScreenResize(const ScreenPoint& InScreenSize)
 {
-	// ȭ ũ 
+	// 화면 크기의 설정
 	_ScreenSize = InScreenSize;
 	_MainCamera.SetViewportSize(_ScreenSize);
 }
 
 bool GameEngine::Init()
 {
-	// ̹ ʱȭǾ  ʱȭ  .
+	// 이미 초기화되어 있으면 초기화 진행하지 않음.
 	if (_IsInitialized)
 	{
 		return true;
 	}
 
-	// ȭ ũⰡ ùٷ Ǿ ִ Ȯ
+	// 화면 크기가 올바로 설정되어 있는지 확인
 	if (_ScreenSize.HasZero())
 	{
 		return false;
@@ -44,6 +36,11 @@ bool GameEngine::Init()
 		return false;
 	}
 
+	if (_JobSystemPtr == nullptr)
+	{
+		return false;
+	}
+
 	if (!LoadResources())
 	{
 		return false;
@@ -55,7 +52,7 @@ bool GameEngine::Init()
 
 bool GameEngine::LoadResources()
 {
-	// ޽  ε
+	// 메시 데이터 로딩
 	Mesh& quadMesh = CreateMesh(GameEngine::QuadMesh);
 
 	constexpr float squareHalfSize = 0.5f;
@@ -87,7 +84,7 @@ bool GameEngine::LoadResources()
 
 	quadMesh.CalculateBounds();
 
-	// ؽó ε
+	// 텍스처 로딩
 	Texture& baseTexture = CreateTexture(GameEngine::BaseTexture, GameEngine::CharacterTexturePath);
 	if (!baseTexture.IsIntialized())
 	{
@@ -117,42 +114,121 @@ Texture& GameEngine::CreateTexture(const std::size_t& InKey, const std::wstring&
 	return *_Textures.at(InKey).get();
 }
 
-GameObject& GameEngine::CreateNewGameObject(const std::string& InName)
+GameObject& GameEngine::CreateNewGameObject(const Name& InName)
 {
-	std::size_t inHash = std::hash<std::string>()(InName);
-	const auto it = std::lower_bound(SceneBegin(), SceneEnd(), inHash, GameObjectCompare());
+	const SlotHandle handle = AddGameObject(InName);
+	if (!handle.IsValid())
+	{
+		// 중복된 키 발생. 무시.
+		assert(false);
+		return GameObject::Invalid;
+	}
+
+	return *_Scene.Get(handle);
+}
 
-	auto newGameObject = std::make_unique<GameObject>(InName);
-	if (it != _Scene.end())
+std::vector<SlotHandle> GameEngine::CreateNewGameObjects(const std::vector<Name>& InNames)
+{
+	// 저장 공간을 미리 확보해 생성 중에 재할당이 일어나지 않도록 한다.
+	_Scene.Reserve(_Scene.GetSize() + InNames.size());
+	_SceneIndex.reserve(_SceneIndex.size() + InNames.size());
+
+	std::vector<SlotHandle> handles;
+	handles.reserve(InNames.size());
+	for (const auto& name : InNames)
 	{
-		std::size_t targetHash = (*it)->GetHash();
-		if (targetHash == inHash)
-		{
-			// ߺ Ű ߻. .
-			assert(false);
-			return GameObject::Invalid;
-		}
-		else if (targetHash < inHash)
-		{
-			_Scene.insert(it + 1, std::move(newGameObject));
-		}
-		else
-		{
-			_Scene.insert(it, std::move(newGameObject));
-		}
+		handles.push_back(AddGameObject(name));
 	}
-	else
+
+	return handles;
+}
+
+SlotHandle GameEngine::AddGameObject(const Name& InName)
+{
+	const auto result = _SceneIndex.try_emplace(InName);
+	if (!result.second)
 	{
-		_Scene.push_back(std::move(newGameObject));
+		return SlotHandle();
 	}
 
-	return GetGameObject(InName);
+	const SlotHandle handle = _Scene.Create(InName);
+	_Scene.Get(handle)->SetHandle(handle);
+	result.first->second = handle;
+	return handle;
 }
 
-GameObject& GameEngine::GetGameObject(const std::string& InName)
+bool GameEngine::DestroyGameObject(const SlotHandle& InHandle)
 {
-	std::size_t targetHash = std::hash<std::string>()(InName);
-	const auto it = std::lower_bound(SceneBegin(), SceneEnd(), targetHash, GameObjectCompare());
+	GameObject* gameObjectPtr = _Scene.Get(InHandle);
+	if (gameObjectPtr == nullptr)
+	{
+		return false;
+	}
 
-	return (it != _Scene.end()) ? *(*it).get() : GameObject::Invalid;
+	GameObject& gameObject = *gameObjectPtr;
+	if (gameObject.GetSceneProxy() != RectangleGrid::InvalidIndex)
+	{
+		_SceneGrid.Remove(gameObject.GetSceneProxy());
+	}
+
+	_BoneGameObjectPtrs.erase(gameObject.GetName());
+
+	_SceneIndex.erase(gameObject.GetName());
+	return _Scene.Destroy(InHandle);
+}
+
+SlotHandle GameEngine::FindGameObject(const Name& InName) const
+{
+	const auto it = _SceneIndex.find(InName);
+	return (it != _SceneIndex.end()) ? it->second : SlotHandle();
+}
+
+GameObject& GameEngine::GetGameObject(const Name& InName)
+{
+	return GetGameObject(FindGameObject(InName));
+}
+
+GameObject& GameEngine::GetGameObject(const SlotHandle& InHandle)
+{
+	GameObject* gameObjectPtr = _Scene.Get(InHandle);
+	return (gameObjectPtr != nullptr) ? *gameObjectPtr : GameObject::Invalid;
+}
+
+void GameEngine::UpdateSceneGrid()
+{
+	for (GameObject& gameObject : _Scene)
+	{
+		const int proxy = gameObject.GetSceneProxy();
+		const bool isRenderable = gameObject.HasMesh() && gameObject.IsVisible();
+		if (!isRenderable)
+		{
+			// 보이지 않게 된 오브젝트는 격자에서 제거
+			if (proxy != RectangleGrid::InvalidIndex)
+			{
+				_SceneGrid.Remove(proxy);
+				gameObject.SetSceneProxy(RectangleGrid::InvalidIndex, 0, Math::InvalidHash);
+			}
+			continue;
+		}
+
+		// 트랜스폼과 메시가 모두 바뀌지 않은 오브젝트는 건너뛴다. 메시가 바뀌면 로컬 영역이 달라지므로 다시 맞춘다.
+		const TransformComponent& transform = gameObject.GetTransform();
+		const UINT32 version = transform.GetVersion();
+		const std::size_t meshKey = gameObject.GetMeshKey();
+		if (proxy != RectangleGrid::InvalidIndex && version == gameObject.GetSceneProxyVersion() && meshKey == gameObject.GetSceneProxyMeshKey())
+		{
+			continue;
+		}
+
+		const Rectangle worldBound = GetMesh(meshKey).GetRectBound().TransformBy(transform.GetModelingMatrix());
+		if (proxy == RectangleGrid::InvalidIndex)
+		{
+			gameObject.SetSceneProxy(_SceneGrid.Insert(worldBound, &gameObject), version, meshKey);
+		}
+		else
+		{
+			_SceneGrid.Move(proxy, worldBound);
+			gameObject.SetSceneProxy(proxy, version, meshKey);
+		}
+	}
 }
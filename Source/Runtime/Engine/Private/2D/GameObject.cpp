@@ -2,4 +2,4 @@
 #include "Precompiled.h"
 using namespace CK::DD;
 
-GameObject GameObject::Invalid(Math::InvalidHashName);
+GameObject GameObject::Invalid(Name::None);
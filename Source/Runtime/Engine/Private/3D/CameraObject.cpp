@@ -10,4 +10,18 @@ void CameraObject::SetLookAtRotation(const GameObject& InGameObject, const Vecto
 void CameraObject::SetLookAtRotation(const Vector3& InTargetPosition, const Vector3& InUp)
 {
 	_Transform.SetWorldRotation(Quaternion(InTargetPosition - _Transform.GetWorldPosition()));
-}
\ No newline at end of file
+}
+
+float CameraObject::GetScreenSize(const Sphere& InWorldSphere) const
+{
+	const float distanceSquared = (InWorldSphere.Center - _Transform.GetWorldPosition()).SizeSquared();
+	const float radiusSquared = InWorldSphere.Radius * InWorldSphere.Radius;
+	if (distanceSquared <= radiusSquared)
+	{
+		return INFINITY;
+	}
+
+	// 시야각은 세로 방향 기준이므로 화면 높이의 절반이 1이 되도록 투영 거리를 곱한다.
+	const float d = 1.f / Math::Tan(Math::Deg2Rad(_FOV) * 0.5f);
+	return InWorldSphere.Radius * d / Math::Sqrt(distanceSquared - radiusSquared);
+}
@@ -2,51 +2,43 @@
 #include "Precompiled.h"
 using namespace CK::DDD;
 
-//  Ī
-const std::wstring GameEngine::RootBone(L"RootBone");
-const std::wstring GameEngine::PelvisBone(L"PelvisBone");
-const std::wstring GameEngine::SpineBone(L"SpineBone");
-const std::wstring GameEngine::LeftArmBone(L"LeftArmBone");
-const std::wstring GameEngine::RightArmBone(L"RightArmBone");
-const std::wstring GameEngine::NeckBone(L"NeckBone");
-const std::wstring GameEngine::LeftLegBone(L"LeftLegBone");
-const std::wstring GameEngine::RightLegBone(L"RightLegBone");
-
-// ޽
+// 본 명칭
+const Name GameEngine::RootBone(L"RootBone");
+const Name GameEngine::PelvisBone(L"PelvisBone");
+const Name GameEngine::SpineBone(L"SpineBone");
+const Name GameEngine::LeftArmBone(L"LeftArmBone");
+const Name GameEngine::RightArmBone(L"RightArmBone");
+const Name GameEngine::NeckBone(L"NeckBone");
+const Name GameEngine::LeftLegBone(L"LeftLegBone");
+const Name GameEngine::RightLegBone(L"RightLegBone");
+
+// 메시
 const std::size_t GameEngine::CharacterMesh = std::hash<std::wstring>()(L"SK_CKMan");
 const std::size_t GameEngine::ArrowMesh = std::hash<std::wstring>()(L"SM_Arrow");
 const std::size_t GameEngine::PlaneMesh = std::hash<std::wstring>()(L"SM_Plane");
 
-// ؽó
+// 텍스처
 const std::size_t GameEngine::BaseTexture = std::hash<std::wstring>()(L"Base");
 const std::wstring GameEngine::CharacterTexturePath(L"CKMan.png");
 
 const std::wstring GameEngine::MMDCharacterPath(L"Character.pmx");
 
-struct GameObjectCompare
-{
-	bool operator()(const std::unique_ptr<GameObject>& lhs, std::size_t rhs)
-	{
-		return lhs->GetHash() < rhs;
-	}
-};
-
 void GameEngine::OnScreenResize(const ScreenPoint& InScreenSize)
 {
-	// ȭ ũ 
+	// 화면 크기의 설정
 	_ScreenSize = InScreenSize;
 	_MainCamera.SetViewportSize(_ScreenSize);
 }
 
 bool GameEngine::Init()
 {
-	// ̹ ʱȭǾ  ʱȭ  .
+	// 이미 초기화되어 있으면 초기화 진행하지 않음.
 	if (_IsInitialized)
 	{
 		return true;
 	}
 
-	// ȭ ũⰡ ùٷ Ǿ ִ Ȯ
+	// 화면 크기가 올바로 설정되어 있는지 확인
 	if (_ScreenSize.HasZero())
 	{
 		return false;
@@ -57,6 +49,11 @@ bool GameEngine::Init()
 		return false;
 	}
 
+	if (_JobSystemPtr == nullptr)
+	{
+		return false;
+	}
+
 	if (!LoadResources())
 	{
 		return false;
@@ -68,7 +65,7 @@ bool GameEngine::Init()
 
 bool GameEngine::LoadResources()
 {
-	// ȭǥ ޽ ( ǥ 뵵)
+	// 화살표 메시 (본의 표시 용도)
 	Mesh& arrow = CreateMesh(GameEngine::ArrowMesh);
 	arrow.GetVertices().resize(arrowPositions.size());
 	arrow.GetIndices().resize(arrowIndice.size());
@@ -76,41 +73,28 @@ bool GameEngine::LoadResources()
 	std::copy(arrowPositions.begin(), arrowPositions.end(), arrow.GetVertices().begin());
 	std::copy(arrowIndice.begin(), arrowIndice.end(), arrow.GetIndices().begin());
 	std::fill(arrow.GetColors().begin(), arrow.GetColors().end(), LinearColor::Gray);
+	arrow.CalculateBounds();
 
-	// ٴ ޽ ( )
-	int planeHalfSize = 3;
+	// 바닥 메시 (기즈모 용)
 	Mesh& plane = CreateMesh(GameEngine::PlaneMesh);
-	for (int z = -planeHalfSize; z <= planeHalfSize; z++)
-	{
-		for (int x = -planeHalfSize; x <= planeHalfSize; x++)
-		{
-			plane.GetVertices().push_back(Vector3((float)x, 0.f, (float)z));
-		}
-	}
-
-	int xIndex = 0;
-	for (int tx = 0; tx < planeHalfSize * 2; tx++)
-	{
-		for (int ty = 0; ty < planeHalfSize * 2; ty++)
-		{
-			int v0 = xIndex + tx + (planeHalfSize * 2 + 1) * (ty + 1);
-			int v1 = xIndex + tx + (planeHalfSize * 2 + 1) * ty;
-			int v2 = v1 + 1;
-			int v3 = v0 + 1;
-			std::vector<size_t> quad = { (size_t)v0, (size_t)v2, (size_t)v1, (size_t)v0, (size_t)v3, (size_t)v2 };
-			plane.GetIndices().insert(plane.GetIndices().end(), quad.begin(), quad.end());
-		}
-	}
+	plane.GetVertices().resize(planePositions.size());
+	plane.GetIndices().resize(planeIndice.size());
+	std::copy(planePositions.begin(), planePositions.end(), plane.GetVertices().begin());
+	std::copy(planeIndice.begin(), planeIndice.end(), plane.GetIndices().begin());
+	plane.CalculateBounds();
 
-	// ؽ ε
+	// 텍스쳐 로딩
 	Texture& diffuseTexture = CreateTexture(GameEngine::BaseTexture, GameEngine::CharacterTexturePath);
 	assert(diffuseTexture.IsIntialized());
 
 	
-	// ĳ ޽  - MMD 
+	// 캐릭터 메시 생성 - MMD 모델
 	Mesh& characterMesh = CreateMesh(GameEngine::CharacterMesh);
 	PMXLoader::Load(*this, characterMesh, GameEngine::MMDCharacterPath);
-	
+	characterMesh.CalculateBounds();
+
+	// 멀리 있는 캐릭터의 정점 처리량을 줄이기 위해 로딩할 때 LOD를 미리 생성
+	characterMesh.BuildLODs();
 
 	return true;
 }
@@ -135,42 +119,171 @@ Texture& GameEngine::CreateTexture(const std::size_t& InKey, const std::wstring&
 	return *_Textures.at(InKey).get();
 }
 
-GameObject& GameEngine::CreateNewGameObject(const std::wstring& InName)
+GameObject& GameEngine::CreateNewGameObject(const Name& InName)
+{
+	const SlotHandle handle = AddGameObject(InName);
+	if (!handle.IsValid())
+	{
+		// 중복된 키 발생. 무시.
+		assert(false);
+		return GameObject::Invalid;
+	}
+
+	return *_Scene.Get(handle);
+}
+
+std::vector<SlotHandle> GameEngine::CreateNewGameObjects(const std::vector<Name>& InNames)
 {
-	std::size_t inHash = std::hash<std::wstring>()(InName);
-	const auto it = std::lower_bound(SceneBegin(), SceneEnd(), inHash, GameObjectCompare());
+	// 저장 공간을 미리 확보해 생성 중에 재할당이 일어나지 않도록 한다.
+	_Scene.Reserve(_Scene.GetSize() + InNames.size());
+	_SceneIndex.reserve(_SceneIndex.size() + InNames.size());
+
+	std::vector<SlotHandle> handles;
+	handles.reserve(InNames.size());
+	for (const auto& name : InNames)
+	{
+		handles.push_back(AddGameObject(name));
+	}
+
+	return handles;
+}
+
+SlotHandle GameEngine::AddGameObject(const Name& InName)
+{
+	const auto result = _SceneIndex.try_emplace(InName);
+	if (!result.second)
+	{
+		return SlotHandle();
+	}
+
+	const SlotHandle handle = _Scene.Create(InName);
+	_Scene.Get(handle)->SetHandle(handle);
+	result.first->second = handle;
+	return handle;
+}
+
+bool GameEngine::DestroyGameObject(const SlotHandle& InHandle)
+{
+	GameObject* gameObjectPtr = _Scene.Get(InHandle);
+	if (gameObjectPtr == nullptr)
+	{
+		return false;
+	}
 
-	auto newGameObject = std::make_unique<GameObject>(InName);
-	if (it != _Scene.end())
+	// 계층 구조에서 분리. 자식은 현재의 월드 트랜스폼을 유지한 채 루트가 된다.
+	GameObject& gameObject = *gameObjectPtr;
+	TransformComponent& transform = gameObject.GetTransform();
+	while (!transform.GetChildren().empty())
 	{
-		std::size_t targetHash = (*it)->GetHash();
-		if (targetHash == inHash)
+		if (!transform.GetChildren().back()->SetRoot())
 		{
-			// ߺ Ű ߻. .
 			assert(false);
-			return GameObject::Invalid;
+			return false;
 		}
-		else if (targetHash < inHash)
+	}
+	transform.RemoveFromParent();
+
+	if (gameObject.GetSceneProxy() != DynamicBoxTree::InvalidIndex)
+	{
+		_SceneTree.Remove(gameObject.GetSceneProxy());
+	}
+	_BoneGameObjectPtrs.erase(gameObject.GetName());
+
+	_SceneIndex.erase(gameObject.GetName());
+	return _Scene.Destroy(InHandle);
+}
+
+SlotHandle GameEngine::FindGameObject(const Name& InName) const
+{
+	const auto it = _SceneIndex.find(InName);
+	return (it != _SceneIndex.end()) ? it->second : SlotHandle();
+}
+
+GameObject& GameEngine::GetGameObject(const Name& InName)
+{
+	return GetGameObject(FindGameObject(InName));
+}
+
+GameObject& GameEngine::GetGameObject(const SlotHandle& InHandle)
+{
+	GameObject* gameObjectPtr = _Scene.Get(InHandle);
+	return (gameObjectPtr != nullptr) ? *gameObjectPtr : GameObject::Invalid;
+}
+
+void GameEngine::UpdateWorldTransforms()
+{
+	// 루트가 다른 서브트리는 서로의 트랜스폼을 읽지 않으므로 루트 단위로 나누어 동시에 계산한다.
+	_RootTransforms.clear();
+	for (const GameObject& gameObject : _Scene)
+	{
+		const TransformComponent& transform = gameObject.GetTransform();
+		if (!transform.HasParent())
 		{
-			_Scene.insert(it + 1, std::move(newGameObject));
+			_RootTransforms.push_back(&transform);
 		}
-		else
+	}
+	_JobSystemPtr->ParallelFor(0, _RootTransforms.size(), RootTransformGrainSize, [this](size_t InBegin, size_t InEnd)
+	{
+		for (size_t i = InBegin; i < InEnd; ++i)
 		{
-			_Scene.insert(it, std::move(newGameObject));
+			_RootTransforms[i]->UpdateSubtreeWorld();
 		}
-	}
-	else
+	});
+
+	// 메시마다 스켈레톤이 독립적이므로 스켈레톤 단위로도 나눈다. 스켈레톤 하나는 크기가 크면 내부에서 다시 나누어 계산한다.
+	_Skeletons.clear();
+	for (auto& mesh : _Meshes)
 	{
-		_Scene.push_back(std::move(newGameObject));
+		TransformHierarchy& skeleton = mesh.second->GetSkeleton();
+		if (skeleton.GetNodeCount() > 0)
+		{
+			_Skeletons.push_back(&skeleton);
+		}
 	}
-
-	return GetGameObject(InName);
+	_JobSystemPtr->ParallelFor(0, _Skeletons.size(), 1, [this](size_t InBegin, size_t InEnd)
+	{
+		for (size_t i = InBegin; i < InEnd; ++i)
+		{
+			_Skeletons[i]->UpdateWorld(_JobSystemPtr);
+		}
+	});
 }
 
-GameObject& GameEngine::GetGameObject(const std::wstring& InName)
+void GameEngine::UpdateSceneTree()
 {
-	std::size_t targetHash = std::hash<std::wstring>()(InName);
-	const auto it = std::lower_bound(SceneBegin(), SceneEnd(), targetHash, GameObjectCompare());
+	for (GameObject& gameObject : _Scene)
+	{
+		const int proxy = gameObject.GetSceneProxy();
+		const bool isRenderable = gameObject.HasMesh() && gameObject.IsVisible();
+		if (!isRenderable)
+		{
+			// 보이지 않게 된 오브젝트는 트리에서 제거
+			if (proxy != DynamicBoxTree::InvalidIndex)
+			{
+				_SceneTree.Remove(proxy);
+				gameObject.SetSceneProxy(DynamicBoxTree::InvalidIndex, 0, Math::InvalidHash);
+			}
+			continue;
+		}
 
-	return (it != _Scene.end()) ? *(*it).get() : GameObject::Invalid;
+		// 트랜스폼과 메시가 모두 바뀌지 않은 오브젝트는 건너뛴다. 월드 트랜스폼은 UpdateWorldTransforms에서 확정되어 있다.
+		const TransformComponent& transform = gameObject.GetTransform();
+		const UINT32 version = transform.GetWorldVersion();
+		const std::size_t meshKey = gameObject.GetMeshKey();
+		if (proxy != DynamicBoxTree::InvalidIndex && version == gameObject.GetSceneProxyVersion() && meshKey == gameObject.GetSceneProxyMeshKey())
+		{
+			continue;
+		}
+
+		const Box worldBound = GetMesh(meshKey).GetBoxBound().TransformBy(transform.GetWorldMatrix());
+		if (proxy == DynamicBoxTree::InvalidIndex)
+		{
+			gameObject.SetSceneProxy(_SceneTree.Insert(worldBound, &gameObject), version, meshKey);
+		}
+		else
+		{
+			_SceneTree.Move(proxy, worldBound);
+			gameObject.SetSceneProxy(proxy, version, meshKey);
+		}
+	}
 }
@@ -2,4 +2,4 @@
 #include "Precompiled.h"
 using namespace CK::DDD;
 
-GameObject GameObject::Invalid(L"!@CK_INVALIDHASH#$");
+GameObject GameObject::Invalid(Name::None);
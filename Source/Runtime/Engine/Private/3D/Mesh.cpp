@@ -7,3 +7,140 @@ void Mesh::CalculateBounds()
 	_SphereBound = Sphere(_Vertices);
 	_BoxBound = Box(_Vertices);
 }
+
+void Mesh::BuildLODs(size_t InMaxLODCount)
+{
+	_LODs.clear();
+	const size_t triangleCount = _Indices.size() / 3;
+	MeshSimplifier simplifier(_Vertices, _Indices);
+
+	// 스키닝 메시는 정점이 가장 크게 영향을 받는 본이 합칠 대상에도 영향을 줄 때만 합쳐서 관절 주변의 변형을 유지한다.
+	if (IsSkinnedMesh())
+	{
+		std::vector<Name> dominantBones(_Vertices.size());
+		for (size_t vi = 0; vi < _Vertices.size(); ++vi)
+		{
+			float maxValue = 0.f;
+			for (size_t wi = 0; wi < _ConnectedBones[vi]; ++wi)
+			{
+				if (_Weights[vi].Values[wi] > maxValue)
+				{
+					maxValue = _Weights[vi].Values[wi];
+					dominantBones[vi] = _Weights[vi].Bones[wi];
+				}
+			}
+		}
+
+		simplifier.SetCollapseFilter([this, dominantBones = std::move(dominantBones)](size_t InFrom, size_t InTo) {
+			const Name& bone = dominantBones[InFrom];
+			if (bone.IsNone())
+			{
+				return true;
+			}
+
+			const Weight& w = _Weights[InTo];
+			for (size_t wi = 0; wi < _ConnectedBones[InTo]; ++wi)
+			{
+				if (w.Bones[wi] == bone && w.Values[wi] > 0.f)
+				{
+					return true;
+				}
+			}
+			return false;
+		});
+	}
+
+	std::vector<size_t> indices;
+	std::vector<size_t> triangleSources;
+	std::vector<size_t> localVertices(_Vertices.size());
+	size_t previousCount = triangleCount;
+	float targetRatio = 1.f;
+	for (size_t lod = 1; lod < InMaxLODCount; ++lod)
+	{
+		targetRatio *= LODTriangleRatio;
+		const size_t targetCount = static_cast<size_t>(triangleCount * targetRatio);
+		if (targetCount < LODMinTriangleCount)
+		{
+			break;
+		}
+
+		// 고정된 정점이 많아 더 줄일 수 없으면 중단
+		const size_t simplifiedCount = simplifier.Simplify(targetCount, indices, triangleSources);
+		if (simplifiedCount > previousCount * LODMinReduction)
+		{
+			break;
+		}
+
+		// 사용하는 정점만 모아 LOD의 정점 번호로 바꾼다.
+		MeshLOD& newLOD = _LODs.emplace_back();
+		std::fill(localVertices.begin(), localVertices.end(), _Vertices.size());
+		newLOD.Indices.reserve(indices.size());
+		for (size_t index : indices)
+		{
+			if (localVertices[index] == _Vertices.size())
+			{
+				localVertices[index] = newLOD.Vertices.size();
+				newLOD.Vertices.push_back(index);
+			}
+			newLOD.Indices.push_back(localVertices[index]);
+		}
+
+		// 삼각형의 순서가 유지되므로 원본의 텍스처 범위에 속한 삼각형은 LOD에서도 연속되어 있다.
+		newLOD.TextureIndices.reserve(_TextureIndices.size());
+		for (const TexturesIndice& t : _TextureIndices)
+		{
+			const auto first = std::lower_bound(triangleSources.begin(), triangleSources.end(), t.StartIndex / 3);
+			const auto last = std::lower_bound(triangleSources.begin(), triangleSources.end(), t.EndIndex / 3);
+			newLOD.TextureIndices.emplace_back(t.TextureKey, (first - triangleSources.begin()) * 3, (last - triangleSources.begin()) * 3);
+		}
+
+		newLOD.ScreenSize = FullDetailScreenSize * Math::Sqrt(static_cast<float>(simplifiedCount) / static_cast<float>(triangleCount));
+		previousCount = simplifiedCount;
+	}
+}
+
+size_t Mesh::SelectLOD(float InScreenSize) const
+{
+	size_t lodIndex = 0;
+	while (lodIndex < _LODs.size() && InScreenSize < _LODs[lodIndex].ScreenSize)
+	{
+		lodIndex++;
+	}
+	return lodIndex;
+}
+
+int Mesh::FindBoneNode(const Name& InBoneName) const
+{
+	const auto it = _Bones.find(InBoneName);
+	return (it != _Bones.end()) ? it->second.GetNodeIndex() : TransformHierarchy::InvalidIndex;
+}
+
+Bone& Mesh::AddBone(const Name& InBoneName, const Transform& InBindPose, const Name& InParentBoneName)
+{
+	const auto it = _Bones.find(InBoneName);
+	if (it != _Bones.end())
+	{
+		// 같은 이름의 본이 이미 있으면 기존 본을 사용
+		return it->second;
+	}
+
+	// 스켈레톤에는 부모 본에 대한 로컬 트랜스폼을 저장
+	int parentNodeIndex = TransformHierarchy::InvalidIndex;
+	Transform localTransform = InBindPose;
+	const auto parentIt = _Bones.find(InParentBoneName);
+	if (parentIt != _Bones.end())
+	{
+		const Bone& parentBone = parentIt->second;
+		parentNodeIndex = parentBone.GetNodeIndex();
+		localTransform = InBindPose.WorldToLocal(parentBone.GetBindPose());
+	}
+
+	const int nodeIndex = _Skeleton.AddNode(localTransform, parentNodeIndex);
+	Bone& newBone = _Bones.emplace(InBoneName, Bone(InBoneName, InBindPose, nodeIndex)).first->second;
+	if (parentIt != _Bones.end())
+	{
+		newBone.SetParentName(InParentBoneName);
+	}
+
+	return newBone;
+}
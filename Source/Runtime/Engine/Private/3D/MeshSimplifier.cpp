@@ -0,0 +1,339 @@
+#include "Precompiled.h"
+using namespace CK::DDD;
+
+namespace
+{
+
+// 점과 평면 사이의 거리 제곱을 누적하는 대칭 4x4 행렬. 오차가 누적되므로 double로 계산한다.
+struct Quadric
+{
+	void AddPlane(const Vector3& InNormal, float InDistance, double InWeight)
+	{
+		const double a = InNormal.X, b = InNormal.Y, c = InNormal.Z, d = InDistance;
+		A00 += InWeight * a * a; A01 += InWeight * a * b; A02 += InWeight * a * c; A03 += InWeight * a * d;
+		A11 += InWeight * b * b; A12 += InWeight * b * c; A13 += InWeight * b * d;
+		A22 += InWeight * c * c; A23 += InWeight * c * d;
+		A33 += InWeight * d * d;
+	}
+
+	double Evaluate(const Vector3& InPoint) const
+	{
+		const double x = InPoint.X, y = InPoint.Y, z = InPoint.Z;
+		return x * x * A00 + 2.0 * x * y * A01 + 2.0 * x * z * A02 + 2.0 * x * A03
+			+ y * y * A11 + 2.0 * y * z * A12 + 2.0 * y * A13
+			+ z * z * A22 + 2.0 * z * A23
+			+ A33;
+	}
+
+	Quadric operator+(const Quadric& InQuadric) const
+	{
+		Quadric result = *this;
+		result += InQuadric;
+		return result;
+	}
+
+	Quadric& operator+=(const Quadric& InQuadric)
+	{
+		A00 += InQuadric.A00; A01 += InQuadric.A01; A02 += InQuadric.A02; A03 += InQuadric.A03;
+		A11 += InQuadric.A11; A12 += InQuadric.A12; A13 += InQuadric.A13;
+		A22 += InQuadric.A22; A23 += InQuadric.A23;
+		A33 += InQuadric.A33;
+		return *this;
+	}
+
+	double A00 = 0.0, A01 = 0.0, A02 = 0.0, A03 = 0.0;
+	double A11 = 0.0, A12 = 0.0, A13 = 0.0;
+	double A22 = 0.0, A23 = 0.0;
+	double A33 = 0.0;
+};
+
+// From 정점을 To 정점으로 합치는 후보
+struct Collapse
+{
+	size_t From;
+	size_t To;
+	double Cost;
+};
+
+// 가장자리의 모양을 유지하기 위해 가장자리에 수직인 평면에 주는 가중치
+constexpr double BorderPlaneWeight = 10.0;
+
+// 합친 후 삼각형의 법선이 원래 법선과 이루는 각의 코사인이 이 값 이하면 뒤집힌 것으로 본다. (약 75도)
+constexpr float FlipCosineThreshold = 0.25f;
+
+FORCEINLINE UINT64 MakeEdgeKey(size_t InVertex0, size_t InVertex1)
+{
+	const UINT64 v0 = static_cast<UINT64>(Math::Min(InVertex0, InVertex1));
+	const UINT64 v1 = static_cast<UINT64>(Math::Max(InVertex0, InVertex1));
+	return (v0 << 32) | v1;
+}
+
+// 간선마다 몇 개의 삼각형이 공유하는지 센다. 1이면 열린 가장자리, 3 이상이면 비다양체 간선이다.
+void CountEdges(const std::vector<size_t>& InIndices, std::unordered_map<UINT64, UINT32>& OutEdgeCounts)
+{
+	OutEdgeCounts.clear();
+	OutEdgeCounts.reserve(InIndices.size());
+	for (size_t i = 0; i < InIndices.size(); i += 3)
+	{
+		for (size_t k = 0; k < 3; ++k)
+		{
+			OutEdgeCounts[MakeEdgeKey(InIndices[i + k], InIndices[i + (k + 1) % 3])]++;
+		}
+	}
+}
+
+FORCEINLINE Vector3 GetTriangleNormal(const Vector3& InP0, const Vector3& InP1, const Vector3& InP2)
+{
+	return (InP1 - InP0).Cross(InP2 - InP0);
+}
+
+}
+
+MeshSimplifier::MeshSimplifier(const std::vector<Vector3>& InPositions, const std::vector<size_t>& InIndices) : _Positions(InPositions), _Indices(InIndices)
+{
+	assert(_Indices.size() % 3 == 0);
+	assert(_Positions.size() < (static_cast<size_t>(1) << 32));
+}
+
+size_t MeshSimplifier::Simplify(size_t InTargetTriangleCount, std::vector<size_t>& OutIndices, std::vector<size_t>& OutTriangleSources) const
+{
+	const size_t vertexCount = _Positions.size();
+	OutIndices = _Indices;
+	OutTriangleSources.resize(GetTriangleCount());
+	std::iota(OutTriangleSources.begin(), OutTriangleSources.end(), static_cast<size_t>(0));
+
+	// 위치가 같은 정점이 둘 이상이면 UV 이음새나 재질 경계이므로 고정한다. 한쪽만 움직이면 틈이 벌어진다.
+	std::vector<BYTE> isLocked(vertexCount, false);
+	std::vector<size_t> sortedVertices(vertexCount);
+	std::iota(sortedVertices.begin(), sortedVertices.end(), static_cast<size_t>(0));
+	std::sort(sortedVertices.begin(), sortedVertices.end(), [this](size_t InLeft, size_t InRight) {
+		const Vector3& l = _Positions[InLeft];
+		const Vector3& r = _Positions[InRight];
+		return (l.X != r.X) ? (l.X < r.X) : (l.Y != r.Y) ? (l.Y < r.Y) : (l.Z < r.Z);
+	});
+	for (size_t i = 1; i < vertexCount; ++i)
+	{
+		const Vector3& l = _Positions[sortedVertices[i - 1]];
+		const Vector3& r = _Positions[sortedVertices[i]];
+		if (l.X == r.X && l.Y == r.Y && l.Z == r.Z)
+		{
+			isLocked[sortedVertices[i - 1]] = true;
+			isLocked[sortedVertices[i]] = true;
+		}
+	}
+
+	// 정점마다 주변 삼각형 평면의 오차 행렬을 면적에 비례해 누적
+	std::vector<Quadric> quadrics(vertexCount);
+	std::unordered_map<UINT64, UINT32> edgeCounts;
+	CountEdges(OutIndices, edgeCounts);
+	std::vector<BYTE> isBorder(vertexCount, false);
+	for (size_t i = 0; i < OutIndices.size(); i += 3)
+	{
+		const size_t v[3] = { OutIndices[i], OutIndices[i + 1], OutIndices[i + 2] };
+		Vector3 normal = GetTriangleNormal(_Positions[v[0]], _Positions[v[1]], _Positions[v[2]]);
+		const float doubleArea = normal.Size();
+		if (doubleArea <= SMALL_NUMBER)
+		{
+			continue;
+		}
+		normal /= doubleArea;
+
+		Quadric faceQuadric;
+		faceQuadric.AddPlane(normal, -normal.Dot(_Positions[v[0]]), doubleArea * 0.5);
+		for (size_t k = 0; k < 3; ++k)
+		{
+			quadrics[v[k]] += faceQuadric;
+		}
+
+		// 열린 가장자리에는 면에 수직인 평면을 더해 가장자리가 안쪽으로 말려들지 않도록 한다.
+		for (size_t k = 0; k < 3; ++k)
+		{
+			const size_t v0 = v[k];
+			const size_t v1 = v[(k + 1) % 3];
+			const UINT32 count = edgeCounts[MakeEdgeKey(v0, v1)];
+			if (count == 1)
+			{
+				const Vector3 edge = _Positions[v1] - _Positions[v0];
+				const Vector3 borderNormal = edge.Cross(normal).GetNormalize();
+				Quadric borderQuadric;
+				borderQuadric.AddPlane(borderNormal, -borderNormal.Dot(_Positions[v0]), BorderPlaneWeight * edge.SizeSquared());
+				quadrics[v0] += borderQuadric;
+				quadrics[v1] += borderQuadric;
+				isBorder[v0] = true;
+				isBorder[v1] = true;
+			}
+			else if (count > 2)
+			{
+				// 비다양체 간선의 정점은 합치면 구조가 망가질 수 있으므로 고정
+				isLocked[v0] = true;
+				isLocked[v1] = true;
+			}
+		}
+	}
+
+	std::vector<size_t> triangleOffsets(vertexCount + 1);
+	std::vector<size_t> vertexTriangles;
+	std::vector<size_t> remap(vertexCount);
+	std::vector<BYTE> isChanged(vertexCount);
+	std::vector<double> bestCosts(vertexCount);
+	std::vector<size_t> bestTargets(vertexCount);
+	std::vector<Collapse> collapses;
+
+	size_t triangleCount = OutIndices.size() / 3;
+	while (triangleCount > InTargetTriangleCount)
+	{
+		// 정점마다 인접한 삼각형 목록 구성
+		std::fill(triangleOffsets.begin(), triangleOffsets.end(), static_cast<size_t>(0));
+		for (size_t index : OutIndices)
+		{
+			triangleOffsets[index + 1]++;
+		}
+		for (size_t vi = 0; vi < vertexCount; ++vi)
+		{
+			triangleOffsets[vi + 1] += triangleOffsets[vi];
+		}
+		vertexTriangles.resize(OutIndices.size());
+		std::vector<size_t> cursors(triangleOffsets.begin(), triangleOffsets.end() - 1);
+		for (size_t i = 0; i < OutIndices.size(); ++i)
+		{
+			vertexTriangles[cursors[OutIndices[i]]++] = i / 3;
+		}
+
+		// 정점마다 가장 오차가 작은 이웃 정점을 합칠 대상으로 고른다.
+		CountEdges(OutIndices, edgeCounts);
+		std::fill(bestTargets.begin(), bestTargets.end(), vertexCount);
+		auto considerCollapse = [&](size_t InFrom, size_t InTo) {
+			if (isLocked[InFrom])
+			{
+				return;
+			}
+
+			// 가장자리의 정점은 가장자리를 따라서만 움직인다.
+			if (isBorder[InFrom] && edgeCounts[MakeEdgeKey(InFrom, InTo)] != 1)
+			{
+				return;
+			}
+
+			if (_Filter && !_Filter(InFrom, InTo))
+			{
+				return;
+			}
+
+			const double cost = (quadrics[InFrom] + quadrics[InTo]).Evaluate(_Positions[InTo]);
+			if (bestTargets[InFrom] == vertexCount || cost < bestCosts[InFrom])
+			{
+				bestCosts[InFrom] = cost;
+				bestTargets[InFrom] = InTo;
+			}
+		};
+		for (size_t i = 0; i < OutIndices.size(); i += 3)
+		{
+			for (size_t k = 0; k < 3; ++k)
+			{
+				const size_t v0 = OutIndices[i + k];
+				const size_t v1 = OutIndices[i + (k + 1) % 3];
+				considerCollapse(v0, v1);
+				considerCollapse(v1, v0);
+			}
+		}
+
+		collapses.clear();
+		for (size_t vi = 0; vi < vertexCount; ++vi)
+		{
+			if (bestTargets[vi] != vertexCount)
+			{
+				collapses.push_back({ vi, bestTargets[vi], bestCosts[vi] });
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& InLeft, const Collapse& InRight) { return InLeft.Cost < InRight.Cost; });
+
+		// 오차가 작은 순서로 합친다. 한 번 바뀐 삼각형 주변은 이번 단계에서 다시 건드리지 않으므로 뒤집힘 검사가 항상 유효하다.
+		std::iota(remap.begin(), remap.end(), static_cast<size_t>(0));
+		std::fill(isChanged.begin(), isChanged.end(), static_cast<BYTE>(false));
+		size_t removedTriangles = 0;
+		size_t collapseCount = 0;
+		for (const Collapse& c : collapses)
+		{
+			if (isChanged[c.From] || isChanged[c.To])
+			{
+				continue;
+			}
+
+			// 남는 삼각형의 방향이 크게 바뀌거나 찌그러지면 합치지 않는다.
+			bool isFlipped = false;
+			size_t collapsedTriangles = 0;
+			for (size_t ai = triangleOffsets[c.From]; ai < triangleOffsets[c.From + 1]; ++ai)
+			{
+				const size_t i = vertexTriangles[ai] * 3;
+				const size_t v[3] = { OutIndices[i], OutIndices[i + 1], OutIndices[i + 2] };
+				if (v[0] == c.To || v[1] == c.To || v[2] == c.To)
+				{
+					collapsedTriangles++;
+					continue;
+				}
+
+				const Vector3 oldNormal = GetTriangleNormal(_Positions[v[0]], _Positions[v[1]], _Positions[v[2]]);
+				const Vector3 newNormal = GetTriangleNormal(
+					_Positions[(v[0] == c.From) ? c.To : v[0]],
+					_Positions[(v[1] == c.From) ? c.To : v[1]],
+					_Positions[(v[2] == c.From) ? c.To : v[2]]);
+				if (newNormal.Dot(oldNormal) <= FlipCosineThreshold * newNormal.Size() * oldNormal.Size() || newNormal.SizeSquared() <= SMALL_NUMBER)
+				{
+					isFlipped = true;
+					break;
+				}
+			}
+			if (isFlipped)
+			{
+				continue;
+			}
+
+			remap[c.From] = c.To;
+			quadrics[c.To] += quadrics[c.From];
+			for (size_t ai = triangleOffsets[c.From]; ai < triangleOffsets[c.From + 1]; ++ai)
+			{
+				const size_t i = vertexTriangles[ai] * 3;
+				isChanged[OutIndices[i]] = true;
+				isChanged[OutIndices[i + 1]] = true;
+				isChanged[OutIndices[i + 2]] = true;
+			}
+			removedTriangles += collapsedTriangles;
+			collapseCount++;
+
+			if (triangleCount - removedTriangles <= InTargetTriangleCount)
+			{
+				break;
+			}
+		}
+
+		// 더 이상 합칠 수 있는 정점이 없음
+		if (collapseCount == 0)
+		{
+			break;
+		}
+
+		// 합친 정점으로 인덱스를 바꾸고 면적이 없어진 삼각형을 제거. 순서는 그대로 유지한다.
+		size_t writeTriangle = 0;
+		for (size_t ti = 0; ti < triangleCount; ++ti)
+		{
+			const size_t v0 = remap[OutIndices[ti * 3]];
+			const size_t v1 = remap[OutIndices[ti * 3 + 1]];
+			const size_t v2 = remap[OutIndices[ti * 3 + 2]];
+			if (v0 == v1 || v1 == v2 || v2 == v0)
+			{
+				continue;
+			}
+
+			OutIndices[writeTriangle * 3] = v0;
+			OutIndices[writeTriangle * 3 + 1] = v1;
+			OutIndices[writeTriangle * 3 + 2] = v2;
+			OutTriangleSources[writeTriangle] = OutTriangleSources[ti];
+			writeTriangle++;
+		}
+		triangleCount = writeTriangle;
+		OutIndices.resize(triangleCount * 3);
+		OutTriangleSources.resize(triangleCount);
+	}
+
+	return triangleCount;
+}
@@ -5,7 +5,7 @@ using namespace CK::DDD;
 #include "ThirdParty/MMD/Pmx.h"
 
 bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring& InFileName) {
-	// PMX ҷ
+	// PMX 불러오기
 	oguna::EncodingConverter converter = oguna::EncodingConverter();
 
 	pmx::PmxModel x;
@@ -17,7 +17,7 @@ bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring&
 	std::istream is(&fb);
 	x.Read(&is);
 
-	// Ų ޽÷ 
+	// 스킨드 메시로 설정
 	InMesh.SetMeshType(MeshType::Skinned);
 
 	auto& v = InMesh.GetVertices();
@@ -28,30 +28,30 @@ bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring&
 	auto& cb = InMesh.GetConnectedBones();
 	auto& w = InMesh.GetWeights();
 
-	//  ҷ
-	std::vector<std::wstring> boneBuffer; boneBuffer.reserve(x.bone_count);
+	// 본 불러오기. 이름은 한 번만 등록해두고 정점의 본 연결 정보에서도 같이 사용
+	std::vector<Name> boneBuffer; boneBuffer.reserve(x.bone_count);
 	bones.reserve(x.bone_count);
+	InMesh.GetSkeleton().Reserve(x.bone_count);
 	for (size_t ix = 0; ix < x.bone_count; ++ix) {
-		//  
+		// 본 구성
 		auto& boneData = x.bones[ix];
-		const std::wstring& boneName = x.bones[ix].bone_name;
+		const Name boneName(x.bones[ix].bone_name);
 		Vector3 bonePosition = Vector3(x.bones[ix].position[0], x.bones[ix].position[1], x.bones[ix].position[2]);
-		bones.insert({ boneName, Bone(boneName, Transform(bonePosition)) });
 
-		// θ  -  ҷ  ̸   
+		// 부모 구성 - 기존에 불러와진 본 이름 버퍼 기반으로 가져오기
 		boneBuffer.push_back(boneName);
 		size_t index = static_cast<size_t>(x.bones[ix].parent_index);
-		if (boneBuffer.size() <= index) {
-			// θ ε  ߸ -> θ𺸴  ҷ ڽ ..?
+		if (index >= ix) {
+			// 부모 인덱스 정보가 없거나 잘못됨 -> 부모보다 먼저 불러와진 자식은 루트로 둔다.
+			InMesh.AddBone(boneName, Transform(bonePosition));
 			continue;
 		}
-		std::wstring parentBoneName = boneBuffer[index];
-		Bone& b = InMesh.GetBone(boneName);
-		b.SetParent(InMesh.GetBone(parentBoneName));
+		Bone& b = InMesh.AddBone(boneName, Transform(bonePosition), boneBuffer[index]);
 		b.SetProperty(boneData.bone_flag);
 	}
+	InMesh.GetSkeleton().UpdateWorld();
 
-	//   (, UV,  )
+	// 정점 버퍼 구성(정점, UV, 본 연결)
 	v.reserve(x.vertex_count);
 	uv.reserve(x.vertex_count);
 	cb.reserve(x.vertex_count);
@@ -59,31 +59,31 @@ bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring&
 	for (size_t ix = 0; ix < x.vertex_count; ++ix) {
 		v.emplace_back(Vector3(x.vertices[ix].positon[0], x.vertices[ix].positon[1], x.vertices[ix].positon[2]));
 
-		// UV y 
+		// UV는 y축 반전됨
 		uv.emplace_back(Vector2(x.vertices[ix].uv[0], 1.f - x.vertices[ix].uv[1]));
 
-		//    
+		// 본 연결 정보 구성
 		pmx::PmxVertexSkinningType type = x.vertices[ix].skinning_type;
 		switch (type) {
-		case pmx::PmxVertexSkinningType::BDEF1: //   1
+		case pmx::PmxVertexSkinningType::BDEF1: // 연결된 본이 1개
 		{
 			cb.push_back(1);
 			pmx::PmxVertexSkinningBDEF1* s = static_cast<pmx::PmxVertexSkinningBDEF1*>(x.vertices[ix].skinning.get());
-			std::wstring boneKey = boneBuffer[s->bone_index];
+			const Name& boneKey = boneBuffer[s->bone_index];
 			Weight newWeight{ { boneKey }, { 1.f } };
 			w.emplace_back(newWeight);
 			break;
 		}
-		case pmx::PmxVertexSkinningType::BDEF2: //   2
+		case pmx::PmxVertexSkinningType::BDEF2: // 연결된 본이 2개
 		{
 			cb.push_back(2);
 			pmx::PmxVertexSkinningBDEF2* s = static_cast<pmx::PmxVertexSkinningBDEF2*>(x.vertices[ix].skinning.get());
-			std::wstring boneKey1 = boneBuffer[s->bone_index1];
-			std::wstring boneKey2 = boneBuffer[s->bone_index2];
+			const Name& boneKey1 = boneBuffer[s->bone_index1];
+			const Name& boneKey2 = boneBuffer[s->bone_index2];
 			float boneWeight1 = s->bone_weight;
 			Weight newWeight{ 
 				{ boneKey1, boneKey2 }, 
-				// ġ  1̴ϱ, 2°  ġ 1 - ġ 
+				// 가중치 합 1이니까, 2번째 본의 가중치는 1 - 가중치로 구성
 				{ boneWeight1, 1.f - boneWeight1 }
 			};
 			w.emplace_back(newWeight);
@@ -93,10 +93,10 @@ bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring&
 		{
 			cb.push_back(4);
 			pmx::PmxVertexSkinningBDEF4* s = static_cast<pmx::PmxVertexSkinningBDEF4*>(x.vertices[ix].skinning.get());
-			const std::wstring& boneKey1 = boneBuffer[s->bone_index1];
-			const std::wstring& boneKey2 = boneBuffer[s->bone_index2];
-			const std::wstring& boneKey3 = boneBuffer[s->bone_index3];
-			const std::wstring& boneKey4 = boneBuffer[s->bone_index4];
+			const Name& boneKey1 = boneBuffer[s->bone_index1];
+			const Name& boneKey2 = boneBuffer[s->bone_index2];
+			const Name& boneKey3 = boneBuffer[s->bone_index3];
+			const Name& boneKey4 = boneBuffer[s->bone_index4];
 			float boneWeight1 = s->bone_weight1;
 			float boneWeight2 = s->bone_weight2;
 			float boneWeight3 = s->bone_weight3;
@@ -120,12 +120,12 @@ bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring&
 	}
 
 	i.reserve(x.index_count);
-	// ε  
+	// 인덱스 버퍼 구성
 	for (size_t ix = 0; ix < x.index_count; ++ix) {
 		i.emplace_back(x.indices[ix]);
 	}
 
-	// ؽó 
+	// 텍스처 구성
 	size_t textureId = 0;
 	for (size_t ix = 0; ix < x.texture_count; ++ix) {
 		std::wstring path = x.textures[ix];
@@ -134,8 +134,8 @@ bool PMXLoader::Load(GameEngine& InGameEngine, Mesh& InMesh, const std::wstring&
 		assert(texture.IsIntialized());
 	}
 
-	// TexturesIndice 
-	//  ؽó ϴ ﰢ index 
+	// TexturesIndice 구성
+	// 같은 텍스처를 사용하는 삼각형들의 index 범위
 	ti.reserve(x.material_count);
 	size_t cnt = 0;
 	for (size_t ix = 0; ix < x.material_count; ++ix) {
@@ -10,28 +10,30 @@ bool TransformComponent::RemoveFromParent()
 
 	TransformComponent& parent = *GetParentPtr();
 	auto it = std::find(parent.ChildBegin(), parent.ChildEnd(), this);
-	if (it != parent.ChildEnd())
+	if (it == parent.ChildEnd())
 	{
-		//  ߻.
+		// 오류 발생.
 		return false;
 	}
 
-	// θ Ʈ ڽ  Ѵ.
+	// 부모 트랜스폼에서 자식 정보를 제거한다.
 	parent.GetChildren().erase(it);
 
-	// ڽſԼ θ  Ѵ.
+	// 자신에게서 부모 정보를 제거한다.
 	_ParentPtr = nullptr;
 	return true;
 }
 
 bool TransformComponent::SetRoot()
 {
+	// 부모에서 분리하기 전에 현재 부모를 기준으로 한 월드 정보를 확정한다.
+	UpdateWorldIfDirty();
 	if (!RemoveFromParent())
 	{
 		return false;
 	}
 
-	//     Ѵ.
+	// 로컬 정보를 월드 정보로 변경한다.
 	UpdateLocal();
 	return true;
 }
@@ -50,31 +52,41 @@ FORCEINLINE TransformComponent& TransformComponent::GetRoot()
 
 bool TransformComponent::SetParent(TransformComponent& InTransform)
 {
-	//  带 θκ иѴ. 
+	// 현재 노드를 부모로부터 분리한다. 
 	if (!SetRoot())
 	{
 		return false;
 	}
 
-	// ο θ ڽ . ̹ ִ 쿡  ִ Ȳ.
+	// 새로운 부모의 자식으로 등록. 이미 있는 경우에는 문제가 있는 상황.
 	auto it = std::find(InTransform.ChildBegin(), InTransform.ChildEnd(), this);
 	if (it != InTransform.ChildEnd())
 	{
 		return false;
 	}
 
-	// ο Ʈ  θ 缳
+	// 새로운 트랜스폼 노드로 부모 재설정
 	InTransform.GetChildren().emplace_back(this);
 	_ParentPtr = &InTransform;
 	TransformComponent& newParent = *_ParentPtr;
 
-	// ο θ  ڽ   ƮѴ.
+	// 새로운 부모에 맞춰 자신의 로컬 정보를 업데이트한다.
 	UpdateLocal();
 
 	return true;
 }
 
-//  , Ȥ θ Ǹ ̸    
+void TransformComponent::UpdateSubtreeWorld() const
+{
+	// 자신이 최신이어도 자손은 갱신이 필요할 수 있으므로 끝까지 내려간다.
+	UpdateWorldIfDirty();
+	for (auto it = ChildBegin(); it != ChildEnd(); ++it)
+	{
+		(*it)->UpdateSubtreeWorld();
+	}
+}
+
+// 월드 정보, 혹은 부모가 변경되면 이를 기반으로 로컬 정보를 변경
 void TransformComponent::UpdateLocal()
 {
 	if (HasParent())
@@ -86,31 +98,47 @@ void TransformComponent::UpdateLocal()
 	{
 		_LocalTransform = _WorldTransform;
 	}
+
+	_WorldMatrix = Affine3x4(_WorldTransform);
+	++_WorldVersion;
+	_IsWorldDirty = false;
+
+	// 자식의 월드 정보는 읽을 때 다시 계산 ( 로컬 정보는 변함 없음. )
+	for (auto it = ChildBegin(); it != ChildEnd(); ++it)
+	{
+		(*it)->MarkWorldDirty();
+	}
 }
 
-//   Ʈ Ǿ   ٽ 
-void TransformComponent::UpdateWorld()
+// 로컬 정보가 바뀐 노드와 그 자손을 갱신 필요 상태로 표시
+void TransformComponent::MarkWorldDirty()
 {
-	// ڽ   Ʈ
-	if (HasParent())
+	// 이미 표시된 노드의 자손은 모두 표시되어 있으므로 더 내려가지 않는다.
+	if (_IsWorldDirty)
 	{
-		const TransformComponent& parent = *GetParentPtr();
-		_WorldTransform = _LocalTransform.LocalToWorld(parent.GetWorldTransform());
+		return;
 	}
-	else
+
+	_IsWorldDirty = true;
+	for (auto it = ChildBegin(); it != ChildEnd(); ++it)
 	{
-		_WorldTransform = _LocalTransform;
+		(*it)->MarkWorldDirty();
 	}
-
-	//     ڽ   Ʈ (    . )
-	UpdateChildrenWorld();
 }
 
-void TransformComponent::UpdateChildrenWorld()
+// 로컬 정보와 부모의 월드 정보로 자신의 월드 정보만 다시 계산. 부모가 갱신 필요 상태이면 부모를 먼저 계산한다.
+void TransformComponent::UpdateWorld() const
 {
-	for (auto it = ChildBegin(); it != ChildEnd(); ++it)
+	if (HasParent())
 	{
-		(*it)->UpdateWorld();
+		const TransformComponent& parent = *GetParentPtr();
+		_WorldTransform = _LocalTransform.LocalToWorld(parent.GetWorldTransform());
 	}
+	else
+	{
+		_WorldTransform = _LocalTransform;
+	}
+	_WorldMatrix = Affine3x4(_WorldTransform);
+	++_WorldVersion;
+	_IsWorldDirty = false;
 }
-
@@ -0,0 +1,130 @@
+#include "Precompiled.h"
+using namespace CK::DDD;
+
+int TransformHierarchy::AddNode(const Transform& InLocalTransform, int InParentIndex)
+{
+	const int index = static_cast<int>(_Parents.size());
+
+	// 부모가 뒤에 오면 한 번의 순회로 계산할 수 없으므로 허용하지 않는다.
+	assert(InParentIndex == InvalidIndex || IsValidIndex(InParentIndex));
+	_Parents.push_back(IsValidIndex(InParentIndex) ? InParentIndex : InvalidIndex);
+
+	const int depth = IsValidIndex(InParentIndex) ? _Depths[InParentIndex] + 1 : 0;
+	_Depths.push_back(depth);
+	if (depth >= static_cast<int>(_Levels.size()))
+	{
+		_Levels.emplace_back();
+	}
+	_Levels[depth].push_back(index);
+
+	_LocalPositions.push_back(InLocalTransform.GetPosition());
+	_LocalRotations.push_back(InLocalTransform.GetRotation());
+	_LocalScales.push_back(InLocalTransform.GetScale());
+
+	_WorldPositions.emplace_back();
+	_WorldRotations.emplace_back();
+	_WorldScales.emplace_back(Vector3::One);
+	_WorldMatrices.emplace_back();
+
+	_IsDirty.push_back(true);
+	_HasDirtyNode = true;
+	return index;
+}
+
+void TransformHierarchy::Reserve(size_t InCount)
+{
+	_Parents.reserve(InCount);
+	_Depths.reserve(InCount);
+	_LocalPositions.reserve(InCount);
+	_LocalRotations.reserve(InCount);
+	_LocalScales.reserve(InCount);
+	_WorldPositions.reserve(InCount);
+	_WorldRotations.reserve(InCount);
+	_WorldScales.reserve(InCount);
+	_WorldMatrices.reserve(InCount);
+	_IsDirty.reserve(InCount);
+}
+
+void TransformHierarchy::Clear()
+{
+	_Parents.clear();
+	_Depths.clear();
+	_Levels.clear();
+	_LocalPositions.clear();
+	_LocalRotations.clear();
+	_LocalScales.clear();
+	_WorldPositions.clear();
+	_WorldRotations.clear();
+	_WorldScales.clear();
+	_WorldMatrices.clear();
+	_IsDirty.clear();
+	_HasDirtyNode = false;
+}
+
+void TransformHierarchy::UpdateWorld(JobSystem* InJobSystem)
+{
+	if (!_HasDirtyNode)
+	{
+		return;
+	}
+
+	const size_t nodeCount = _Parents.size();
+	if (InJobSystem == nullptr || nodeCount < ParallelGrainSize)
+	{
+		// 부모가 항상 앞에 있으므로 배열 순서대로 계산하면 부모의 월드 정보와 표시는 이미 확정되어 있다.
+		for (int i = 0; i < static_cast<int>(nodeCount); ++i)
+		{
+			UpdateNode(i);
+		}
+	}
+	else
+	{
+		// 한 깊이의 계산이 모두 끝난 후 다음 깊이로 넘어가므로 부모의 값은 항상 확정되어 있다.
+		for (const std::vector<int>& level : _Levels)
+		{
+			InJobSystem->ParallelFor(0, level.size(), ParallelGrainSize, [this, &level](size_t InBegin, size_t InEnd)
+			{
+				for (size_t i = InBegin; i < InEnd; ++i)
+				{
+					UpdateNode(level[i]);
+				}
+			});
+		}
+	}
+
+	// 자식이 부모의 표시를 참조하므로 순회가 끝난 후에 한 번에 지운다.
+	std::fill(_IsDirty.begin(), _IsDirty.end(), static_cast<BYTE>(false));
+	_HasDirtyNode = false;
+}
+
+void TransformHierarchy::UpdateNode(int InIndex)
+{
+	const int parent = _Parents[InIndex];
+	if (parent != InvalidIndex && _IsDirty[parent])
+	{
+		_IsDirty[InIndex] = true;
+	}
+
+	if (!_IsDirty[InIndex])
+	{
+		return;
+	}
+
+	if (parent == InvalidIndex)
+	{
+		_WorldPositions[InIndex] = _LocalPositions[InIndex];
+		_WorldRotations[InIndex] = _LocalRotations[InIndex];
+		_WorldScales[InIndex] = _LocalScales[InIndex];
+	}
+	else
+	{
+		// Transform::LocalToWorld와 같은 계산
+		const Vector3& parentScale = _WorldScales[parent];
+		const Quaternion& parentRotation = _WorldRotations[parent];
+		_WorldScales[InIndex] = parentScale * _LocalScales[InIndex];
+		_WorldRotations[InIndex] = parentRotation * _LocalRotations[InIndex];
+		_WorldPositions[InIndex] = _WorldPositions[parent] + parentRotation * (parentScale * _LocalPositions[InIndex]);
+	}
+
+	_WorldMatrices[InIndex] = Affine3x4(Transform(_WorldPositions[InIndex], _WorldRotations[InIndex], _WorldScales[InIndex]));
+}
@@ -0,0 +1,271 @@
+#include "Precompiled.h"
+using namespace CK;
+
+thread_local UINT32 JobSystem::_ThreadIndex = 0;
+
+bool JobSystem::Init(UINT32 InWorkerCount)
+{
+	if (IsInitialized())
+	{
+		return true;
+	}
+
+	UINT32 workerCount = InWorkerCount;
+	if (workerCount == 0)
+	{
+		const UINT32 hardwareCount = std::thread::hardware_concurrency();
+		workerCount = (hardwareCount > 1) ? hardwareCount - 1 : 0;
+	}
+
+	_Queues.reserve(workerCount + 1);
+	for (UINT32 i = 0; i <= workerCount; ++i)
+	{
+		_Queues.emplace_back(std::make_unique<WorkerQueue>());
+	}
+
+	_IsRunning = true;
+	_Workers.reserve(workerCount);
+	for (UINT32 i = 1; i <= workerCount; ++i)
+	{
+		_Workers.emplace_back(&JobSystem::WorkerMain, this, i);
+	}
+
+	return true;
+}
+
+void JobSystem::Shutdown()
+{
+	if (!IsInitialized())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_SleepMutex);
+		_IsRunning = false;
+	}
+	_WakeCondition.notify_all();
+
+	for (std::thread& worker : _Workers)
+	{
+		worker.join();
+	}
+	_Workers.clear();
+
+	// 남은 작업은 호출한 스레드에서 마저 처리
+	Job job;
+	while (TryGetJob(job))
+	{
+		Execute(job);
+	}
+
+	_Queues.clear();
+}
+
+void JobSystem::Run(std::function<void()> InFunction, JobCounter* InCounter)
+{
+	if (InCounter != nullptr)
+	{
+		InCounter->_Count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	Submit(Job{ std::move(InFunction), InCounter });
+}
+
+void JobSystem::RunAfter(JobCounter& InDependency, std::function<void()> InFunction, JobCounter* InCounter)
+{
+	// 기다리는 쪽에서 보면 등록한 순간부터 끝나지 않은 작업이다.
+	if (InCounter != nullptr)
+	{
+		InCounter->_Count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	Job job{ std::move(InFunction), InCounter };
+	{
+		std::lock_guard<std::mutex> lock(InDependency._Mutex);
+		if (!InDependency.IsDone())
+		{
+			InDependency._Continuations.emplace_back(std::move(job));
+			return;
+		}
+	}
+
+	Submit(std::move(job));
+}
+
+void JobSystem::Wait(JobCounter& InCounter)
+{
+	Job job;
+	while (!InCounter.IsDone())
+	{
+		if (TryGetJob(job))
+		{
+			Execute(job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	// 마지막 작업을 실행한 스레드가 카운터의 잠금을 풀 때까지 기다린 후 돌아간다.
+	std::lock_guard<std::mutex> lock(InCounter._Mutex);
+}
+
+void JobSystem::Submit(Job&& InJob)
+{
+	if (!IsInitialized())
+	{
+		// 초기화 전에는 바로 실행
+		Execute(InJob);
+		return;
+	}
+
+	// 작업 스레드가 아닌 스레드는 0번 큐를 함께 사용한다.
+	WorkerQueue& queue = *_Queues[_ThreadIndex < _Queues.size() ? _ThreadIndex : 0];
+	{
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		queue.Jobs.PushBack(std::move(InJob));
+	}
+
+	// 작업 스레드가 잠들기 직전에 놓치지 않도록 잠금을 거친 후 깨운다.
+	_QueuedJobCount.fetch_add(1, std::memory_order_release);
+	{
+		std::lock_guard<std::mutex> lock(_SleepMutex);
+	}
+	_WakeCondition.notify_one();
+}
+
+bool JobSystem::TryGetJob(Job& OutJob)
+{
+	const size_t queueCount = _Queues.size();
+	if (queueCount == 0 || _QueuedJobCount.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	// 자신의 큐에서는 최근에 넣은 작업을 먼저 꺼내 캐시에 남은 데이터를 활용한다.
+	const size_t ownIndex = _ThreadIndex < queueCount ? _ThreadIndex : 0;
+	{
+		WorkerQueue& queue = *_Queues[ownIndex];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		if (!queue.Jobs.IsEmpty())
+		{
+			queue.Jobs.PopBack(OutJob);
+			_QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	// 다른 큐에서는 가장 오래된 작업을 가져온다. 오래된 작업일수록 큰 단위의 작업일 가능성이 높다.
+	for (size_t offset = 1; offset < queueCount; ++offset)
+	{
+		WorkerQueue& queue = *_Queues[(ownIndex + offset) % queueCount];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		if (!queue.Jobs.IsEmpty())
+		{
+			queue.Jobs.PopFront(OutJob);
+			_QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::Execute(Job& InJob)
+{
+	InJob.Function();
+	InJob.Function = nullptr;
+
+	JobCounter* counter = InJob.Counter;
+	if (counter == nullptr)
+	{
+		return;
+	}
+
+	// RunAfter와 순서가 엇갈리지 않도록 잠근 상태에서 줄이고, 마지막 작업이면 기다리던 작업을 가져온다.
+	// 잠금을 푼 후에는 카운터가 사라질 수 있으므로 더 이상 접근하지 않는다.
+	std::vector<Job> continuations;
+	{
+		std::lock_guard<std::mutex> lock(counter->_Mutex);
+		if (counter->_Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			continuations.swap(counter->_Continuations);
+		}
+	}
+
+	for (Job& continuation : continuations)
+	{
+		Submit(std::move(continuation));
+	}
+}
+
+void JobSystem::WorkerMain(UINT32 InThreadIndex)
+{
+	_ThreadIndex = InThreadIndex;
+
+	Job job;
+	while (true)
+	{
+		if (TryGetJob(job))
+		{
+			Execute(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(_SleepMutex);
+		_WakeCondition.wait(lock, [this]() { return !_IsRunning || _QueuedJobCount.load(std::memory_order_acquire) > 0; });
+		if (!_IsRunning)
+		{
+			return;
+		}
+	}
+}
+
+void JobSystem::JobRing::PushBack(Job&& InJob)
+{
+	if (_Count == _Slots.size())
+	{
+		Grow();
+	}
+
+	const size_t mask = _Slots.size() - 1;
+	_Slots[(_Head + _Count) & mask] = std::move(InJob);
+	++_Count;
+}
+
+void JobSystem::JobRing::PopBack(Job& OutJob)
+{
+	assert(_Count > 0);
+	const size_t mask = _Slots.size() - 1;
+	Job& slot = _Slots[(_Head + _Count - 1) & mask];
+	OutJob = std::move(slot);
+	slot.Function = nullptr; // 함수가 붙잡은 값을 바로 놓아준다.
+	--_Count;
+}
+
+void JobSystem::JobRing::PopFront(Job& OutJob)
+{
+	assert(_Count > 0);
+	const size_t mask = _Slots.size() - 1;
+	Job& slot = _Slots[_Head];
+	OutJob = std::move(slot);
+	slot.Function = nullptr; // 함수가 붙잡은 값을 바로 놓아준다.
+	_Head = (_Head + 1) & mask;
+	--_Count;
+}
+
+void JobSystem::JobRing::Grow()
+{
+	// 남은 작업을 넣은 순서대로 새 버퍼의 앞쪽으로 옮긴다.
+	std::vector<Job> newSlots(_Slots.size() * 2);
+	const size_t mask = _Slots.size() - 1;
+	for (size_t i = 0; i < _Count; ++i)
+	{
+		newSlots[i] = std::move(_Slots[(_Head + i) & mask]);
+	}
+
+	_Slots.swap(newSlots);
+	_Head = 0;
+}
@@ -0,0 +1,61 @@
+#include "Precompiled.h"
+using namespace CK;
+
+namespace
+{
+
+// 등록된 문자열과 번호를 보관하는 전역 테이블.
+// 문자열은 deque에 저장하므로 뒤에 추가되어도 앞서 돌려준 참조는 유효하다.
+struct NameTable
+{
+	NameTable()
+	{
+		// 0번은 빈 문자열로 예약
+		Strings.emplace_back();
+		Indices.emplace(Strings.back(), 0);
+	}
+
+	std::mutex Mutex;
+	std::deque<std::wstring> Strings;
+	std::unordered_map<std::wstring, UINT32> Indices;
+};
+
+NameTable& GetNameTable()
+{
+	// 다른 전역 변수의 초기화 중에도 이름을 만들 수 있도록 처음 사용할 때 생성한다.
+	static NameTable table;
+	return table;
+}
+
+}
+
+const Name Name::None;
+
+const std::wstring& Name::ToString() const
+{
+	NameTable& table = GetNameTable();
+	std::lock_guard<std::mutex> lock(table.Mutex);
+	assert(_Index < table.Strings.size());
+	return table.Strings[_Index];
+}
+
+UINT32 Name::FindOrAdd(const std::wstring& InString)
+{
+	if (InString.empty())
+	{
+		return 0;
+	}
+
+	NameTable& table = GetNameTable();
+	std::lock_guard<std::mutex> lock(table.Mutex);
+	const auto it = table.Indices.find(InString);
+	if (it != table.Indices.end())
+	{
+		return it->second;
+	}
+
+	const UINT32 newIndex = static_cast<UINT32>(table.Strings.size());
+	table.Strings.push_back(InString);
+	table.Indices.emplace(InString, newIndex);
+	return newIndex;
+}
@@ -44,16 +44,10 @@ void Texture::LoadFromFile(FILE* InFilePtr)
 	_Width = static_cast<UINT32>(width);
 	_Height = static_cast<UINT32>(height);
 	size_t pixelNumbers = static_cast<size_t>(_Width) * static_cast<size_t>(_Height);
-	_Buffer.reserve(pixelNumbers);
-	for (size_t j = 0; j < _Height; j++)
-	{
-		for (size_t i = 0; i < _Width; i++)
-		{
-			size_t ix = (j * _Width + i) * 4;
-			Color32 c(pixelsPtr[ix], pixelsPtr[ix + 1], pixelsPtr[ix + 2], pixelsPtr[ix + 3]);
-			_Buffer.push_back(LinearColor(c));
-		}
-	}
+	_Buffer.resize(pixelNumbers);
+	static_assert(sizeof(UNorm8x4) == _Channel, "Texel must match the loaded channel layout");
+	std::memcpy(_Buffer.data(), pixelsPtr, pixelNumbers * _Channel);
+	stbi_image_free(pixelsPtr);
 
 	return;
 }
@@ -80,5 +74,6 @@ LinearColor Texture::GetSample(Vector2 InUV) const
 		return LinearColor::Error;
 	}
 
-	return _Buffer[index];
+	const Vector4 texel = _Buffer[index].ToVector4();
+	return LinearColor(texel.X, texel.Y, texel.Z, texel.W);
 }
\ No newline at end of file
@@ -12,19 +12,22 @@ public:
 	~CameraObject() { }
 
 public:
-	// Ʈ
+	// 트랜스폼
 	TransformComponent& GetTransform() { return _Transform; }
 	const TransformComponent& GetTransform() const { return _Transform; }
 
-	// ī޶   Լ
+	// 카메라 값을 가져오는 함수
 	const ScreenPoint& GetViewportSize() const { return _ViewportSize; }
 
-	// ī޶  ϴ Լ
+	// 카메라 값을 설정하는 함수
 	void SetViewportSize(const ScreenPoint & InViewportSize) { _ViewportSize = InViewportSize; }
 
-	//  
+	// 행렬 생성
 	FORCEINLINE Matrix3x3 GetViewMatrix() const;
 
+	// 화면에 보이는 월드 공간의 영역
+	FORCEINLINE Rectangle GetViewRectangle() const;
+
 private:
 	TransformComponent _Transform;
 	ScreenPoint _ViewportSize;
@@ -35,5 +38,12 @@ FORCEINLINE Matrix3x3 CameraObject::GetViewMatrix() const
 	return Matrix3x3(Vector3::UnitX, Vector3::UnitY, Vector3(-_Transform.GetPosition()));
 }
 
+FORCEINLINE Rectangle CameraObject::GetViewRectangle() const
+{
+	const Vector2 viewPosition = _Transform.GetPosition();
+	const Vector2 extent(_ViewportSize.X * 0.5f, _ViewportSize.Y * 0.5f);
+	return Rectangle(viewPosition - extent, viewPosition + extent);
+}
+
 }
 }
\ No newline at end of file
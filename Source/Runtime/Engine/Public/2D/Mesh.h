@@ -10,7 +10,7 @@ class Mesh
 public:
 	Mesh() = default;
 
-	// Ӽ  Լ
+	// 속성 관련 함수
 	void SetMeshType(const MeshType & _InMeshType) { _MeshType = _InMeshType; }
 	FORCEINLINE bool HasColor() const { return _Colors.size() > 0; }
 	FORCEINLINE bool HasUV() const { return _UVs.size() > 0; }
@@ -23,7 +23,7 @@ public:
 	std::vector<Vector2>& GetUVs() { return _UVs; }
 	const std::vector<Vector2>& GetUVs() const { return _UVs; }
 
-	// ٿ   Լ
+	// 바운딩 볼륨 관련 함수
 	void CalculateBounds();
 	const Circle& GetCircleBound() const { return _CircleBound; }
 	const Rectangle& GetRectBound() const { return _RectBound; }
@@ -11,10 +11,10 @@ public:
 	TransformComponent() = default;
 
 public:
-	//     Լ
-	void SetPosition(const Vector2& InPosition) { _Position = InPosition; }
-	void AddPosition(const Vector2& InDeltaPosition) { _Position += InDeltaPosition; }
-	void SetScale(const Vector2& InScale) { _Scale = InScale; }
+	// 게임 로직에서 사용할 멤버 함수
+	void SetPosition(const Vector2& InPosition) { _Position = InPosition; ++_Version; }
+	void AddPosition(const Vector2& InDeltaPosition) { _Position += InDeltaPosition; ++_Version; }
+	void SetScale(const Vector2& InScale) { _Scale = InScale; ++_Version; }
 	void SetRotation(float InDegree) { _Rotation = InDegree; Update(); }
 	void AddRotation(float InDegree) { _Rotation += InDegree; Update(); }
 	Vector2 GetPosition() const { return _Position; }
@@ -23,7 +23,10 @@ public:
 	const Vector2& GetLocalX() const { return _Right; }
 	const Vector2& GetLocalY() const { return _Up; }
 
-	//   Լ
+	// 트랜스폼이 바뀔 때마다 증가하는 값. 이전 값과 비교해 변경 여부를 판단한다.
+	UINT32 GetVersion() const { return _Version; }
+
+	// 행렬 생성 함수
 	FORCEINLINE Matrix3x3 GetModelingMatrix() const;
 
 private:
@@ -36,6 +39,7 @@ private:
 
 	Vector2 _Right = Vector2::UnitX;
 	Vector2 _Up = Vector2::UnitY;
+	UINT32 _Version = 0;
 };
 
 FORCEINLINE Matrix3x3 TransformComponent::GetModelingMatrix() const
@@ -54,6 +58,7 @@ FORCEINLINE void TransformComponent::Update()
 
 	_Right = Vector2(cos, sin);
 	_Up = Vector2(-sin, cos);
+	++_Version;
 }
 
 }
@@ -9,47 +9,41 @@ class Bone
 {
 public:
 	Bone() = default;
-	Bone(const std::wstring& InName, const Transform& InTransform) : _Name(InName), _ParentName(InName)
+	Bone(const Name& InName, const Transform& InTransform, int InNodeIndex) : _Name(InName), _NodeIndex(InNodeIndex), _ParentName(InName)
 	{
-		_Hash = std::hash<std::wstring>()(_Name);
 		_BindPose = InTransform;
-		_Transform.SetLocalTransform(InTransform);
+		_InverseBindPoseMatrix = Affine3x4(InTransform.Inverse());
 	}
 
 public:
-	// Ʈ
-	TransformComponent& GetTransform() { return _Transform; }
-	const TransformComponent& GetTransform() const { return _Transform; }
+	// 트랜스폼. 현재 트랜스폼은 메시의 스켈레톤에서 노드 번호로 가져온다.
+	int GetNodeIndex() const { return _NodeIndex; }
 	const Transform& GetBindPose() const { return _BindPose; }
-	void SetParent(Bone& InBone) 
-	{
-		_ParentName = InBone.GetName();
-		_Transform.SetParent(InBone.GetTransform());
-	}
+	const Affine3x4& GetInverseBindPoseMatrix() const { return _InverseBindPoseMatrix; }
+	void SetParentName(const Name& InParentName) { _ParentName = InParentName; }
 
-	// Ű 
-	const std::wstring& GetName() const { return _Name; }
-	std::size_t GetHash() const { return _Hash; }
-	bool HasParent() const { return _Name.compare(_ParentName) != 0; }
-	const std::wstring& GetParentName() const { return _ParentName; }
+	// 키 관련
+	const Name& GetName() const { return _Name; }
+	bool HasParent() const { return _Name != _ParentName; }
+	const Name& GetParentName() const { return _ParentName; }
 
 	const std::size_t GetProperty() const { return _Property; }
 	void SetProperty(const std::size_t& InProperty) { _Property = InProperty; }
 
 private:
-	std::size_t _Hash = 0;
-	std::wstring _Name;
+	Name _Name;
 
-	//  Ʈ 
-	TransformComponent _Transform;
+	// 스켈레톤에서의 노드 번호
+	int _NodeIndex = TransformHierarchy::InvalidIndex;
 
-	//  Ʈ 
+	// 최초 트랜스폼 정보
 	Transform _BindPose;
+	Affine3x4 _InverseBindPoseMatrix;
 
-	// θ 
-	std::wstring _ParentName;
+	// 부모 정보
+	Name _ParentName;
 
-	//  Ӽ
+	// 본 속성
 	// 0x02 : Rotation , 0x04 : Movement , 0x08 : VIS , 0x10 : Enable , 0x20 : IK 
 	std::size_t _Property = 0x02 | 0x08 | 0x10;
 };
@@ -12,18 +12,18 @@ public:
 	~CameraObject() { }
 
 public:
-	// Ʈ
+	// 트랜스폼
 	TransformComponent& GetTransform() { return _Transform; }
 	const TransformComponent& GetTransform() const { return _Transform; }
 	void SetParent(GameObject& InGameObject) { _Transform.SetParent(InGameObject.GetTransform()); }
 
-	// ī޶   Լ
+	// 카메라 값을 가져오는 함수
 	float GetFOV() const { return _FOV; }
 	float GetNearZ() const { return _NearZ; }
 	float GetFarZ() const { return _FarZ; }
 	const ScreenPoint& GetViewportSize() const { return _ViewportSize; }
 
-	// ī޶  ϴ Լ
+	// 카메라 값을 설정하는 함수
 	void SetLookAtRotation(const GameObject& InGameObject, const Vector3& InUp = Vector3::UnitY);
 	void SetLookAtRotation(const Vector3& InTargetPosition, const Vector3& InUp = Vector3::UnitY);
 	void SetFOV(float InFOV) { _FOV = InFOV; }
@@ -31,13 +31,19 @@ public:
 	void SetFarZ(float InFarZ) { _FarZ = InFarZ; }
 	void SetViewportSize(const ScreenPoint& InViewportSize) { _ViewportSize = InViewportSize; }
 
-	//  
+	// 행렬 생성
 	FORCEINLINE void GetViewAxes(Vector3& OutViewX, Vector3& OutViewY, Vector3& OutViewZ) const;
 	FORCEINLINE Matrix4x4 GetViewMatrix() const;
 	FORCEINLINE Matrix4x4 GetViewMatrixRotationOnly() const;
 	FORCEINLINE Matrix4x4 GetPerspectiveMatrix() const;
 	FORCEINLINE Matrix4x4 GetPerspectiveViewMatrix() const;
 
+	// 월드 공간의 절두체 생성
+	FORCEINLINE Frustum GetFrustum() const;
+
+	// 월드 공간의 구가 화면에 투영된 반지름을 화면 높이의 절반에 대한 비율로 계산. 카메라가 구 안에 있으면 INFINITY
+	float GetScreenSize(const Sphere& InWorldSphere) const;
+
 private:
 	TransformComponent _Transform;
 
@@ -49,7 +55,7 @@ private:
 
 FORCEINLINE void CameraObject::GetViewAxes(Vector3& OutViewX, Vector3& OutViewY, Vector3& OutViewZ) const
 {
-	//  Z  ݴ    Z 
+	// 로컬 Z축 값의 반대 방향을 뷰 공간의 Z축으로 설정
 	OutViewZ = -_Transform.GetLocalZ();
 	OutViewY = _Transform.GetLocalY();
 	OutViewX = -_Transform.GetLocalX();
@@ -84,11 +90,11 @@ FORCEINLINE Matrix4x4 CameraObject::GetViewMatrixRotationOnly() const
 
 FORCEINLINE Matrix4x4 CameraObject::GetPerspectiveMatrix() const
 {
-	//  .    -1~1
+	// 투영 행렬. 깊이 값의 범위는 -1~1
 	float invA = 1.f / _ViewportSize.AspectRatio();
-	float d = 1.f / tanf(Math::Deg2Rad(_FOV) * 0.5f);
+	float d = 1.f / Math::Tan(Math::Deg2Rad(_FOV) * 0.5f);
 
-	//  鿡 ݴ ȣ ٿ 
+	// 근평면과 원평면에 반대 부호를 붙여서 계산
 	float invNF = 1.f / (_NearZ - _FarZ);
 	float k = (_FarZ + _NearZ) * invNF;
 	float l = 2.f * _FarZ * _NearZ * invNF;
@@ -101,15 +107,15 @@ FORCEINLINE Matrix4x4 CameraObject::GetPerspectiveMatrix() const
 
 FORCEINLINE Matrix4x4 CameraObject::GetPerspectiveViewMatrix() const
 {
-	//    
+	// 뷰 행렬 관련 요소
 	Vector3 viewX, viewY, viewZ;
 	GetViewAxes(viewX, viewY, viewZ);
 	Vector3 pos = _Transform.GetWorldPosition();
 	float zPos = viewZ.Dot(pos);
 
-	//    
+	// 투영 행렬 관련 요소
 	float invA = 1.f / _ViewportSize.AspectRatio();
-	float d = 1.f / tanf(Math::Deg2Rad(_FOV) * 0.5f);
+	float d = 1.f / Math::Tan(Math::Deg2Rad(_FOV) * 0.5f);
 	float dx = invA * d;
 	float invNF = 1.f / (_NearZ - _FarZ);
 	float k = (_FarZ + _NearZ) * invNF;
@@ -123,6 +129,21 @@ FORCEINLINE Matrix4x4 CameraObject::GetPerspectiveViewMatrix() const
 	);
 }
 
+FORCEINLINE Frustum CameraObject::GetFrustum() const
+{
+	// 원근 뷰 행렬의 행으로부터 월드 공간의 평면의 방정식을 구한다.
+	Matrix4x4 pvTransposedMatrix = GetPerspectiveViewMatrix().Transpose();
+	std::array<Plane, 6> frustumPlanes = {
+		Plane(-(pvTransposedMatrix[3] - pvTransposedMatrix[1])), // up
+		Plane(-(pvTransposedMatrix[3] + pvTransposedMatrix[1])), // bottom
+		Plane(-(pvTransposedMatrix[3] - pvTransposedMatrix[0])), // right
+		Plane(-(pvTransposedMatrix[3] + pvTransposedMatrix[0])), // left 
+		Plane(-(pvTransposedMatrix[3] - pvTransposedMatrix[2])), // far
+		Plane(-(pvTransposedMatrix[3] + pvTransposedMatrix[2])), // near
+	};
+
+	return Frustum(frustumPlanes);
+}
 
 }
 }
\ No newline at end of file
@@ -11,76 +11,98 @@ public:
 	GameEngine() = default;
 
 public:
-	//  ̽
+	// 공용 인터페이스
 	virtual bool Init() override;
 	virtual bool IsInitialized() override { return _IsInitialized; }
 	virtual void OnScreenResize(const ScreenPoint& InScreenSize) override;
 	virtual InputManager& GetInputManager() override { return _InputManager; }
+	virtual void SetJobSystem(JobSystem* InJobSystem) override { _JobSystemPtr = InJobSystem; }
+	virtual JobSystem& GetJobSystem() override { assert(_JobSystemPtr != nullptr); return *_JobSystemPtr; }
 
-	//   뵵 
+	// 게임 로직 용도 
 	const InputManager& GetInputManager() const { return _InputManager; }
 
-	// ҽ 
+	// 리소스 관리
 	Mesh& CreateMesh(const std::size_t& InKey);
 	Texture& CreateTexture(const std::size_t& InKey, const std::string& InTexturePath);
 	Texture& CreateTexture(const std::size_t& InKey, const std::wstring& InTexturePath);
 
-	//  Ʈ
-	const std::vector<std::unique_ptr<GameObject>>& GetScene() const { return _Scene; }
-	std::vector< std::unique_ptr<GameObject>>::const_iterator SceneBegin() const { return _Scene.begin(); }
-	std::vector< std::unique_ptr<GameObject>>::const_iterator SceneEnd() const { return _Scene.end(); }
-	GameObject& CreateNewGameObject(const std::wstring& InName);
-	GameObject& GetGameObject(const std::wstring& InName);
-
-	// ޽
+	// 게임 오브젝트
+	const SlotMap<GameObject>& GetScene() const { return _Scene; }
+	SlotMap<GameObject>::ConstIterator SceneBegin() const { return _Scene.begin(); }
+	SlotMap<GameObject>::ConstIterator SceneEnd() const { return _Scene.end(); }
+	GameObject& CreateNewGameObject(const Name& InName);
+	std::vector<SlotHandle> CreateNewGameObjects(const std::vector<Name>& InNames); // 여러 개를 한 번에 생성. 중복된 이름에는 무효한 핸들을 반환
+	bool DestroyGameObject(const SlotHandle& InHandle);
+	SlotHandle FindGameObject(const Name& InName) const; // 매 프레임 찾는 오브젝트는 핸들을 한 번 구해두고 사용한다.
+	GameObject& GetGameObject(const Name& InName);
+	GameObject& GetGameObject(const SlotHandle& InHandle);
+
+	// 게임 로직이 끝난 후 UpdateWorldTransforms로 오브젝트와 스켈레톤의 월드 트랜스폼을 확정하고,
+	// UpdateSceneTree를 호출해 오브젝트의 월드 바운딩 박스를 씬 트리에 반영한다.
+	void UpdateWorldTransforms();
+	void UpdateSceneTree();
+	FORCEINLINE const DynamicBoxTree& GetSceneTree() const { return _SceneTree; }
+
+	// 메시
 	Mesh& GetMesh(const std::size_t& InMeshKey) { return *_Meshes.at(InMeshKey).get(); }
 	const Mesh& GetMesh(const std::size_t& InMeshKey) const { return *_Meshes.at(InMeshKey).get(); }
 
-	// ī޶ 
+	// 카메라 
 	FORCEINLINE CameraObject& GetMainCamera() { return _MainCamera; }
 	FORCEINLINE const CameraObject& GetMainCamera() const { return _MainCamera; }
 
-	//  ؽó
+	// 메인 텍스처
 	FORCEINLINE const Texture& GetTexture(const std::size_t& InTextureKey) const { return *_Textures.at(InTextureKey).get(); }
 
-	//  ׸  
-	std::unordered_map<std::wstring, GameObject*> GetBoneObjectPtrs() { return _BoneGameObjectPtrs; }
+	// 본을 그리기 위한 목록
+	std::unordered_map<Name, GameObject*>& GetBoneObjectPtrs() { return _BoneGameObjectPtrs; }
+	const std::unordered_map<Name, GameObject*>& GetBoneObjectPtrs() const { return _BoneGameObjectPtrs; }
 
 private:
 	bool LoadResources();
-
-public: // ֿ Ű 
-	// 
-	static const std::wstring RootBone;
-	static const std::wstring PelvisBone;
-	static const std::wstring SpineBone;
-	static const std::wstring LeftArmBone;
-	static const std::wstring RightArmBone;
-	static const std::wstring NeckBone;
-	static const std::wstring LeftLegBone;
-	static const std::wstring RightLegBone;
-
-	// ޽
+	SlotHandle AddGameObject(const Name& InName);
+
+public: // 주요 키 값
+	// 본
+	static const Name RootBone;
+	static const Name PelvisBone;
+	static const Name SpineBone;
+	static const Name LeftArmBone;
+	static const Name RightArmBone;
+	static const Name NeckBone;
+	static const Name LeftLegBone;
+	static const Name RightLegBone;
+
+	// 메시
 	static const std::size_t CharacterMesh;
 	static const std::size_t ArrowMesh;
 	static const std::size_t PlaneMesh;
 
-	// ؽó
+	// 텍스처
 	static const std::size_t BaseTexture;
 	static const std::wstring CharacterTexturePath;
 
 	static const std::wstring MMDCharacterPath;
+
+	// 월드 트랜스폼 갱신에서 작업 하나가 맡을 루트 오브젝트의 수
+	static constexpr size_t RootTransformGrainSize = 64;
 private:
 	bool _IsInitialized = false;
 
 	ScreenPoint _ScreenSize;
 	InputManager _InputManager;
+	JobSystem* _JobSystemPtr = nullptr;
 	CameraObject _MainCamera;
 
-	std::vector<std::unique_ptr<GameObject>> _Scene;
+	SlotMap<GameObject> _Scene;
+	std::unordered_map<Name, SlotHandle> _SceneIndex; // 이름으로 핸들을 찾기 위한 목록
+	DynamicBoxTree _SceneTree;
+	std::vector<const TransformComponent*> _RootTransforms; // 월드 트랜스폼 갱신에 사용하는 임시 목록
+	std::vector<TransformHierarchy*> _Skeletons;
 	std::unordered_map<std::size_t, std::unique_ptr<Mesh>> _Meshes;
 	std::unordered_map<std::size_t, std::unique_ptr<Texture>> _Textures;
-	std::unordered_map<std::wstring, GameObject*> _BoneGameObjectPtrs;
+	std::unordered_map<Name, GameObject*> _BoneGameObjectPtrs;
 };
 
 }
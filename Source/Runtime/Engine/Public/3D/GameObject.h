@@ -8,51 +8,65 @@ namespace DDD
 class GameObject
 {
 public:
-	GameObject(const std::wstring& InName) : _Name(InName)
-	{
-		_Hash = std::hash<std::wstring>()(_Name);
-	}
+	explicit GameObject(const Name& InName) : _Name(InName) { }
 
 	~GameObject() {}
 
 public:
-	// 
+	// 종류
 	void SetGameObjectType(const GameObjectType& _InGameObjectType) { _GameObjectType = _InGameObjectType; }
 	FORCEINLINE bool IsGizmoObject() const { return _GameObjectType == GameObjectType::Gizmo; }
 
-	// Ʈ
+	// 트랜스폼
 	TransformComponent& GetTransform() { return _Transform; }
 	const TransformComponent& GetTransform() const { return _Transform; }
 	void SetParent(GameObject& InGameObject) { _Transform.SetParent(InGameObject.GetTransform()); }
 
-	// ޽
+	// 메시
 	void SetMesh(const std::size_t& InMeshKey) { _MeshKey = InMeshKey; }
 	bool HasMesh() const { return _MeshKey != Math::InvalidHash; }
 	FORCEINLINE std::size_t GetMeshKey() const { return _MeshKey; }
 
-	// 
+	// 색상
 	void SetColor(const LinearColor& InColor) { _Color = InColor; }
 	FORCEINLINE const LinearColor& GetColor() const { return _Color; }
 
-	// Ű 
-	const std::wstring& GetName() const { return _Name; }
-	std::size_t GetHash() const { return _Hash; }
+	// 키 관련
+	const Name& GetName() const { return _Name; }
 
-	// ˻ 
-	bool IsValid() const { return _Hash != Math::InvalidHash; }
+	// 게임 엔진에서 발급한 핸들
+	const SlotHandle& GetHandle() const { return _Handle; }
+	void SetHandle(const SlotHandle& InHandle) { _Handle = InHandle; }
+
+	// 검색 관련
+	bool IsValid() const { return !_Name.IsNone(); }
 	FORCEINLINE bool operator==(const GameObject& InGameObject) const;
 	FORCEINLINE bool operator!=(const GameObject& InGameObject) const;
 	static GameObject Invalid;
 
-	//  
+	// 렌더링 설정
 	bool IsVisible() const { return _IsVisible; }
 	void SetVisible(bool InVisible) { _IsVisible = InVisible; }
 
+	// 절두체 컬링에서 마지막으로 밖으로 판정한 평면. 렌더링 중에 갱신되는 값이다.
+	BYTE GetFrustumPlaneHint() const { return _FrustumPlaneHint; }
+	void SetFrustumPlaneHint(BYTE InPlaneIndex) const { _FrustumPlaneHint = InPlaneIndex; }
+
+	// 씬 트리에 등록된 번호와 등록할 때의 트랜스폼 버전 및 메시. 게임 엔진이 관리한다.
+	int GetSceneProxy() const { return _SceneProxy; }
+	UINT32 GetSceneProxyVersion() const { return _SceneProxyVersion; }
+	std::size_t GetSceneProxyMeshKey() const { return _SceneProxyMeshKey; }
+	void SetSceneProxy(int InProxy, UINT32 InVersion, std::size_t InMeshKey) { _SceneProxy = InProxy; _SceneProxyVersion = InVersion; _SceneProxyMeshKey = InMeshKey; }
+
 private:
 	GameObjectType _GameObjectType = GameObjectType::Normal;
 	bool _IsVisible = true;
-	std::size_t _Hash = Math::InvalidHash;
-	std::wstring _Name;
+	mutable BYTE _FrustumPlaneHint = 0;
+	int _SceneProxy = DynamicBoxTree::InvalidIndex;
+	UINT32 _SceneProxyVersion = 0;
+	std::size_t _SceneProxyMeshKey = Math::InvalidHash;
+	SlotHandle _Handle;
+	Name _Name;
 	std::size_t _MeshKey = Math::InvalidHash;
 	TransformComponent _Transform;
 	LinearColor _Color = LinearColor::Error;
@@ -60,12 +74,12 @@ private:
 
 FORCEINLINE bool GameObject::operator==(const GameObject& InGameObject) const
 {
-	return _Hash == InGameObject.GetHash();
+	return _Name == InGameObject.GetName();
 }
 
 FORCEINLINE bool GameObject::operator!=(const GameObject& InGameObject) const
 {
-	return _Hash != InGameObject.GetHash();
+	return _Name != InGameObject.GetName();
 }
 
 
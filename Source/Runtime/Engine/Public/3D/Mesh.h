@@ -7,7 +7,7 @@ namespace DDD
 
 struct Weight
 {
-	std::vector<std::wstring> Bones;
+	std::vector<Name> Bones;
 	std::vector<float> Values;
 };
 struct TexturesIndice
@@ -27,12 +27,21 @@ struct TexturesIndice
 	size_t EndIndex;
 };
 
+// 간략화한 메시의 한 단계. 정점 속성은 원본 메시의 것을 정점 번호로 참조한다.
+struct MeshLOD
+{
+	std::vector<size_t> Vertices; // LOD의 정점마다 원본 메시의 정점 번호
+	std::vector<size_t> Indices; // LOD의 정점 번호로 구성한 인덱스 버퍼
+	std::vector<TexturesIndice> TextureIndices;
+	float ScreenSize = 0.f; // 화면 크기가 이 값보다 작으면 사용
+};
+
 class Mesh
 {
 public:
 	Mesh() = default;
 
-	// Ӽ  Լ
+	// 속성 관련 함수
 	void SetMeshType(const MeshType& _InMeshType) { _MeshType = _InMeshType; }
 	FORCEINLINE bool HasColor() const { return _Colors.size() > 0; }
 	FORCEINLINE bool HasUV() const { return _UVs.size() > 0; }
@@ -47,14 +56,21 @@ public:
 	std::vector<TexturesIndice>& GetTextureIndices() { return _TextureIndices; }
 	const std::vector<TexturesIndice>& GetTextureIndices() const { return _TextureIndices; }
 
-	// ٿ   Լ
+	// 바운딩 볼륨 관련 함수
 	void CalculateBounds();
 	const Sphere& GetSphereBound() const { return _SphereBound; }
 	const Box& GetBoxBound() const { return _BoxBound; }
 
-	// ̷Ż ִϸ̼  Լ
+	// LOD 관련 함수. 0번 LOD는 원본 메시이며 GetLOD에는 1번부터 사용한다.
+	// 화면 크기는 CameraObject::GetScreenSize의 값으로, 삼각형 수가 화면에 차지하는 면적에 비례하도록 LOD를 고른다.
+	void BuildLODs(size_t InMaxLODCount = DefaultLODCount);
+	FORCEINLINE size_t GetLODCount() const { return _LODs.size() + 1; }
+	FORCEINLINE const MeshLOD& GetLOD(size_t InLODIndex) const { assert(InLODIndex > 0 && InLODIndex <= _LODs.size()); return _LODs[InLODIndex - 1]; }
+	size_t SelectLOD(float InScreenSize) const;
+
+	// 스켈레탈 애니메이션 관련 함수
 	FORCEINLINE bool IsSkinnedMesh() const { return _MeshType == MeshType::Skinned; }
-	FORCEINLINE bool HasBone(const std::wstring& InBoneName) const { return _Bones.find(InBoneName) != _Bones.end(); }
+	FORCEINLINE bool HasBone(const Name& InBoneName) const { return _Bones.find(InBoneName) != _Bones.end(); }
 
 	std::vector<Weight>& GetWeights() { return _Weights; }
 	const std::vector<Weight>& GetWeights() const { return _Weights; }
@@ -62,11 +78,27 @@ public:
 	std::vector<BYTE>& GetConnectedBones() { return _ConnectedBones; }
 	const std::vector<BYTE>& GetConnectedBones() const { return _ConnectedBones; }
 
-	Bone& GetBone(const std::wstring& InBoneName) { return _Bones.at(InBoneName); }
-	const Bone& GetBone(const std::wstring& InBoneName) const { return _Bones.at(InBoneName); }
-	std::unordered_map<std::wstring, Bone>& GetBones() { return _Bones; }
-	const std::unordered_map<std::wstring, Bone>& GetBones() const { return _Bones; }
-	const Transform& GetBindPose(const std::wstring& InBoneName) const { return _Bones.at(InBoneName).GetBindPose(); }
+	// 매 프레임 찾는 본은 이름을 미리 만들어두고 사용하거나, 본의 노드 번호로 스켈레톤에 직접 접근한다.
+	Bone& GetBone(const Name& InBoneName) { return _Bones.at(InBoneName); }
+	const Bone& GetBone(const Name& InBoneName) const { return _Bones.at(InBoneName); }
+	int FindBoneNode(const Name& InBoneName) const; // 없으면 TransformHierarchy::InvalidIndex
+	std::unordered_map<Name, Bone>& GetBones() { return _Bones; }
+	const std::unordered_map<Name, Bone>& GetBones() const { return _Bones; }
+	const Transform& GetBindPose(const Name& InBoneName) const { return _Bones.at(InBoneName).GetBindPose(); }
+
+	// 본을 추가하고 스켈레톤에 노드를 만든다. 바인드 포즈는 모델링 공간의 트랜스폼이며 부모 본은 먼저 추가되어 있어야 한다.
+	Bone& AddBone(const Name& InBoneName, const Transform& InBindPose, const Name& InParentBoneName = Name::None);
+
+	// 본의 현재 트랜스폼을 저장하는 스켈레톤. 로컬 트랜스폼을 바꾼 후 UpdateWorld를 호출한다.
+	TransformHierarchy& GetSkeleton() { return _Skeleton; }
+	const TransformHierarchy& GetSkeleton() const { return _Skeleton; }
+
+	// 정적멤버변수
+	static constexpr size_t DefaultLODCount = 4; // 원본을 포함한 LOD 수
+	static constexpr float LODTriangleRatio = 0.5f; // 단계마다 줄일 삼각형의 비율
+	static constexpr float LODMinReduction = 0.8f; // 이전 단계보다 삼각형이 이 비율 이하로 줄지 않으면 LOD를 더 만들지 않는다.
+	static constexpr size_t LODMinTriangleCount = 64;
+	static constexpr float FullDetailScreenSize = 0.5f; // 원본 메시를 사용하는 최소 화면 크기
 
 private:
 	std::vector<Vector3> _Vertices;
@@ -77,7 +109,9 @@ private:
 
 	std::vector<BYTE> _ConnectedBones;
 	std::vector<Weight> _Weights;
-	std::unordered_map<std::wstring, Bone> _Bones;
+	std::unordered_map<Name, Bone> _Bones;
+	TransformHierarchy _Skeleton;
+	std::vector<MeshLOD> _LODs;
 
 private:
 	MeshType _MeshType = MeshType::Normal;
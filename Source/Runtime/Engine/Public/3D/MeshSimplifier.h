@@ -0,0 +1,37 @@
+#pragma once
+
+namespace CK
+{
+namespace DDD
+{
+
+// 이차 오차 행렬(QEM)을 사용해 삼각형 수를 줄이는 클래스.
+// 정점을 이웃한 기존 정점으로 합치는 방식만 사용하므로 남은 정점의 UV와 본 가중치는 원본 그대로 유지된다.
+// 위치가 같은 다른 정점이 있는 정점(UV 이음새, 재질 경계)은 움직이지 않고, 열린 가장자리의 정점은 가장자리를 따라서만 합친다.
+class MeshSimplifier
+{
+public:
+	// InFrom 정점을 InTo 정점으로 합쳐도 되는지 판단하는 함수
+	using CollapseFilter = std::function<bool(size_t InFrom, size_t InTo)>;
+
+	// 생성자
+	MeshSimplifier(const std::vector<Vector3>& InPositions, const std::vector<size_t>& InIndices);
+
+public:
+	// 멤버함수
+	void SetCollapseFilter(CollapseFilter InFilter) { _Filter = std::move(InFilter); }
+
+	// 삼각형 수가 InTargetTriangleCount 이하가 되도록 간략화한 인덱스 버퍼를 만든다. 원본 삼각형의 순서는 유지된다.
+	// OutTriangleSources에는 남은 삼각형마다 원본 삼각형의 번호를 기록한다. 반환 값은 남은 삼각형의 수
+	size_t Simplify(size_t InTargetTriangleCount, std::vector<size_t>& OutIndices, std::vector<size_t>& OutTriangleSources) const;
+
+	FORCEINLINE size_t GetTriangleCount() const { return _Indices.size() / 3; }
+
+private:
+	const std::vector<Vector3>& _Positions;
+	const std::vector<size_t>& _Indices;
+	CollapseFilter _Filter;
+};
+
+}
+}
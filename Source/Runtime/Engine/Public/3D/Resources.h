@@ -6,7 +6,7 @@ namespace DDD
 {
 
 /// <summary>
-/// ť ޽ 
+/// 큐브 메시 정보
 /// </summary>
 
 constexpr static std::array<Vector3, 24> cubeMeshPositions = {
@@ -28,7 +28,7 @@ constexpr static std::array<size_t, 36> cubeMeshIndice = {
 };
 
 /// <summary>
-/// ȭǥ ޽ 
+/// 화살표 메시 정보
 /// </summary>
 
 constexpr static std::array<Vector3, 29> arrowPositions = {
@@ -58,5 +58,48 @@ constexpr static std::array<size_t, 54> arrowIndice = {
 	24, 28, 27, 24, 25, 28, 25, 26, 28, 26, 27, 28
 };
 
+/// <summary>
+/// 바닥 메시 정보 (기즈모 용). 격자는 컴파일 타임에 생성
+/// </summary>
+
+constexpr static int planeHalfSize = 3;
+constexpr static size_t planeSideVertexCount = planeHalfSize * 2 + 1;
+
+constexpr std::array<Vector3, planeSideVertexCount * planeSideVertexCount> MakePlanePositions()
+{
+	std::array<Vector3, planeSideVertexCount * planeSideVertexCount> result{};
+	size_t index = 0;
+	for (int z = -planeHalfSize; z <= planeHalfSize; z++)
+	{
+		for (int x = -planeHalfSize; x <= planeHalfSize; x++)
+		{
+			result[index++] = Vector3((float)x, 0.f, (float)z);
+		}
+	}
+	return result;
+}
+
+constexpr std::array<size_t, planeHalfSize * planeHalfSize * 4 * 6> MakePlaneIndice()
+{
+	std::array<size_t, planeHalfSize * planeHalfSize * 4 * 6> result{};
+	size_t index = 0;
+	for (int tx = 0; tx < planeHalfSize * 2; tx++)
+	{
+		for (int ty = 0; ty < planeHalfSize * 2; ty++)
+		{
+			size_t v0 = tx + planeSideVertexCount * (ty + 1);
+			size_t v1 = tx + planeSideVertexCount * ty;
+			size_t v2 = v1 + 1;
+			size_t v3 = v0 + 1;
+			result[index++] = v0; result[index++] = v2; result[index++] = v1;
+			result[index++] = v0; result[index++] = v3; result[index++] = v2;
+		}
+	}
+	return result;
+}
+
+constexpr static std::array<Vector3, planeSideVertexCount * planeSideVertexCount> planePositions = MakePlanePositions();
+constexpr static std::array<size_t, planeHalfSize * planeHalfSize * 4 * 6> planeIndice = MakePlaneIndice();
+
+}
 }
-}
\ No newline at end of file
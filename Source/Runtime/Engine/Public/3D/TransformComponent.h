@@ -9,14 +9,11 @@ class TransformComponent
 {
 public:
 	TransformComponent() = default;
-	TransformComponent(const Transform& InLocalTransform) : _LocalTransform(InLocalTransform) 
-	{ 
-		UpdateWorld(); 
-	}
+	TransformComponent(const Transform& InLocalTransform) : _LocalTransform(InLocalTransform) { }
 
-public: //  Ʈ  Լ
+public: // 로컬 트랜스폼 관련 함수
 	FORCEINLINE Transform& GetLocalTransform() { return _LocalTransform; }
-	FORCEINLINE void SetLocalTransform(const Transform& InTransform) { _LocalTransform = InTransform; UpdateWorld(); }
+	FORCEINLINE void SetLocalTransform(const Transform& InTransform) { _LocalTransform = InTransform; MarkWorldDirty(); }
 	FORCEINLINE const Transform& GetLocalTransform() const { return _LocalTransform; }
 
 	FORCEINLINE void SetLocalPosition(const Vector3& InPosition);
@@ -39,10 +36,10 @@ public: // 
 	FORCEINLINE Vector3 GetLocalZ() const { return _LocalTransform.GetZAxis(); }
 	FORCEINLINE Matrix4x4 GetLocalMatrix() const { return _LocalTransform.GetMatrix(); }
 
-public: //  Ʈ  Լ
-	FORCEINLINE Transform& GetWorldTransform() { return _WorldTransform; }
+public: // 월드 트랜스폼 관련 함수
+	FORCEINLINE Transform& GetWorldTransform() { UpdateWorldIfDirty(); return _WorldTransform; }
 	FORCEINLINE void SetWorldTransform(const Transform& InTransform) { _WorldTransform = InTransform; UpdateLocal(); }
-	FORCEINLINE const Transform& GetWorldTransform() const { return _WorldTransform; }
+	FORCEINLINE const Transform& GetWorldTransform() const { UpdateWorldIfDirty(); return _WorldTransform; }
 
 	FORCEINLINE void SetWorldPosition(const Vector3& InPosition);
 	FORCEINLINE void AddWorldPosition(const Vector3& InDeltaPosition);
@@ -54,33 +51,45 @@ public: // 
 	FORCEINLINE void SetWorldRotation(const Quaternion& InQuaternion);
 	FORCEINLINE void SetWorldScale(const Vector3& InScale);
 
-	FORCEINLINE Vector3 GetWorldPosition() const { return _WorldTransform.GetPosition(); }
-	FORCEINLINE Rotator GetWorldRotator() const { return _WorldTransform.GetRotation().ToRotator(); }
-	FORCEINLINE Quaternion GetWorldRotation() const { return _WorldTransform.GetRotation(); }
-	FORCEINLINE Vector3 GetWorldScale() const { return _WorldTransform.GetScale(); }
+	FORCEINLINE Vector3 GetWorldPosition() const { return GetWorldTransform().GetPosition(); }
+	FORCEINLINE Rotator GetWorldRotator() const { return GetWorldTransform().GetRotation().ToRotator(); }
+	FORCEINLINE Quaternion GetWorldRotation() const { return GetWorldTransform().GetRotation(); }
+	FORCEINLINE Vector3 GetWorldScale() const { return GetWorldTransform().GetScale(); }
 
-	FORCEINLINE Matrix4x4 GetWorldMatrix() const { return _WorldTransform.GetMatrix(); }
+	// 월드 행렬은 월드 트랜스폼을 다시 계산할 때 함께 계산해둔 값을 사용
+	FORCEINLINE Matrix4x4 GetWorldMatrix() const { return GetWorldAffine().ToMatrix4x4(); }
+	FORCEINLINE const Affine3x4& GetWorldAffine() const { UpdateWorldIfDirty(); return _WorldMatrix; }
 
-public: //    Լ
+	// 월드 트랜스폼이 다시 계산될 때마다 증가하는 값. 이전 값과 비교해 변경 여부를 판단한다.
+	FORCEINLINE UINT32 GetWorldVersion() const { UpdateWorldIfDirty(); return _WorldVersion; }
+
+public: // 계층 구조 관련 함수
 	bool SetRoot();
 	bool RemoveFromParent();
 	TransformComponent& GetRoot();
 	bool SetParent(TransformComponent& InTransform);
+	void UpdateSubtreeWorld() const; // 자신과 자손의 월드 정보를 모두 확정. 서로 다른 서브트리는 동시에 호출해도 된다.
 
 	FORCEINLINE bool HasParent() const { return _ParentPtr != nullptr; }
 	std::vector<TransformComponent*>& GetChildren() { return _ChildrenPtr; }
 	std::vector<TransformComponent*>::const_iterator ChildBegin() const { return _ChildrenPtr.begin(); }
 	std::vector<TransformComponent*>::const_iterator ChildEnd() const { return _ChildrenPtr.end(); }
 
-private: // ο ȣϴ Լ
+private: // 내부에서만 호출하는 함수
 	FORCEINLINE TransformComponent* GetParentPtr() const { return _ParentPtr; }
 	void UpdateLocal();
-	void UpdateWorld();
-	void UpdateChildrenWorld();
+	void MarkWorldDirty();
+	FORCEINLINE void UpdateWorldIfDirty() const { if (_IsWorldDirty) { UpdateWorld(); } }
+	void UpdateWorld() const;
 
-private: //    
+private: // 계층 구조를 위한 변수
+	// 로컬 정보가 바뀌면 자신과 자손을 갱신 필요 상태로 표시하고, 월드 정보는 처음 읽을 때 한 번만 다시 계산한다.
+	// 갱신 필요 상태인 노드의 자손은 항상 갱신 필요 상태이다.
 	Transform _LocalTransform;
-	Transform _WorldTransform;
+	mutable Transform _WorldTransform;
+	mutable Affine3x4 _WorldMatrix;
+	mutable UINT32 _WorldVersion = 0;
+	mutable bool _IsWorldDirty = true;
 
 	TransformComponent* _ParentPtr = nullptr;
 	std::vector<TransformComponent*> _ChildrenPtr;
@@ -90,107 +99,116 @@ private: // 
 FORCEINLINE void TransformComponent::SetLocalPosition(const Vector3& InPosition)
 {
 	_LocalTransform.SetPosition(InPosition);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::AddLocalPosition(const Vector3& InDeltaPosition)
 {
 	_LocalTransform.AddPosition(InDeltaPosition);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::AddLocalYawRotation(float InDegree)
 {
 	_LocalTransform.AddYawRotation(InDegree);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::AddLocalRollRotation(float InDegree)
 {
 	_LocalTransform.AddRollRotation(InDegree);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::AddLocalPitchRotation(float InDegree)
 {
 	_LocalTransform.AddPitchRotation(InDegree);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::SetLocalRotation(const Rotator& InRotator)
 {
 	_LocalTransform.SetRotation(InRotator);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::SetLocalRotation(const Matrix3x3& InMatrix)
 {
 	_LocalTransform.SetRotation(InMatrix);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::SetLocalRotation(const Quaternion& InQuaternion)
 {
 	_LocalTransform.SetRotation(InQuaternion);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::SetLocalScale(const Vector3& InScale)
 {
 	_LocalTransform.SetScale(InScale);
-	UpdateWorld();
+	MarkWorldDirty();
 }
 
 FORCEINLINE void TransformComponent::SetWorldPosition(const Vector3& InPosition)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.SetPosition(InPosition);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::AddWorldPosition(const Vector3& InDeltaPosition)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.AddPosition(InDeltaPosition);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::AddWorldYawRotation(float InDegree)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.AddYawRotation(InDegree);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::AddWorldRollRotation(float InDegree)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.AddRollRotation(InDegree);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::AddWorldPitchRotation(float InDegree)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.AddPitchRotation(InDegree);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::SetWorldRotation(const Rotator& InRotator)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.SetRotation(InRotator);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::SetWorldRotation(const Matrix3x3& InMatrix)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.SetRotation(InMatrix);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::SetWorldRotation(const Quaternion& InQuaternion)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.SetRotation(InQuaternion);
 	UpdateLocal();
 }
 
 FORCEINLINE void TransformComponent::SetWorldScale(const Vector3& InScale)
 {
+	UpdateWorldIfDirty();
 	_WorldTransform.SetScale(InScale);
 	UpdateLocal();
 }
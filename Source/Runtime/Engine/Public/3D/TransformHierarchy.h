@@ -0,0 +1,80 @@
+#pragma once
+
+namespace CK
+{
+namespace DDD
+{
+
+// 트랜스폼 계층 구조를 성분별 배열(SoA)로 저장하는 클래스.
+// 노드는 항상 부모 뒤에 추가되므로 배열 순서대로 한 번 순회하면 모든 노드의 월드 트랜스폼이 계산된다.
+// 로컬 트랜스폼을 바꾼 노드는 표시해두고, 순회할 때 표시된 노드와 그 자손만 다시 계산한다.
+// 같은 깊이의 노드는 서로 영향을 주지 않으므로 노드가 많으면 깊이 단위로 나누어 여러 스레드에서 계산한다.
+class TransformHierarchy
+{
+public:
+	// 생성자
+	TransformHierarchy() = default;
+
+public:
+	// 멤버함수
+	int AddNode(const Transform& InLocalTransform, int InParentIndex = InvalidIndex); // 부모 노드는 먼저 추가되어 있어야 한다.
+	void Reserve(size_t InCount);
+	void Clear();
+	void UpdateWorld(JobSystem* InJobSystem = nullptr); // 로컬 트랜스폼이 바뀐 노드와 그 자손의 월드 정보를 다시 계산
+
+	FORCEINLINE size_t GetNodeCount() const { return _Parents.size(); }
+	FORCEINLINE int GetParentIndex(int InIndex) const { assert(IsValidIndex(InIndex)); return _Parents[InIndex]; }
+	FORCEINLINE bool IsValidIndex(int InIndex) const { return InIndex >= 0 && InIndex < static_cast<int>(_Parents.size()); }
+
+	// 로컬 트랜스폼 관련 함수
+	FORCEINLINE Transform GetLocalTransform(int InIndex) const { assert(IsValidIndex(InIndex)); return Transform(_LocalPositions[InIndex], _LocalRotations[InIndex], _LocalScales[InIndex]); }
+	FORCEINLINE void SetLocalTransform(int InIndex, const Transform& InTransform);
+	FORCEINLINE void SetLocalPosition(int InIndex, const Vector3& InPosition) { assert(IsValidIndex(InIndex)); _LocalPositions[InIndex] = InPosition; MarkDirty(InIndex); }
+	FORCEINLINE void SetLocalRotation(int InIndex, const Quaternion& InQuaternion) { assert(IsValidIndex(InIndex)); _LocalRotations[InIndex] = InQuaternion; MarkDirty(InIndex); }
+	FORCEINLINE void SetLocalRotation(int InIndex, const Rotator& InRotator) { SetLocalRotation(InIndex, Quaternion(InRotator)); }
+	FORCEINLINE void SetLocalScale(int InIndex, const Vector3& InScale) { assert(IsValidIndex(InIndex)); _LocalScales[InIndex] = InScale; MarkDirty(InIndex); }
+
+	// 월드 트랜스폼 관련 함수. UpdateWorld를 호출한 시점의 값이다.
+	FORCEINLINE Transform GetWorldTransform(int InIndex) const { assert(IsValidIndex(InIndex)); return Transform(_WorldPositions[InIndex], _WorldRotations[InIndex], _WorldScales[InIndex]); }
+	FORCEINLINE const Vector3& GetWorldPosition(int InIndex) const { assert(IsValidIndex(InIndex)); return _WorldPositions[InIndex]; }
+	FORCEINLINE const Affine3x4& GetWorldAffine(int InIndex) const { assert(IsValidIndex(InIndex)); return _WorldMatrices[InIndex]; }
+	FORCEINLINE const std::vector<Affine3x4>& GetWorldAffines() const { return _WorldMatrices; }
+
+	// 정적멤버변수
+	static constexpr int InvalidIndex = -1;
+	static constexpr size_t ParallelGrainSize = 256; // 작업 하나가 계산할 노드의 수. 이보다 작은 계층은 나누지 않는다.
+
+private:
+	FORCEINLINE void MarkDirty(int InIndex) { _IsDirty[InIndex] = true; _HasDirtyNode = true; }
+	void UpdateNode(int InIndex);
+
+private:
+	// 멤버변수
+	std::vector<int> _Parents;
+	std::vector<int> _Depths;
+	std::vector<std::vector<int>> _Levels; // 깊이별 노드 목록
+
+	std::vector<Vector3> _LocalPositions;
+	std::vector<Quaternion> _LocalRotations;
+	std::vector<Vector3> _LocalScales;
+
+	std::vector<Vector3> _WorldPositions;
+	std::vector<Quaternion> _WorldRotations;
+	std::vector<Vector3> _WorldScales;
+	std::vector<Affine3x4> _WorldMatrices;
+
+	std::vector<BYTE> _IsDirty;
+	bool _HasDirtyNode = false;
+};
+
+FORCEINLINE void TransformHierarchy::SetLocalTransform(int InIndex, const Transform& InTransform)
+{
+	assert(IsValidIndex(InIndex));
+	_LocalPositions[InIndex] = InTransform.GetPosition();
+	_LocalRotations[InIndex] = InTransform.GetRotation();
+	_LocalScales[InIndex] = InTransform.GetScale();
+	MarkDirty(InIndex);
+}
+
+}
+}
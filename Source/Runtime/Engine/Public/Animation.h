@@ -2,26 +2,26 @@
 
 namespace CK
 {
-// Ű 
+// 키프레임 정의
 template<typename TValue>
 struct Keyframe {
-	float Time;		// ð
-	float Tangent;	// źƮ()
-	TValue Value;	// 
+	float Time;		// 시간
+	float Tangent;	// 탄젠트(기울기)
+	TValue Value;	// 값
 
-	// toκ  y1 س Լ
+	// to로부터의 상대 y1값을 도출해내는 함수
 	float GetDeltaValue(const Keyframe<TValue>& to) {
 		const auto& from = *this;
 		return to.Value - from.Value;
 	}
-	//  y ϴ Լ
+	// 상대 y값을 적용하는 함수
 	TValue GetValue(float value, const Keyframe<TValue>& to) {
 		const auto& from = *this;
 		return from.Value + value;
 	}
 };
 
-// float  νϽȭ ( ٸ   )
+// float에 대해 인스턴스화 (사실 다른 건 없음 ㅎ)
 template<>
 struct Keyframe<float> {
 	float Time;
@@ -37,18 +37,18 @@ struct Keyframe<float> {
 	}
 };
 
-// Vector3  νϽȭ
+// Vector3에 대해 인스턴스화
 template<>
 struct Keyframe<Vector3> {
 	float Time;
 	float Tangent;
 	Vector3 Value;
-	// Ÿ  y1 
+	// 거리를 통해 y1 산출
 	float GetDeltaValue(const Keyframe<Vector3>& to) {
 		const auto& from = *this;
 		return (to.Value - from.Value).Size();
 	}
-	// (to-from)   y 
+	// (to-from) 방향을 기준으로 y값 적용
 	Vector3 GetValue(float value, const Keyframe<Vector3>& to) {
 		const auto& from = *this;
 		auto fromTo = (to.Value - from.Value);
@@ -57,20 +57,20 @@ struct Keyframe<Vector3> {
 	}
 };
 
-// Quaternion  νϽȭ
+// Quaternion에 대해 인스턴스화
 template<>
 struct Keyframe<Quaternion> {
 	float Time;
 	float Tangent;
 	Quaternion Value;
 
-	//  arccos  հ ϱ
+	// 내적의 arccos를 통해 사잇각 구하기
 	float GetDeltaValue(const Keyframe<Quaternion>& to) {
 		const auto& from = *this;
 		float angleInRadian = to.Value.Angle(from.Value);
 		return angleInRadian;
 	}
-	// [0, 1]  ȭؼ Slerp y 
+	// [0, 1] 구간으로 정규화해서 Slerp로 y값 적용
 	Quaternion GetValue(float value, const Keyframe<Quaternion>& to) {
 		const auto& from = *this;
 		float angleInRadian = to.Value.Angle(from.Value);
@@ -78,12 +78,12 @@ struct Keyframe<Quaternion> {
 	}
 };
 
-// Լ   ŷ
+// 삼차함수의 각 계수 베이킹
 struct KeyframeCalculation {
 	float a, b, c;
-	// d = 0̹Ƿ 
+	// d = 0이므로 생략
 
-	// x  Լ  (ax^3 + bx^2 + cx)
+	// x값에 대해 함수 계산 (ax^3 + bx^2 + cx)
 	float Calculate(float InX) {
 		float square = InX * InX;
 		float cubic = square * InX;
@@ -91,7 +91,7 @@ struct KeyframeCalculation {
 	}
 };
 
-// ִϸ̼ Ŀ,  Ű 
+// 애니메이션 커브, 여러 키프레임으로 구성
 template<typename TValue>
 class AnimationCurve {
 public:
@@ -104,17 +104,17 @@ public:
 		Calculate();
 	}
 
-	//   ̻ ŷ
+	// 사전에 프레임 사이사이 베이킹
 	void Calculate() {
 		auto frameCount = _Keyframes.size();
 		if (frameCount == 0) return;
 		if (frameCount == 1) return; 
-		// ð 
+		// 시간순 정렬
 		std::sort(_Keyframes.begin(), _Keyframes.end(), [&](Keyframe a, Keyframe b) -> bool {
 			return a.Time < b.Time;
 		});
 
-		// Լ  ŷ
+		// 삼차함수 곡선 베이킹
 		_KeyframeCalculation.reserve(frameCount - 1);
 		_KeyframeCalculation.clear();
 		for (int currentIndex = 0; currentIndex < frameCount - 1; ++currentIndex) {
@@ -148,8 +148,8 @@ private:
 	std::vector<KeyframeCalculation> _KeyframeCalculation;
 };
 
-//  ִϸ̼   ϴ 
-// AnimationCurve ۷ 
+// 실제로 애니메이션을 적용할 때 사용하는 세션
+// AnimationCurve를 레퍼런스로 가짐
 template<typename TValue>
 class AnimationSession {
 public:
@@ -177,35 +177,35 @@ public:
 	bool IsLooping() const { return _IsLooping; }
 	void SetLooping(bool InIsLooping) const { _IsLooping = InIsLooping; }
 
-	//   ȣǾ ִϸ̼ 
+	// 매 프레임 호출되어 애니메이션 진행
 	TValue Next(float InDeltaTime) {
-		//  ߸   ⺻ ȯ
+		// 뭔가 잘못된 세션은 대충 기본값 반환
 		if (!_IsValid) {
 			return TValue();
 		}
 
 		auto& frames = _Curve.GetKeyframes();
 
-		// _IsLooping == falseε ִϸ̼  帥  _IsEnded == true
-		//   Ű  ȯ
+		// _IsLooping == false인데 애니메이션이 다 흐른 경우 _IsEnded == true
+		// 제일 마지막 키프레임의 값 반환
 		if (_IsEnded) {
 			return frames[_FrameCount - 1].Value;
 		}
 
-		// Ͻ  ?
+		// 일시정지 된 경우?
 		if (!_IsPaused) {
 			_Time += InDeltaTime;
 		}
 
-		// ִϸ̼   
+		// 애니메이션 다 끝난 경우
 		if (_Time >= _Duration) {
-			// ݺϱ
+			// 반복하기
 			if (_IsLooping) {
-				// _Time % _Duration  ణ  ð ݿ
+				// _Time % _Duration 로 약간 벗어난 시간까지 반영
 				_Time = std::fmodf(_Time, _Duration);
 				_Index = 0;
 			}
-			// ƴ ׳ ű⼭ 
+			// 아님 그냥 거기서 끝내기
 			else {
 				_Time = _Duration;
 				_Index = _FrameCount - 1;
@@ -215,9 +215,9 @@ public:
 		}
 		int currentIndex = _Index;
 		int nextIndex = _Index + 1;
-		//  ð (x)
+		// 상대 시간 (x축)
 		float t = frames[nextIndex].Time - frames[currentIndex].Time;
-		//  ð ´ Ű ã
+		// 현재 시간에 맞는 키프레임 찾기
 		while (_Time >= frames[nextIndex].Time) {
 			++currentIndex;
 			++nextIndex;
@@ -228,13 +228,13 @@ public:
 		Keyframe& currentFrame = frames[currentIndex];
 		Keyframe& nextFrame = frames[nextIndex];
 
-		//   a,b,c 
+		// 사전에 계산된 a,b,c 계수들
 		KeyframeCalculation& calculation = _Curve.GetKeyframeCalculations()[currentIndex];
 
-		// Լ  (y)
+		// 함수 계산 (y축)
 		float v = calculation.Calculate(_Time - frames[currentIndex].Time);
 
-		//  y  ŸԿ ° 
+		// 계산된 y축을 각 타입에 맞게 적용
 		return currentFrame.GetValue(v, nextFrame);
 	}
 
@@ -246,26 +246,26 @@ public:
 	}
 
 private:
-	// AnimationCurve ۷
+	// AnimationCurve 레퍼런스
 	Curve& _Curve;
-	//   
+	// 프레임 갯수 상수
 	const int _FrameCount;
-	// ӽð 
+	// 지속시간 상수
 	const int _Duration;
 
-	// ݺ 
+	// 반복 여부
 	bool _IsLooping = true;
 
-	//  
+	// 현재 프레임
 	int _Index = 0;
-	//  ð
+	// 현재 시간
 	float _Time = 0.f;
 
-	// ȿ 
+	// 유효 여부
 	bool _IsValid = false;
-	// ִϸ̼  
+	// 애니메이션 종료 여부
 	bool _IsEnded = false;
-	// Ͻ 
+	// 일시정지 여부
 	bool _IsPaused = false;
 };
 }
\ No newline at end of file
@@ -1,6 +1,17 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <numeric>
+
+#include "SlotMap.h"
+#include "JobSystem.h"
+#include "Name.h"
 
 #include "InputManager.h"
 #include "EngineInterface.h"
@@ -15,7 +26,9 @@
 
 #include "3D/Resources.h"
 #include "3D/TransformComponent.h"
+#include "3D/TransformHierarchy.h"
 #include "3D/Bone.h"
+#include "3D/MeshSimplifier.h"
 #include "3D/Mesh.h"
 #include "3D/GameObject.h"
 #include "3D/CameraObject.h"
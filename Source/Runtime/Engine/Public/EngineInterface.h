@@ -35,6 +35,10 @@ public:
 	virtual bool IsInitialized() = 0;
 	virtual void OnScreenResize(const ScreenPoint& InScreenSize) = 0;
 	virtual InputManager& GetInputManager() = 0;
+
+	// 작업 분배기는 엔진을 사용하는 쪽이 소유하며 초기화 전에 지정한다.
+	virtual void SetJobSystem(JobSystem* InJobSystem) = 0;
+	virtual JobSystem& GetJobSystem() = 0;
 };
 
 }
\ No newline at end of file
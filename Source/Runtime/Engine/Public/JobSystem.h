@@ -0,0 +1,141 @@
+#pragma once
+
+namespace CK
+{
+
+class JobCounter;
+
+// 작업 스레드에서 실행할 작업. 끝나면 카운터를 하나 줄인다.
+struct Job
+{
+	std::function<void()> Function;
+	JobCounter* Counter = nullptr;
+};
+
+// 등록한 작업 중 끝나지 않은 작업의 수. 0이 되면 이 카운터를 기다리던 작업을 등록한다.
+class JobCounter
+{
+public:
+	// 생성자
+	JobCounter() = default;
+	JobCounter(const JobCounter&) = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+
+public:
+	// 멤버함수
+	FORCEINLINE bool IsDone() const { return _Count.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobSystem;
+
+	// 멤버변수
+	std::atomic<int> _Count{ 0 };
+	std::mutex _Mutex;
+	std::vector<Job> _Continuations; // 카운터가 0이 되면 등록할 작업
+};
+
+// 작업 스레드마다 큐를 두고, 자신의 큐가 비면 다른 스레드의 큐에서 작업을 가져오는 작업 분배기.
+// 0번 큐는 Init을 호출한 스레드(메인 스레드)의 것이며, 메인 스레드는 Wait에서 기다리는 동안 작업을 함께 처리한다.
+// 자신의 큐에서는 마지막에 넣은 작업부터, 다른 큐에서는 가장 먼저 넣은 작업부터 가져온다.
+class JobSystem
+{
+public:
+	// 생성자
+	JobSystem() = default;
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+	~JobSystem() { Shutdown(); }
+
+public:
+	// 멤버함수
+	bool Init(UINT32 InWorkerCount = 0); // 0이면 하드웨어 스레드 수에서 메인 스레드를 뺀 만큼 생성
+	void Shutdown();
+	FORCEINLINE bool IsInitialized() const { return !_Queues.empty(); }
+	FORCEINLINE UINT32 GetThreadCount() const { return static_cast<UINT32>(_Workers.size()) + 1; }
+
+	void Run(std::function<void()> InFunction, JobCounter* InCounter = nullptr);
+	void RunAfter(JobCounter& InDependency, std::function<void()> InFunction, JobCounter* InCounter = nullptr); // InDependency의 작업이 모두 끝난 후 실행
+	void Wait(JobCounter& InCounter); // 기다리는 동안 호출한 스레드도 작업을 처리
+
+	// [InBegin, InEnd) 범위를 InGrainSize 크기로 나누어 InFunction(size_t InChunkBegin, size_t InChunkEnd)를 실행하고 모두 끝날 때까지 기다린다.
+	template <class TFunction>
+	void ParallelFor(size_t InBegin, size_t InEnd, size_t InGrainSize, TFunction InFunction);
+
+private:
+	// 작업을 담는 원형 버퍼. 꺼낸 자리는 다시 사용하고 가득 찬 경우에만 두 배로 늘리므로, 충분히 커진 후에는 작업을 넣고 꺼낼 때 메모리를 할당하지 않는다.
+	class JobRing
+	{
+	public:
+		// 생성자
+		JobRing() : _Slots(InitialCapacity) { }
+
+	public:
+		// 멤버함수
+		FORCEINLINE bool IsEmpty() const { return _Count == 0; }
+		void PushBack(Job&& InJob);
+		void PopBack(Job& OutJob);
+		void PopFront(Job& OutJob);
+
+	private:
+		void Grow();
+
+		// 멤버변수
+		static constexpr size_t InitialCapacity = 64;
+		std::vector<Job> _Slots; // 크기는 항상 2의 거듭제곱
+		size_t _Head = 0;
+		size_t _Count = 0;
+	};
+
+	struct WorkerQueue
+	{
+		std::mutex Mutex;
+		JobRing Jobs;
+	};
+
+	void Submit(Job&& InJob);
+	bool TryGetJob(Job& OutJob);
+	void Execute(Job& InJob);
+	void WorkerMain(UINT32 InThreadIndex);
+
+private:
+	// 멤버변수
+	std::vector<std::unique_ptr<WorkerQueue>> _Queues;
+	std::vector<std::thread> _Workers;
+	std::atomic<bool> _IsRunning{ false };
+	std::atomic<int> _QueuedJobCount{ 0 };
+	std::mutex _SleepMutex;
+	std::condition_variable _WakeCondition;
+
+	// 정적멤버변수
+	static thread_local UINT32 _ThreadIndex; // 작업 스레드는 자신의 큐 번호, 그 외의 스레드는 0
+};
+
+template <class TFunction>
+void JobSystem::ParallelFor(size_t InBegin, size_t InEnd, size_t InGrainSize, TFunction InFunction)
+{
+	if (InEnd <= InBegin)
+	{
+		return;
+	}
+
+	// 나눌 필요가 없으면 호출한 스레드에서 바로 처리
+	const size_t grainSize = Math::Max<size_t>(InGrainSize, 1);
+	if (_Workers.empty() || InEnd - InBegin <= grainSize)
+	{
+		InFunction(InBegin, InEnd);
+		return;
+	}
+
+	// 첫 구간은 호출한 스레드가 맡고 나머지는 작업으로 등록
+	JobCounter counter;
+	for (size_t begin = InBegin + grainSize; begin < InEnd; begin += grainSize)
+	{
+		const size_t end = Math::Min(begin + grainSize, InEnd);
+		Run([&InFunction, begin, end]() { InFunction(begin, end); }, &counter);
+	}
+
+	InFunction(InBegin, InBegin + grainSize);
+	Wait(counter);
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+namespace CK
+{
+
+// 문자열을 전역 이름 테이블에 한 번만 등록하고 등록 번호로 다루는 이름.
+// 비교와 해시는 정수 연산이므로 매 프레임 실행되는 코드에서는 문자열 대신 미리 만들어둔 이름을 사용한다.
+// 같은 문자열은 항상 같은 번호를 가지며, 한 번 등록된 문자열은 프로그램이 끝날 때까지 유지된다.
+class Name
+{
+public:
+	// 생성자
+	FORCEINLINE constexpr Name() = default;
+	Name(const std::wstring& InString) : _Index(FindOrAdd(InString)) { }
+	Name(const wchar_t* InString) : _Index(FindOrAdd(InString)) { }
+
+	// 연산자
+	FORCEINLINE constexpr bool operator==(const Name& InName) const { return _Index == InName._Index; }
+	FORCEINLINE constexpr bool operator!=(const Name& InName) const { return _Index != InName._Index; }
+	FORCEINLINE constexpr bool operator<(const Name& InName) const { return _Index < InName._Index; }
+
+	// 멤버함수
+	FORCEINLINE constexpr bool IsNone() const { return _Index == 0; }
+	FORCEINLINE constexpr UINT32 GetIndex() const { return _Index; }
+	const std::wstring& ToString() const;
+
+	// 정적멤버변수
+	static const Name None;
+
+private:
+	static UINT32 FindOrAdd(const std::wstring& InString);
+
+private:
+	// 멤버변수
+	UINT32 _Index = 0; // 0은 빈 문자열
+};
+
+}
+
+namespace std
+{
+
+template <>
+struct hash<CK::Name>
+{
+	FORCEINLINE size_t operator()(const CK::Name& InName) const { return InName.GetIndex(); }
+};
+
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+namespace CK
+{
+
+// 슬롯 맵에 저장된 항목을 가리키는 핸들. 항목이 제거되면 슬롯의 세대가 바뀌므로 이전 핸들로는 접근할 수 없다.
+struct SlotHandle
+{
+public:
+	// 생성자
+	FORCEINLINE constexpr SlotHandle() = default;
+	FORCEINLINE constexpr SlotHandle(UINT32 InIndex, UINT32 InGeneration) : Index(InIndex), Generation(InGeneration) { }
+
+	// 연산자
+	FORCEINLINE constexpr bool operator==(const SlotHandle& InHandle) const { return Index == InHandle.Index && Generation == InHandle.Generation; }
+	FORCEINLINE constexpr bool operator!=(const SlotHandle& InHandle) const { return !(*this == InHandle); }
+
+	// 멤버함수
+	FORCEINLINE constexpr bool IsValid() const { return Generation != 0; }
+	FORCEINLINE constexpr UINT64 ToUINT64() const { return (static_cast<UINT64>(Generation) << 32) | Index; }
+
+	// 멤버변수
+	UINT32 Index = 0;
+	UINT32 Generation = 0; // 0은 어떤 슬롯에도 사용하지 않는 값
+};
+
+// 세대 값으로 구분하는 슬롯 맵.
+// 항목은 일정한 개수씩 묶은 페이지에 연속으로 저장하며, 페이지는 옮기지 않으므로 항목의 주소는 제거될 때까지 변하지 않는다.
+// 생성, 제거, 핸들로 찾기는 모두 상수 시간이며 제거된 슬롯은 다음 생성에서 다시 사용한다.
+template <class T>
+class SlotMap
+{
+private:
+	struct Slot
+	{
+		UINT32 Generation = 1;
+		UINT32 NextFree = InvalidIndex;
+		bool IsAlive = false;
+	};
+
+	// 슬롯 순서대로 살아있는 항목만 방문하는 반복자
+	template <class TValue>
+	class IteratorBase
+	{
+	public:
+		IteratorBase(const SlotMap* InMap, UINT32 InIndex) : _Map(InMap), _Index(InIndex) { SkipFreeSlots(); }
+
+		FORCEINLINE TValue& operator*() const { return *_Map->GetPointer(_Index); }
+		FORCEINLINE TValue* operator->() const { return _Map->GetPointer(_Index); }
+		FORCEINLINE IteratorBase& operator++() { ++_Index; SkipFreeSlots(); return *this; }
+		FORCEINLINE bool operator==(const IteratorBase& InIterator) const { return _Index == InIterator._Index; }
+		FORCEINLINE bool operator!=(const IteratorBase& InIterator) const { return _Index != InIterator._Index; }
+
+		FORCEINLINE SlotHandle GetHandle() const { return SlotHandle(_Index, _Map->_Slots[_Index].Generation); }
+
+	private:
+		FORCEINLINE void SkipFreeSlots()
+		{
+			const UINT32 slotCount = static_cast<UINT32>(_Map->_Slots.size());
+			while (_Index < slotCount && !_Map->_Slots[_Index].IsAlive)
+			{
+				++_Index;
+			}
+		}
+
+		const SlotMap* _Map = nullptr;
+		UINT32 _Index = 0;
+	};
+
+public:
+	using Iterator = IteratorBase<T>;
+	using ConstIterator = IteratorBase<const T>;
+
+	// 생성자
+	SlotMap() = default;
+	SlotMap(const SlotMap&) = delete;
+	SlotMap& operator=(const SlotMap&) = delete;
+	~SlotMap() { Clear(); }
+
+public:
+	// 멤버함수
+	template <class... TArgs>
+	SlotHandle Create(TArgs&&... InArgs);
+	bool Destroy(const SlotHandle& InHandle);
+	void Clear();
+	void Reserve(size_t InCount);
+
+	FORCEINLINE bool IsValid(const SlotHandle& InHandle) const { return InHandle.Index < _Slots.size() && _Slots[InHandle.Index].IsAlive && _Slots[InHandle.Index].Generation == InHandle.Generation; }
+	FORCEINLINE T* Get(const SlotHandle& InHandle) { return IsValid(InHandle) ? GetPointer(InHandle.Index) : nullptr; }
+	FORCEINLINE const T* Get(const SlotHandle& InHandle) const { return IsValid(InHandle) ? GetPointer(InHandle.Index) : nullptr; }
+	FORCEINLINE size_t GetSize() const { return _Size; }
+	FORCEINLINE bool IsEmpty() const { return _Size == 0; }
+
+	FORCEINLINE Iterator begin() { return Iterator(this, 0); }
+	FORCEINLINE Iterator end() { return Iterator(this, static_cast<UINT32>(_Slots.size())); }
+	FORCEINLINE ConstIterator begin() const { return ConstIterator(this, 0); }
+	FORCEINLINE ConstIterator end() const { return ConstIterator(this, static_cast<UINT32>(_Slots.size())); }
+
+	// 정적멤버변수
+	static constexpr UINT32 InvalidIndex = 0xFFFFFFFF;
+	static constexpr UINT32 PageSize = 1024;
+
+private:
+	struct alignas(T) Page
+	{
+		BYTE Bytes[sizeof(T) * PageSize];
+	};
+
+	// 페이지는 포인터로 들고 있으므로 const 함수에서도 항목의 주소를 얻을 수 있다.
+	FORCEINLINE T* GetPointer(UINT32 InIndex) const { return reinterpret_cast<T*>(_Pages[InIndex / PageSize]->Bytes) + (InIndex % PageSize); }
+
+private:
+	// 멤버변수
+	std::vector<Slot> _Slots;
+	std::vector<std::unique_ptr<Page>> _Pages;
+	UINT32 _FreeList = InvalidIndex;
+	size_t _Size = 0;
+};
+
+template <class T>
+template <class... TArgs>
+SlotHandle SlotMap<T>::Create(TArgs&&... InArgs)
+{
+	UINT32 index = InvalidIndex;
+	if (_FreeList != InvalidIndex)
+	{
+		index = _FreeList;
+		_FreeList = _Slots[index].NextFree;
+	}
+	else
+	{
+		index = static_cast<UINT32>(_Slots.size());
+		assert(index != InvalidIndex);
+		_Slots.emplace_back();
+		if (index / PageSize >= _Pages.size())
+		{
+			_Pages.emplace_back(new Page);
+		}
+	}
+
+	new (GetPointer(index)) T(std::forward<TArgs>(InArgs)...);
+
+	Slot& slot = _Slots[index];
+	slot.IsAlive = true;
+	slot.NextFree = InvalidIndex;
+	++_Size;
+	return SlotHandle(index, slot.Generation);
+}
+
+template <class T>
+bool SlotMap<T>::Destroy(const SlotHandle& InHandle)
+{
+	if (!IsValid(InHandle))
+	{
+		return false;
+	}
+
+	GetPointer(InHandle.Index)->~T();
+
+	// 세대를 바꿔 기존 핸들을 무효화. 한 바퀴 돌아도 0은 건너뛴다.
+	Slot& slot = _Slots[InHandle.Index];
+	slot.IsAlive = false;
+	if (++slot.Generation == 0)
+	{
+		slot.Generation = 1;
+	}
+
+	slot.NextFree = _FreeList;
+	_FreeList = InHandle.Index;
+	--_Size;
+	return true;
+}
+
+template <class T>
+void SlotMap<T>::Clear()
+{
+	// 슬롯은 남겨두어 이전에 발급한 핸들이 다시 유효해지지 않도록 한다.
+	const UINT32 slotCount = static_cast<UINT32>(_Slots.size());
+	for (UINT32 i = slotCount; i > 0; --i)
+	{
+		const UINT32 index = i - 1;
+		if (_Slots[index].IsAlive)
+		{
+			Destroy(SlotHandle(index, _Slots[index].Generation));
+		}
+	}
+}
+
+template <class T>
+void SlotMap<T>::Reserve(size_t InCount)
+{
+	_Slots.reserve(InCount);
+	const size_t pageCount = (InCount + PageSize - 1) / PageSize;
+	while (_Pages.size() < pageCount)
+	{
+		_Pages.emplace_back(new Page);
+	}
+}
+
+}
@@ -29,7 +29,8 @@ private:
 
 private:
 	static constexpr BYTE _Channel = 4;
-	std::vector<LinearColor> _Buffer;
+	// 텍셀은 RGBA 순서의 8비트 정규화 정수로 저장하고 샘플링할 때 풀어서 사용
+	std::vector<UNorm8x4> _Buffer;
 	UINT32 _Width = 0;
 	UINT32 _Height = 0;
 
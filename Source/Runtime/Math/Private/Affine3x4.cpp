@@ -0,0 +1,15 @@
+#include "Precompiled.h"
+using namespace CK;
+
+std::vector<std::string> Affine3x4::ToStrings() const
+{
+	std::vector<std::string> result;
+
+	for (BYTE i = 0; i < Rank; ++i)
+	{
+		char row[64];
+		std::snprintf(row, sizeof(row), "| %.3f , %.3f , %.3f, %.3f |", Rows[i].X, Rows[i].Y, Rows[i].Z, Rows[i].W);
+		result.emplace_back(row);
+	}
+	return result;
+}
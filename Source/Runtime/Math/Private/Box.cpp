@@ -1,12 +1,53 @@
-
 #include "Precompiled.h"
 using namespace CK;
 
-Box::Box(const std::vector<Vector3> InVertices)
+static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3 must be three packed floats");
+
+Box::Box(const std::vector<Vector3>& InVertices)
 {
-	for (const auto& v : InVertices)
+	size_t cnt = InVertices.size();
+	if (cnt == 0)
+	{
+		return;
+	}
+
+	Min = Max = InVertices[0];
+	size_t i = 0;
+	if (cnt >= 4)
+	{
+		// 정점 네 개(float 12개)를 레지스터 세 개로 읽어 위치별로 최소 최대값을 누적.
+		// 레인마다 담긴 성분이 다르므로 섞지 않고 누적한 후 마지막에 성분별로 합친다.
+		const float* stream = &InVertices[0].X;
+		VectorRegister minA = VectorLoad(stream), minB = VectorLoad(stream + 4), minC = VectorLoad(stream + 8);
+		VectorRegister maxA = minA, maxB = minB, maxC = minC;
+		for (i = 4; i + 4 <= cnt; i += 4)
+		{
+			const float* groupPtr = stream + i * 3;
+			const VectorRegister a = VectorLoad(groupPtr);
+			const VectorRegister b = VectorLoad(groupPtr + 4);
+			const VectorRegister c = VectorLoad(groupPtr + 8);
+			minA = VectorMin(minA, a); maxA = VectorMax(maxA, a);
+			minB = VectorMin(minB, b); maxB = VectorMax(maxB, b);
+			minC = VectorMin(minC, c); maxC = VectorMax(maxC, c);
+		}
+
+		// 누적한 레지스터는 그대로 정점 네 개로 해석할 수 있다.
+		Vector3 minGroup[4], maxGroup[4];
+		VectorStore(minA, &minGroup[0].X); VectorStore(minB, &minGroup[1].Y); VectorStore(minC, &minGroup[2].Z);
+		VectorStore(maxA, &maxGroup[0].X); VectorStore(maxB, &maxGroup[1].Y); VectorStore(maxC, &maxGroup[2].Z);
+
+		Min = minGroup[0];
+		Max = maxGroup[0];
+		for (BYTE lane = 1; lane < 4; ++lane)
+		{
+			*this += Box(minGroup[lane], maxGroup[lane]);
+		}
+	}
+
+	// 남은 정점
+	for (; i < cnt; ++i)
 	{
-		*this += v;
+		*this += InVertices[i];
 	}
 }
 
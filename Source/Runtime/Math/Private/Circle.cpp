@@ -1,8 +1,12 @@
-
 #include "Precompiled.h"
 using namespace CK;
 
-Circle::Circle(const std::vector<Vector2> InVertices)
+// 극점을 찾을 방향. 두 축과 두 개의 대각선을 사용한다.
+static constexpr std::array<Vector2, 4> ExtremalDirections = {
+	Vector2(1.f, 0.f), Vector2(0.f, 1.f), Vector2(1.f, 1.f), Vector2(1.f, -1.f)
+};
+
+Circle::Circle(const std::vector<Vector2>& InVertices)
 {
 	size_t cnt = InVertices.size();
 	if (cnt == 0)
@@ -10,16 +14,58 @@ Circle::Circle(const std::vector<Vector2> InVertices)
 		return;
 	}
 
-	Vector2 sum;
+	// 1. 각 방향으로 투영했을 때 양 끝에 놓이는 정점을 한 번의 순회로 찾는다.
+	std::array<size_t, ExtremalDirections.size()> minIndex = { }, maxIndex = { };
+	std::array<float, ExtremalDirections.size()> minProj, maxProj;
+	for (size_t d = 0; d < ExtremalDirections.size(); ++d)
+	{
+		minProj[d] = maxProj[d] = InVertices[0].Dot(ExtremalDirections[d]);
+	}
+
+	for (size_t i = 1; i < cnt; ++i)
+	{
+		for (size_t d = 0; d < ExtremalDirections.size(); ++d)
+		{
+			float proj = InVertices[i].Dot(ExtremalDirections[d]);
+			if (proj < minProj[d]) { minProj[d] = proj; minIndex[d] = i; }
+			if (proj > maxProj[d]) { maxProj[d] = proj; maxIndex[d] = i; }
+		}
+	}
+
+	// 2. 가장 멀리 떨어진 극점 쌍을 지름으로 하는 원에서 시작
+	size_t bestDirection = 0;
+	float bestDistanceSquared = -1.f;
+	for (size_t d = 0; d < ExtremalDirections.size(); ++d)
+	{
+		float distanceSquared = (InVertices[maxIndex[d]] - InVertices[minIndex[d]]).SizeSquared();
+		if (distanceSquared > bestDistanceSquared)
+		{
+			bestDistanceSquared = distanceSquared;
+			bestDirection = d;
+		}
+	}
+
+	Center = (InVertices[minIndex[bestDirection]] + InVertices[maxIndex[bestDirection]]) * 0.5f;
+	Radius = Math::Sqrt(bestDistanceSquared) * 0.5f;
+
+	// 3. 바깥에 있는 정점을 만나면 그 정점과 반대편 경계를 지름으로 하도록 원을 키운다. (Ritter)
 	for (const auto& v : InVertices)
 	{
-		sum += v;
+		float distanceSquared = (v - Center).SizeSquared();
+		if (distanceSquared > Radius * Radius)
+		{
+			float distance = Math::Sqrt(distanceSquared);
+			float newRadius = (Radius + distance) * 0.5f;
+			Center += (v - Center) * ((newRadius - Radius) / distance);
+			Radius = newRadius;
+		}
 	}
 
-	Center = sum / (float)cnt;
-	Radius = (*std::max_element(InVertices.begin(), InVertices.end(),
-		[&](Vector2 const& lhs, Vector2 const& rhs)
+	// 4. 반지름은 최종 중심에서 가장 먼 정점까지의 거리로 정한다. 반올림 오차로 정점이 밖에 남지 않도록 보장한다.
+	float maxDistanceSquared = 0.f;
+	for (const auto& v : InVertices)
 	{
-		return (Center - lhs).SizeSquared() < (Center - rhs).SizeSquared();
-	})).Size();
+		maxDistanceSquared = Math::Max(maxDistanceSquared, (v - Center).SizeSquared());
+	}
+	Radius = Math::Sqrt(maxDistanceSquared);
 }
@@ -0,0 +1,299 @@
+#include "Precompiled.h"
+using namespace CK;
+
+// 삽입 위치를 고를 때 비용으로 사용하는 박스의 표면적
+static FORCEINLINE float GetSurfaceArea(const Box& InBox)
+{
+	const Vector3 size = InBox.GetSize();
+	return 2.f * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+}
+
+static FORCEINLINE Box Combine(const Box& InBox1, const Box& InBox2)
+{
+	Box result(InBox1);
+	result += InBox2;
+	return result;
+}
+
+// 여유 박스가 실제 박스보다 이 비율 이상 커지면 크기를 줄이기 위해 다시 삽입
+static constexpr float MaxFatAreaRatio = 4.f;
+
+int DynamicBoxTree::Insert(const Box& InBox, void* InUserData)
+{
+	const int proxy = AllocateNode();
+	Node& leaf = _Nodes[proxy];
+	leaf.Bound = MakeFatBox(InBox);
+	leaf.UserData = InUserData;
+	leaf.Height = 0;
+
+	InsertLeaf(proxy);
+	++_ProxyCount;
+	return proxy;
+}
+
+void DynamicBoxTree::Remove(int InProxy)
+{
+	assert(IsValidProxy(InProxy));
+	RemoveLeaf(InProxy);
+	FreeNode(InProxy);
+	--_ProxyCount;
+}
+
+bool DynamicBoxTree::Move(int InProxy, const Box& InBox)
+{
+	assert(IsValidProxy(InProxy));
+	const Box fatBox = MakeFatBox(InBox);
+	const Box& currentBox = _Nodes[InProxy].Bound;
+	if (currentBox.IsInside(InBox) && GetSurfaceArea(currentBox) <= GetSurfaceArea(fatBox) * MaxFatAreaRatio)
+	{
+		return false;
+	}
+
+	RemoveLeaf(InProxy);
+	_Nodes[InProxy].Bound = fatBox;
+	InsertLeaf(InProxy);
+	return true;
+}
+
+void DynamicBoxTree::Clear()
+{
+	_Nodes.clear();
+	_Root = InvalidIndex;
+	_FreeList = InvalidIndex;
+	_ProxyCount = 0;
+}
+
+Box DynamicBoxTree::MakeFatBox(const Box& InBox) const
+{
+	// 납작한 박스도 모든 축으로 여유를 갖도록 가장 긴 축을 기준으로 한 여유값을 사용
+	const float margin = InBox.GetExtent().Max() * _MarginRatio;
+	const Vector3 marginVector(margin, margin, margin);
+	return Box(InBox.Min - marginVector, InBox.Max + marginVector);
+}
+
+int DynamicBoxTree::AllocateNode()
+{
+	int nodeIndex = InvalidIndex;
+	if (_FreeList == InvalidIndex)
+	{
+		nodeIndex = static_cast<int>(_Nodes.size());
+		_Nodes.emplace_back();
+	}
+	else
+	{
+		nodeIndex = _FreeList;
+		_FreeList = _Nodes[nodeIndex].Parent;
+		_Nodes[nodeIndex] = Node();
+	}
+
+	return nodeIndex;
+}
+
+void DynamicBoxTree::FreeNode(int InNode)
+{
+	Node& node = _Nodes[InNode];
+	node.Parent = _FreeList;
+	node.Child1 = node.Child2 = InvalidIndex;
+	node.UserData = nullptr;
+	node.Height = -1;
+	_FreeList = InNode;
+}
+
+void DynamicBoxTree::InsertLeaf(int InLeaf)
+{
+	if (_Root == InvalidIndex)
+	{
+		_Root = InLeaf;
+		_Nodes[_Root].Parent = InvalidIndex;
+		return;
+	}
+
+	// 1. 합쳤을 때 늘어나는 표면적이 가장 적은 형제 노드를 찾는다.
+	// 자식으로 내려갈 때 조상 노드가 커지는 비용은 모든 경우에 공통이므로 상속 비용으로 더해준다.
+	const Box leafBox = _Nodes[InLeaf].Bound;
+	int index = _Root;
+	while (!_Nodes[index].IsLeaf())
+	{
+		const Node& node = _Nodes[index];
+		const float area = GetSurfaceArea(node.Bound);
+		const float combinedArea = GetSurfaceArea(Combine(node.Bound, leafBox));
+
+		// 현재 노드를 형제로 삼아 새 부모를 만드는 비용
+		const float cost = 2.f * combinedArea;
+		const float inheritanceCost = 2.f * (combinedArea - area);
+
+		float childCosts[2] = { 0.f, 0.f };
+		const int children[2] = { node.Child1, node.Child2 };
+		for (BYTE i = 0; i < 2; ++i)
+		{
+			const Node& child = _Nodes[children[i]];
+			const float childCombinedArea = GetSurfaceArea(Combine(child.Bound, leafBox));
+			childCosts[i] = (child.IsLeaf() ? childCombinedArea : childCombinedArea - GetSurfaceArea(child.Bound)) + inheritanceCost;
+		}
+
+		if (cost < childCosts[0] && cost < childCosts[1])
+		{
+			break;
+		}
+
+		index = (childCosts[0] < childCosts[1]) ? children[0] : children[1];
+	}
+
+	// 2. 형제 노드와 새 잎 노드를 자식으로 하는 부모 노드를 만든다.
+	const int sibling = index;
+	const int oldParent = _Nodes[sibling].Parent;
+	const int newParent = AllocateNode();
+	Node& parentNode = _Nodes[newParent];
+	parentNode.Parent = oldParent;
+	parentNode.Bound = Combine(leafBox, _Nodes[sibling].Bound);
+	parentNode.Height = _Nodes[sibling].Height + 1;
+	parentNode.Child1 = sibling;
+	parentNode.Child2 = InLeaf;
+
+	if (oldParent != InvalidIndex)
+	{
+		Node& oldParentNode = _Nodes[oldParent];
+		if (oldParentNode.Child1 == sibling)
+		{
+			oldParentNode.Child1 = newParent;
+		}
+		else
+		{
+			oldParentNode.Child2 = newParent;
+		}
+	}
+	else
+	{
+		_Root = newParent;
+	}
+
+	_Nodes[sibling].Parent = newParent;
+	_Nodes[InLeaf].Parent = newParent;
+
+	// 3. 조상 노드의 박스와 높이를 갱신하면서 균형을 맞춘다.
+	RefitAncestors(newParent);
+}
+
+void DynamicBoxTree::RemoveLeaf(int InLeaf)
+{
+	if (InLeaf == _Root)
+	{
+		_Root = InvalidIndex;
+		return;
+	}
+
+	// 부모 노드를 없애고 형제 노드를 조부모 노드에 직접 연결
+	const int parent = _Nodes[InLeaf].Parent;
+	const int grandParent = _Nodes[parent].Parent;
+	const int sibling = (_Nodes[parent].Child1 == InLeaf) ? _Nodes[parent].Child2 : _Nodes[parent].Child1;
+
+	if (grandParent != InvalidIndex)
+	{
+		Node& grandParentNode = _Nodes[grandParent];
+		if (grandParentNode.Child1 == parent)
+		{
+			grandParentNode.Child1 = sibling;
+		}
+		else
+		{
+			grandParentNode.Child2 = sibling;
+		}
+		_Nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+
+		RefitAncestors(grandParent);
+	}
+	else
+	{
+		_Root = sibling;
+		_Nodes[sibling].Parent = InvalidIndex;
+		FreeNode(parent);
+	}
+
+	_Nodes[InLeaf].Parent = InvalidIndex;
+}
+
+void DynamicBoxTree::RefitAncestors(int InNode)
+{
+	int index = InNode;
+	while (index != InvalidIndex)
+	{
+		index = Balance(index);
+
+		Node& node = _Nodes[index];
+		const Node& child1 = _Nodes[node.Child1];
+		const Node& child2 = _Nodes[node.Child2];
+		node.Height = 1 + Math::Max(child1.Height, child2.Height);
+		node.Bound = Combine(child1.Bound, child2.Bound);
+
+		index = node.Parent;
+	}
+}
+
+// 노드 A의 두 자식 높이가 2 이상 차이나면 높은 쪽 자식을 A의 자리로 올리는 회전을 수행하고 새로 올라온 노드를 반환
+int DynamicBoxTree::Balance(int InNode)
+{
+	const int iA = InNode;
+	if (_Nodes[iA].IsLeaf() || _Nodes[iA].Height < 2)
+	{
+		return iA;
+	}
+
+	const int iB = _Nodes[iA].Child1;
+	const int iC = _Nodes[iA].Child2;
+	const int balance = _Nodes[iC].Height - _Nodes[iB].Height;
+	if (balance >= -1 && balance <= 1)
+	{
+		return iA;
+	}
+
+	// 높은 쪽 자식을 올리고, A는 올라간 노드의 첫 번째 자식이 된다.
+	const bool isChild2Up = (balance > 1);
+	const int iUp = isChild2Up ? iC : iB;
+	const int iStay = isChild2Up ? iB : iC;
+	const int iF = _Nodes[iUp].Child1;
+	const int iG = _Nodes[iUp].Child2;
+
+	Node& a = _Nodes[iA];
+	Node& up = _Nodes[iUp];
+	up.Child1 = iA;
+	up.Parent = a.Parent;
+	a.Parent = iUp;
+	if (up.Parent != InvalidIndex)
+	{
+		Node& upParent = _Nodes[up.Parent];
+		if (upParent.Child1 == iA)
+		{
+			upParent.Child1 = iUp;
+		}
+		else
+		{
+			upParent.Child2 = iUp;
+		}
+	}
+	else
+	{
+		_Root = iUp;
+	}
+
+	// 올라간 노드의 자식 중 높은 쪽은 그대로 두고, 낮은 쪽은 A가 올라간 노드를 가리키던 자리로 옮긴다.
+	const bool isFHigher = (_Nodes[iF].Height > _Nodes[iG].Height);
+	const int iKeep = isFHigher ? iF : iG;
+	const int iMove = isFHigher ? iG : iF;
+	up.Child2 = iKeep;
+	if (isChild2Up)
+	{
+		a.Child2 = iMove;
+	}
+	else
+	{
+		a.Child1 = iMove;
+	}
+	_Nodes[iMove].Parent = iA;
+
+	a.Bound = Combine(_Nodes[iStay].Bound, _Nodes[iMove].Bound);
+	a.Height = 1 + Math::Max(_Nodes[iStay].Height, _Nodes[iMove].Height);
+	up.Bound = Combine(a.Bound, _Nodes[iKeep].Bound);
+	up.Height = 1 + Math::Max(a.Height, _Nodes[iKeep].Height);
+	return iUp;
+}
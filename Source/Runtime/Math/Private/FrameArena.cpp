@@ -0,0 +1,139 @@
+#include "Precompiled.h"
+using namespace CK;
+
+namespace
+{
+
+// 프레임의 끝에서 모든 스레드의 아레나를 비우기 위한 목록
+struct FrameArenaRegistry
+{
+	std::mutex Mutex;
+	std::vector<FrameArena*> Arenas;
+};
+
+FrameArenaRegistry& GetRegistry()
+{
+	static FrameArenaRegistry registry;
+	return registry;
+}
+
+}
+
+FrameArena::FrameArena()
+{
+	FrameArenaRegistry& registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.Mutex);
+	registry.Arenas.push_back(this);
+}
+
+FrameArena::~FrameArena()
+{
+	{
+		FrameArenaRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		registry.Arenas.erase(std::find(registry.Arenas.begin(), registry.Arenas.end(), this));
+	}
+
+	ReleaseBlocks();
+}
+
+FrameArena& FrameArena::Get()
+{
+	static thread_local FrameArena arena;
+	return arena;
+}
+
+void FrameArena::ResetAll()
+{
+	FrameArenaRegistry& registry = GetRegistry();
+	std::lock_guard<std::mutex> lock(registry.Mutex);
+	for (FrameArena* arena : registry.Arenas)
+	{
+		arena->Reset();
+	}
+}
+
+void* FrameArena::Allocate(size_t InSize, size_t InAlignment)
+{
+	assert(InAlignment > 0 && (InAlignment & (InAlignment - 1)) == 0);
+	while (true)
+	{
+		if (_BlockIndex < _Blocks.size())
+		{
+			const Block& block = _Blocks[_BlockIndex];
+			const size_t address = reinterpret_cast<size_t>(block.Memory) + _Offset;
+			const size_t alignedOffset = _Offset + (((address + InAlignment - 1) & ~(InAlignment - 1)) - address);
+			if (alignedOffset + InSize <= block.Size)
+			{
+				_UsedSize += alignedOffset + InSize - _Offset;
+				_Offset = alignedOffset + InSize;
+				return block.Memory + alignedOffset;
+			}
+
+			// 남은 공간이 부족하면 다음 블록으로 넘어간다.
+			if (_BlockIndex + 1 < _Blocks.size())
+			{
+				++_BlockIndex;
+				_Offset = 0;
+				continue;
+			}
+		}
+
+		AddBlock(InSize + InAlignment);
+		_BlockIndex = _Blocks.size() - 1;
+		_Offset = 0;
+	}
+}
+
+void FrameArena::Deallocate(void* InPointer, size_t InSize)
+{
+	// 마지막으로 할당한 메모리를 돌려받은 경우에만 오프셋을 되돌린다. 할당의 역순으로 해제되는 임시 컨테이너가 여기에 해당한다.
+	// 컨테이너가 커질 때는 새 메모리를 먼저 할당한 후 이전 메모리를 돌려주므로 이전 메모리는 회수되지 않고 프레임이 끝날 때 함께 정리된다.
+	if (_BlockIndex >= _Blocks.size() || InPointer == nullptr)
+	{
+		return;
+	}
+
+	BYTE* pointer = static_cast<BYTE*>(InPointer);
+	const Block& block = _Blocks[_BlockIndex];
+	if (pointer >= block.Memory && pointer + InSize == block.Memory + _Offset)
+	{
+		_Offset -= InSize;
+		_UsedSize -= InSize;
+	}
+}
+
+void FrameArena::Reset()
+{
+	// 한 프레임에 여러 블록을 사용했다면 다음 프레임부터는 한 블록으로 충분하도록 합친다.
+	if (_Blocks.size() > 1)
+	{
+		const size_t totalSize = _Capacity;
+		ReleaseBlocks();
+		AddBlock(totalSize);
+	}
+
+	_BlockIndex = 0;
+	_Offset = 0;
+	_UsedSize = 0;
+}
+
+void FrameArena::AddBlock(size_t InMinSize)
+{
+	Block newBlock;
+	newBlock.Size = Math::Max(InMinSize, DefaultBlockSize);
+	newBlock.Memory = new BYTE[newBlock.Size];
+	_Blocks.push_back(newBlock);
+	_Capacity += newBlock.Size;
+}
+
+void FrameArena::ReleaseBlocks()
+{
+	for (Block& block : _Blocks)
+	{
+		delete[] block.Memory;
+	}
+
+	_Blocks.clear();
+	_Capacity = 0;
+}
@@ -1,8 +1,211 @@
-
 #include "Precompiled.h"
 using namespace CK;
 
+// 평면 하나를 레지스터에 복제해둔 값
+struct FrustumPlaneRegister
+{
+	VectorRegister NormalX, NormalY, NormalZ, D;
+	VectorRegister AbsNormalX, AbsNormalY, AbsNormalZ;
+};
+
+static void LoadPlaneRegisters(const std::array<Plane, 6>& InPlanes, std::array<FrustumPlaneRegister, 6>& OutRegisters)
+{
+	for (size_t pi = 0; pi < InPlanes.size(); ++pi)
+	{
+		const Plane& p = InPlanes[pi];
+		FrustumPlaneRegister& r = OutRegisters[pi];
+		r.NormalX = VectorSetFloat1(p.Normal.X);
+		r.NormalY = VectorSetFloat1(p.Normal.Y);
+		r.NormalZ = VectorSetFloat1(p.Normal.Z);
+		r.D = VectorSetFloat1(p.D);
+		r.AbsNormalX = VectorSetFloat1(Math::Abs(p.Normal.X));
+		r.AbsNormalY = VectorSetFloat1(Math::Abs(p.Normal.Y));
+		r.AbsNormalZ = VectorSetFloat1(Math::Abs(p.Normal.Z));
+	}
+}
+
+static void PrepareMasks(size_t InCount, std::vector<UINT32>& OutVisibleMask, std::vector<UINT32>& OutIntersectMask)
+{
+	const size_t wordCount = (InCount + 31) / 32;
+	OutVisibleMask.assign(wordCount, 0);
+	OutIntersectMask.assign(wordCount, 0);
+}
+
+static FORCEINLINE void WriteMasks(size_t InIndex, UINT32 InOutsideBits, UINT32 InStraddleBits, UINT32 InLaneCount, std::vector<UINT32>& OutVisibleMask, std::vector<UINT32>& OutIntersectMask)
+{
+	const UINT32 laneMask = (1u << InLaneCount) - 1u;
+	const UINT32 visibleBits = ~InOutsideBits & laneMask;
+	const UINT32 shift = static_cast<UINT32>(InIndex & 31);
+	OutVisibleMask[InIndex >> 5] |= visibleBits << shift;
+	OutIntersectMask[InIndex >> 5] |= (visibleBits & InStraddleBits) << shift;
+}
+
+void Frustum::CheckBounds(const BoxArray& InBoxes, std::vector<UINT32>& OutVisibleMask, std::vector<UINT32>& OutIntersectMask) const
+{
+	const size_t count = InBoxes.Size();
+	PrepareMasks(count, OutVisibleMask, OutIntersectMask);
+
+	std::array<FrustumPlaneRegister, 6> planes;
+	LoadPlaneRegisters(Planes, planes);
+
+	// 박스 중심의 거리 d와 법선 방향으로 투영한 박스의 반경 r을 구하면
+	// d - r > 0 이면 평면 밖, d + r > 0 이면 평면에 걸치거나 밖에 있다.
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const VectorRegister cx = VectorLoad(&InBoxes.CenterX[i]);
+		const VectorRegister cy = VectorLoad(&InBoxes.CenterY[i]);
+		const VectorRegister cz = VectorLoad(&InBoxes.CenterZ[i]);
+		const VectorRegister ex = VectorLoad(&InBoxes.ExtentX[i]);
+		const VectorRegister ey = VectorLoad(&InBoxes.ExtentY[i]);
+		const VectorRegister ez = VectorLoad(&InBoxes.ExtentZ[i]);
+
+		VectorRegister outside = VectorZero();
+		VectorRegister straddle = VectorZero();
+		for (const FrustumPlaneRegister& p : planes)
+		{
+			VectorRegister d = VectorMultiplyAdd(p.NormalX, cx, p.D);
+			d = VectorMultiplyAdd(p.NormalY, cy, d);
+			d = VectorMultiplyAdd(p.NormalZ, cz, d);
+
+			VectorRegister r = VectorMultiply(p.AbsNormalX, ex);
+			r = VectorMultiplyAdd(p.AbsNormalY, ey, r);
+			r = VectorMultiplyAdd(p.AbsNormalZ, ez, r);
+
+			outside = VectorBitwiseOr(outside, VectorCompareGT(d, r));
+			straddle = VectorBitwiseOr(straddle, VectorCompareGT(VectorAdd(d, r), VectorZero()));
+		}
+
+		WriteMasks(i, VectorMaskBits(outside), VectorMaskBits(straddle), 4, OutVisibleMask, OutIntersectMask);
+	}
+
+	for (; i < count; ++i)
+	{
+		UINT32 outside = 0, straddle = 0;
+		for (const Plane& p : Planes)
+		{
+			float d = p.Normal.X * InBoxes.CenterX[i] + p.Normal.Y * InBoxes.CenterY[i] + p.Normal.Z * InBoxes.CenterZ[i] + p.D;
+			float r = Math::Abs(p.Normal.X) * InBoxes.ExtentX[i] + Math::Abs(p.Normal.Y) * InBoxes.ExtentY[i] + Math::Abs(p.Normal.Z) * InBoxes.ExtentZ[i];
+			outside |= (d > r) ? 1u : 0u;
+			straddle |= (d + r > 0.f) ? 1u : 0u;
+		}
+
+		WriteMasks(i, outside, straddle, 1, OutVisibleMask, OutIntersectMask);
+	}
+}
+
+void Frustum::CheckBounds(const SphereArray& InSpheres, std::vector<UINT32>& OutVisibleMask, std::vector<UINT32>& OutIntersectMask) const
+{
+	const size_t count = InSpheres.Size();
+	PrepareMasks(count, OutVisibleMask, OutIntersectMask);
+
+	std::array<FrustumPlaneRegister, 6> planes;
+	LoadPlaneRegisters(Planes, planes);
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const VectorRegister cx = VectorLoad(&InSpheres.CenterX[i]);
+		const VectorRegister cy = VectorLoad(&InSpheres.CenterY[i]);
+		const VectorRegister cz = VectorLoad(&InSpheres.CenterZ[i]);
+		const VectorRegister r = VectorLoad(&InSpheres.Radius[i]);
+
+		VectorRegister outside = VectorZero();
+		VectorRegister straddle = VectorZero();
+		for (const FrustumPlaneRegister& p : planes)
+		{
+			VectorRegister d = VectorMultiplyAdd(p.NormalX, cx, p.D);
+			d = VectorMultiplyAdd(p.NormalY, cy, d);
+			d = VectorMultiplyAdd(p.NormalZ, cz, d);
+
+			outside = VectorBitwiseOr(outside, VectorCompareGT(d, r));
+			straddle = VectorBitwiseOr(straddle, VectorCompareGT(VectorAdd(d, r), VectorZero()));
+		}
+
+		WriteMasks(i, VectorMaskBits(outside), VectorMaskBits(straddle), 4, OutVisibleMask, OutIntersectMask);
+	}
+
+	for (; i < count; ++i)
+	{
+		UINT32 outside = 0, straddle = 0;
+		for (const Plane& p : Planes)
+		{
+			float d = p.Normal.X * InSpheres.CenterX[i] + p.Normal.Y * InSpheres.CenterY[i] + p.Normal.Z * InSpheres.CenterZ[i] + p.D;
+			outside |= (d > InSpheres.Radius[i]) ? 1u : 0u;
+			straddle |= (d + InSpheres.Radius[i] > 0.f) ? 1u : 0u;
+		}
+
+		WriteMasks(i, outside, straddle, 1, OutVisibleMask, OutIntersectMask);
+	}
+}
+
+BoundCheckResult Frustum::CheckBound(const OrientedBox& InBox) const
+{
+	BYTE lastRejectPlane = 0, insideMask = 0;
+	return CheckBound(InBox, lastRejectPlane, insideMask);
+}
+
+BoundCheckResult Frustum::CheckBound(const OrientedBox& InBox, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const
+{
+	BoundCheckResult result = CheckBoundCoherent(InBox, InOutLastRejectPlane, InOutInsideMask);
+	if (result == BoundCheckResult::Intersect && IsSeparated(InBox))
+	{
+		return BoundCheckResult::Outside;
+	}
+
+	return result;
+}
+
+bool Frustum::IsSeparated(const OrientedBox& InBox) const
+{
+	// 분리축으로 투영했을 때 절두체 꼭지점의 범위와 박스의 범위가 겹치지 않으면 분리된 것
+	auto isSeparatingAxis = [&](const Vector3& InAxis)
+	{
+		float frustumMin = InAxis.Dot(Corners[0]);
+		float frustumMax = frustumMin;
+		for (BYTE i = 1; i < 8; ++i)
+		{
+			float proj = InAxis.Dot(Corners[i]);
+			frustumMin = Math::Min(frustumMin, proj);
+			frustumMax = Math::Max(frustumMax, proj);
+		}
+
+		float center = InAxis.Dot(InBox.Center);
+		float radius = InBox.GetProjectedExtent(InAxis);
+		return (center - radius > frustumMax) || (center + radius < frustumMin);
+	};
+
+	// 박스의 면 법선. 절두체의 면 법선은 평면 판정에서 이미 검사했다.
+	for (const Vector3& axis : InBox.Axes)
+	{
+		if (isSeparatingAxis(axis))
+		{
+			return true;
+		}
+	}
 
+	// 절두체 모서리의 방향은 옆면의 모서리 네 개와 near 평면의 가로, 세로 두 개
+	const std::array<Vector3, 6> frustumEdges = {
+		Corners[4] - Corners[0], Corners[5] - Corners[1], Corners[6] - Corners[2], Corners[7] - Corners[3],
+		Corners[5] - Corners[4], Corners[6] - Corners[4]
+	};
 
+	for (const Vector3& axis : InBox.Axes)
+	{
+		for (const Vector3& edge : frustumEdges)
+		{
+			Vector3 crossAxis = axis.Cross(edge);
+			if (crossAxis.SizeSquared() <= SMALL_NUMBER)
+			{
+				continue;
+			}
 
+			if (isSeparatingAxis(crossAxis))
+			{
+				return true;
+			}
+		}
+	}
 
+	return false;
+}
@@ -12,3 +12,62 @@ using namespace CK;
 //const std::string Math::InvalidHashName("!@CK_INVALIDHASH#$");
 const std::size_t Math::InvalidHash = std::hash<std::string>()(InvalidHashName);
 
+// 네 개씩 벡터 함수로 계산하고, 남은 값은 1로 채운 임시 배열에 담아 같은 벡터 함수로 계산
+template<typename TFunction>
+static void ApplyVectorFunction(const float* InValues, float* OutValues, size_t InCount, TFunction InFunction)
+{
+	size_t i = 0;
+	for (; i + 4 <= InCount; i += 4)
+	{
+		VectorStore(InFunction(VectorLoad(InValues + i)), OutValues + i);
+	}
+
+	if (i < InCount)
+	{
+		float values[4] = { 1.f, 1.f, 1.f, 1.f };
+		const size_t remain = InCount - i;
+		std::memcpy(values, InValues + i, remain * sizeof(float));
+		VectorStore(InFunction(VectorLoad(values)), values);
+		std::memcpy(OutValues + i, values, remain * sizeof(float));
+	}
+}
+
+void Math::InvSqrt(const float* InValues, float* OutValues, size_t InCount)
+{
+	ApplyVectorFunction(InValues, OutValues, InCount, [](const VectorRegister& InVector) { return VectorReciprocalSqrt(InVector); });
+}
+
+void Math::SinCosRad(const float* InRadians, float* OutSin, float* OutCos, size_t InCount)
+{
+	size_t i = 0;
+	VectorRegister s, c;
+	for (; i + 4 <= InCount; i += 4)
+	{
+		VectorSinCos(VectorLoad(InRadians + i), s, c);
+		VectorStore(s, OutSin + i);
+		VectorStore(c, OutCos + i);
+	}
+
+	if (i < InCount)
+	{
+		float values[4] = { 0.f, 0.f, 0.f, 0.f };
+		float sinValues[4], cosValues[4];
+		const size_t remain = InCount - i;
+		std::memcpy(values, InRadians + i, remain * sizeof(float));
+		VectorSinCos(VectorLoad(values), s, c);
+		VectorStore(s, sinValues);
+		VectorStore(c, cosValues);
+		std::memcpy(OutSin + i, sinValues, remain * sizeof(float));
+		std::memcpy(OutCos + i, cosValues, remain * sizeof(float));
+	}
+}
+
+void Math::Acos(const float* InValues, float* OutValues, size_t InCount)
+{
+	ApplyVectorFunction(InValues, OutValues, InCount, [](const VectorRegister& InVector) { return VectorAcos(InVector); });
+}
+
+void Math::Exp(const float* InValues, float* OutValues, size_t InCount)
+{
+	ApplyVectorFunction(InValues, OutValues, InCount, [](const VectorRegister& InVector) { return VectorExp(InVector); });
+}
@@ -2,8 +2,6 @@
 #include "Precompiled.h"
 using namespace CK;
 
-const Matrix2x2 Matrix2x2::Identity(Vector2(1.f, 0.f), Vector2(0.f, 1.f));
-
 std::vector<std::string> Matrix2x2::ToStrings() const
 {
 	std::vector<std::string> result;
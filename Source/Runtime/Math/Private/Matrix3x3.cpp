@@ -2,8 +2,6 @@
 #include "Precompiled.h"
 using namespace CK;
 
-const Matrix3x3 Matrix3x3::Identity(Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f));
-
 std::vector<std::string> Matrix3x3::ToStrings() const
 {
 	std::vector<std::string> result;
@@ -0,0 +1,175 @@
+#include "Precompiled.h"
+using namespace CK;
+
+// 대칭 행렬을 야코비 회전으로 대각화해 고유벡터를 구한다. 3x3 행렬은 몇 번의 순회로 수렴한다.
+static void SymmetricEigenVectors(float InOutMatrix[3][3], std::array<Vector3, 3>& OutEigenVectors)
+{
+	float v[3][3] = { { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f } };
+	for (int sweep = 0; sweep < 16; ++sweep)
+	{
+		const float offDiagonal = InOutMatrix[0][1] * InOutMatrix[0][1] + InOutMatrix[0][2] * InOutMatrix[0][2] + InOutMatrix[1][2] * InOutMatrix[1][2];
+		if (offDiagonal <= SMALL_NUMBER)
+		{
+			break;
+		}
+
+		for (int p = 0; p < 2; ++p)
+		{
+			for (int q = p + 1; q < 3; ++q)
+			{
+				if (Math::Abs(InOutMatrix[p][q]) <= SMALL_NUMBER)
+				{
+					continue;
+				}
+
+				// (p, q) 성분을 0으로 만드는 회전각
+				const float theta = (InOutMatrix[q][q] - InOutMatrix[p][p]) / (2.f * InOutMatrix[p][q]);
+				const float t = ((theta >= 0.f) ? 1.f : -1.f) / (Math::Abs(theta) + sqrtf(theta * theta + 1.f));
+				const float c = 1.f / sqrtf(t * t + 1.f);
+				const float s = t * c;
+
+				for (int k = 0; k < 3; ++k)
+				{
+					const float mkp = InOutMatrix[k][p], mkq = InOutMatrix[k][q];
+					InOutMatrix[k][p] = c * mkp - s * mkq;
+					InOutMatrix[k][q] = s * mkp + c * mkq;
+				}
+				for (int k = 0; k < 3; ++k)
+				{
+					const float mpk = InOutMatrix[p][k], mqk = InOutMatrix[q][k];
+					InOutMatrix[p][k] = c * mpk - s * mqk;
+					InOutMatrix[q][k] = s * mpk + c * mqk;
+				}
+				for (int k = 0; k < 3; ++k)
+				{
+					const float vkp = v[k][p], vkq = v[k][q];
+					v[k][p] = c * vkp - s * vkq;
+					v[k][q] = s * vkp + c * vkq;
+				}
+			}
+		}
+	}
+
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		OutEigenVectors[i] = Vector3(v[0][i], v[1][i], v[2][i]).GetNormalize();
+	}
+}
+
+OrientedBox::OrientedBox(const std::vector<Vector3>& InVertices)
+{
+	size_t cnt = InVertices.size();
+	if (cnt == 0)
+	{
+		return;
+	}
+
+	// 1. 정점 분포의 공분산 행렬
+	Vector3 mean;
+	for (const auto& v : InVertices)
+	{
+		mean += v;
+	}
+	mean /= (float)cnt;
+
+	float covariance[3][3] = { };
+	for (const auto& v : InVertices)
+	{
+		const Vector3 d = v - mean;
+		covariance[0][0] += d.X * d.X; covariance[0][1] += d.X * d.Y; covariance[0][2] += d.X * d.Z;
+		covariance[1][1] += d.Y * d.Y; covariance[1][2] += d.Y * d.Z;
+		covariance[2][2] += d.Z * d.Z;
+	}
+	covariance[1][0] = covariance[0][1];
+	covariance[2][0] = covariance[0][2];
+	covariance[2][1] = covariance[1][2];
+
+	// 2. 고유벡터를 박스의 축으로 사용. 오른손 좌표계가 되도록 세 번째 축은 외적으로 다시 구한다.
+	std::array<Vector3, 3> axes;
+	SymmetricEigenVectors(covariance, axes);
+	axes[2] = axes[0].Cross(axes[1]).GetNormalize();
+
+	// 3. 각 축으로 정점을 투영해 범위를 구한다.
+	Vector3 minProj(axes[0].Dot(InVertices[0]), axes[1].Dot(InVertices[0]), axes[2].Dot(InVertices[0]));
+	Vector3 maxProj = minProj;
+	for (const auto& v : InVertices)
+	{
+		for (BYTE i = 0; i < 3; ++i)
+		{
+			const float proj = axes[i].Dot(v);
+			minProj[i] = Math::Min(minProj[i], proj);
+			maxProj[i] = Math::Max(maxProj[i], proj);
+		}
+	}
+
+	const Vector3 localCenter = (minProj + maxProj) * 0.5f;
+	Center = axes[0] * localCenter.X + axes[1] * localCenter.Y + axes[2] * localCenter.Z;
+	Axes = axes;
+	Extent = (maxProj - minProj) * 0.5f;
+
+	// 주성분 방향이 오히려 불리한 분포도 있으므로 축 정렬 박스가 더 작으면 그쪽을 사용
+	const OrientedBox aligned{ Box(InVertices) };
+	if (aligned.Extent.X * aligned.Extent.Y * aligned.Extent.Z < Extent.X * Extent.Y * Extent.Z)
+	{
+		*this = aligned;
+	}
+}
+
+bool OrientedBox::Intersect(const OrientedBox& InBox) const
+{
+	// 두 박스의 면 법선 6개와 모서리 쌍의 외적 9개를 분리축 후보로 검사한다.
+	// 상대 박스의 축을 이 박스의 좌표계로 표현한 회전 행렬을 미리 구해둔다.
+	float r[3][3] = { }, absR[3][3] = { };
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		for (BYTE j = 0; j < 3; ++j)
+		{
+			r[i][j] = Axes[i].Dot(InBox.Axes[j]);
+			// 평행한 모서리의 외적이 0에 가까워 생기는 오차를 막기 위해 여유값을 더한다.
+			absR[i][j] = Math::Abs(r[i][j]) + 1.e-6f;
+		}
+	}
+
+	const Vector3 worldOffset = InBox.Center - Center;
+	const float t[3] = { worldOffset.Dot(Axes[0]), worldOffset.Dot(Axes[1]), worldOffset.Dot(Axes[2]) };
+	const Vector3& a = Extent;
+	const Vector3& b = InBox.Extent;
+
+	// 이 박스의 면 법선
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		const float rb = b.X * absR[i][0] + b.Y * absR[i][1] + b.Z * absR[i][2];
+		if (Math::Abs(t[i]) > a[i] + rb)
+		{
+			return false;
+		}
+	}
+
+	// 상대 박스의 면 법선
+	for (BYTE j = 0; j < 3; ++j)
+	{
+		const float ra = a.X * absR[0][j] + a.Y * absR[1][j] + a.Z * absR[2][j];
+		if (Math::Abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ra + b[j])
+		{
+			return false;
+		}
+	}
+
+	// 모서리 쌍의 외적 Axes[i] x InBox.Axes[j]
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		const BYTE i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+		for (BYTE j = 0; j < 3; ++j)
+		{
+			const BYTE j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			const float ra = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+			const float rb = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+			if (Math::Abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,188 @@
+#include "Precompiled.h"
+using namespace CK;
+
+static_assert(sizeof(Half) == 2, "Half must be 16 bits");
+static_assert(sizeof(Half4) == 8, "Half4 must be four packed halves");
+static_assert(sizeof(SNorm16x4) == 8, "SNorm16x4 must be four packed 16-bit integers");
+static_assert(sizeof(UNorm8x4) == 4, "UNorm8x4 must be four packed bytes");
+
+// 한 번에 처리하는 레인의 수
+static constexpr size_t BatchLanes = 4;
+
+#if defined(CK_SIMD_SSE)
+
+// 네 개의 float를 half로 변환. 결과는 32비트 레인의 하위 16비트에 부호 확장된 상태로 담긴다.
+static FORCEINLINE __m128i FloatToHalfSSE(__m128 InValue)
+{
+	const __m128i signMask = _mm_set1_epi32(0x80000000);
+	const __m128i f16Max = _mm_set1_epi32((127 + 16) << 23);
+	const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+	const __m128i denormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+	const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+	const __m128 sign = _mm_and_ps(_mm_castsi128_ps(signMask), InValue);
+	const __m128 absValue = _mm_xor_ps(InValue, sign);
+	const __m128i absBits = _mm_castps_si128(absValue);
+
+	// 무한대와 NaN
+	const __m128i isNaN = _mm_castps_si128(_mm_cmpunord_ps(absValue, absValue));
+	const __m128i isRegular = _mm_cmpgt_epi32(f16Max, absBits);
+	const __m128i infOrNaN = _mm_or_si128(_mm_and_si128(isNaN, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7C00));
+
+	// 비정규화 수는 덧셈으로 가수를 정렬해 반올림
+	const __m128i isDenormal = _mm_cmpgt_epi32(minNormal, absBits);
+	const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absValue, _mm_castsi128_ps(denormalMagic))), denormalMagic);
+
+	// 정규화 수는 가수의 최하위 비트가 홀수일 때 올림 쪽으로 보정
+	const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absBits, 31 - 13), 31);
+	const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absBits, normalBias), mantissaOdd), 13);
+
+	const __m128i finite = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+	const __m128i joined = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infOrNaN));
+	return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+
+// 32비트 레인의 하위 16비트에 담긴 half 네 개를 float로 변환
+static FORCEINLINE __m128 HalfToFloatSSE(__m128i InBits)
+{
+	const __m128i expMantissa = _mm_and_si128(InBits, _mm_set1_epi32(0x7FFF));
+	const __m128i sign = _mm_slli_epi32(_mm_xor_si128(InBits, expMantissa), 16);
+
+	// 지수 편향을 곱셈으로 보정하면 비정규화 수도 함께 처리된다.
+	const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+	const __m128i wasInfNaN = _mm_cmpgt_epi32(expMantissa, _mm_set1_epi32(0x7BFF));
+	const __m128 infNaNExponent = _mm_and_ps(_mm_castsi128_ps(wasInfNaN), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+	return _mm_or_ps(scaled, _mm_or_ps(_mm_castsi128_ps(sign), infNaNExponent));
+}
+
+#endif
+
+void Half::Pack(const float* InValues, Half* OutValues, size_t InCount)
+{
+	size_t i = 0;
+#if defined(CK_SIMD_SSE)
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const __m128i bits = FloatToHalfSSE(_mm_loadu_ps(InValues + i));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(OutValues + i), _mm_packs_epi32(bits, bits));
+	}
+#elif defined(CK_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const float16x4_t halves = vcvt_f16_f32(vld1q_f32(InValues + i));
+		vst1_u16(reinterpret_cast<uint16_t*>(OutValues + i), vreinterpret_u16_f16(halves));
+	}
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		OutValues[i].Bits = FromFloat(InValues[i]);
+	}
+}
+
+void Half::Unpack(const Half* InValues, float* OutValues, size_t InCount)
+{
+	size_t i = 0;
+#if defined(CK_SIMD_SSE)
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const __m128i bits = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(InValues + i));
+		_mm_storeu_ps(OutValues + i, HalfToFloatSSE(_mm_unpacklo_epi16(bits, _mm_setzero_si128())));
+	}
+#elif defined(CK_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const uint16x4_t bits = vld1_u16(reinterpret_cast<const uint16_t*>(InValues + i));
+		vst1q_f32(OutValues + i, vcvt_f32_f16(vreinterpret_f16_u16(bits)));
+	}
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		OutValues[i] = ToFloat(InValues[i].Bits);
+	}
+}
+
+void SNorm16x4::Pack(const Vector4* InVectors, SNorm16x4* OutValues, size_t InCount)
+{
+	size_t i = 0;
+#if defined(CK_SIMD_SSE)
+	// 두 개의 벡터를 하나의 레지스터로 포화 변환
+	const __m128 minValue = _mm_set1_ps(-1.f);
+	const __m128 maxValue = _mm_set1_ps(1.f);
+	const __m128 scale = _mm_set1_ps(32767.f);
+	for (; i + 2 <= InCount; i += 2)
+	{
+		const __m128 v0 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(InVectors[i].Scalars.data()), minValue), maxValue);
+		const __m128 v1 = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(InVectors[i + 1].Scalars.data()), minValue), maxValue);
+		const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(v0, scale)), _mm_cvtps_epi32(_mm_mul_ps(v1, scale)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(OutValues + i), packed);
+	}
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		OutValues[i] = SNorm16x4(InVectors[i]);
+	}
+}
+
+void SNorm16x4::Unpack(const SNorm16x4* InValues, Vector4* OutVectors, size_t InCount)
+{
+	for (size_t i = 0; i < InCount; ++i)
+	{
+		OutVectors[i] = InValues[i].ToVector4();
+	}
+}
+
+void UNorm8x4::Pack(const Vector4* InVectors, UNorm8x4* OutValues, size_t InCount)
+{
+	size_t i = 0;
+#if defined(CK_SIMD_SSE)
+	// 네 개의 벡터를 하나의 레지스터로 포화 변환
+	const __m128 minValue = _mm_setzero_ps();
+	const __m128 maxValue = _mm_set1_ps(1.f);
+	const __m128 scale = _mm_set1_ps(255.f);
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		__m128i converted[BatchLanes];
+		for (size_t lane = 0; lane < BatchLanes; ++lane)
+		{
+			const __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(InVectors[i + lane].Scalars.data()), minValue), maxValue);
+			converted[lane] = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+		}
+
+		const __m128i low = _mm_packs_epi32(converted[0], converted[1]);
+		const __m128i high = _mm_packs_epi32(converted[2], converted[3]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(OutValues + i), _mm_packus_epi16(low, high));
+	}
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		OutValues[i] = UNorm8x4(InVectors[i]);
+	}
+}
+
+void UNorm8x4::Unpack(const UNorm8x4* InValues, Vector4* OutVectors, size_t InCount)
+{
+	size_t i = 0;
+#if defined(CK_SIMD_SSE)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 scale = _mm_set1_ps(1.f / 255.f);
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InValues + i));
+		const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+		const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+		_mm_storeu_ps(OutVectors[i].Scalars.data(), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+		_mm_storeu_ps(OutVectors[i + 1].Scalars.data(), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+		_mm_storeu_ps(OutVectors[i + 2].Scalars.data(), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+		_mm_storeu_ps(OutVectors[i + 3].Scalars.data(), _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+	}
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		OutVectors[i] = InValues[i].ToVector4();
+	}
+}
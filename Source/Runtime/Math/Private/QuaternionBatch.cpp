@@ -0,0 +1,234 @@
+#include "Precompiled.h"
+using namespace CK;
+
+static_assert(sizeof(Quaternion) == sizeof(float) * 4, "Quaternion must be four packed floats");
+
+// 한 번에 처리하는 레인의 수
+static constexpr size_t BatchLanes = 4;
+
+// 성분별로 나눈 사원수 네 개
+struct QuaternionRegister
+{
+	VectorRegister X, Y, Z, W;
+};
+
+// 네 개의 사원수를 읽어 성분별로 전치. 남은 개수가 모자라면 항등 사원수로 채운다.
+static FORCEINLINE QuaternionRegister LoadQuaternions(const Quaternion* InPtr, size_t InCount)
+{
+	Quaternion padded[BatchLanes] = { Quaternion::Identity, Quaternion::Identity, Quaternion::Identity, Quaternion::Identity };
+	if (InCount < BatchLanes)
+	{
+		std::copy(InPtr, InPtr + InCount, padded);
+		InPtr = padded;
+	}
+
+	QuaternionRegister result{ VectorLoad(&InPtr[0].X), VectorLoad(&InPtr[1].X), VectorLoad(&InPtr[2].X), VectorLoad(&InPtr[3].X) };
+	VectorTranspose4x4(result.X, result.Y, result.Z, result.W);
+	return result;
+}
+
+static FORCEINLINE void StoreQuaternions(QuaternionRegister InQuaternions, Quaternion* OutPtr, size_t InCount)
+{
+	VectorTranspose4x4(InQuaternions.X, InQuaternions.Y, InQuaternions.Z, InQuaternions.W);
+
+	Quaternion padded[BatchLanes];
+	Quaternion* target = (InCount < BatchLanes) ? padded : OutPtr;
+	VectorStore(InQuaternions.X, &target[0].X);
+	VectorStore(InQuaternions.Y, &target[1].X);
+	VectorStore(InQuaternions.Z, &target[2].X);
+	VectorStore(InQuaternions.W, &target[3].X);
+
+	if (InCount < BatchLanes)
+	{
+		std::copy(padded, padded + InCount, OutPtr);
+	}
+}
+
+static FORCEINLINE VectorRegister LoadFloats(const float* InPtr, size_t InCount)
+{
+	if (InCount < BatchLanes)
+	{
+		float padded[BatchLanes] = { 0.f, 0.f, 0.f, 0.f };
+		std::copy(InPtr, InPtr + InCount, padded);
+		return VectorLoad(padded);
+	}
+
+	return VectorLoad(InPtr);
+}
+
+static FORCEINLINE void StoreFloats(const VectorRegister& InVector, float* OutPtr, size_t InCount)
+{
+	if (InCount < BatchLanes)
+	{
+		float padded[BatchLanes];
+		VectorStore(InVector, padded);
+		std::copy(padded, padded + InCount, OutPtr);
+		return;
+	}
+
+	VectorStore(InVector, OutPtr);
+}
+
+static FORCEINLINE VectorRegister VectorNegate(const VectorRegister& InVector)
+{
+	return VectorSubtract(VectorZero(), InVector);
+}
+
+static FORCEINLINE VectorRegister Dot(const QuaternionRegister& InQ1, const QuaternionRegister& InQ2)
+{
+	VectorRegister result = VectorMultiply(InQ1.X, InQ2.X);
+	result = VectorMultiplyAdd(InQ1.Y, InQ2.Y, result);
+	result = VectorMultiplyAdd(InQ1.Z, InQ2.Z, result);
+	return VectorMultiplyAdd(InQ1.W, InQ2.W, result);
+}
+
+// InAlpha * InQ1 + InBeta * InQ2
+static FORCEINLINE QuaternionRegister Blend(const QuaternionRegister& InQ1, const QuaternionRegister& InQ2, const VectorRegister& InAlpha, const VectorRegister& InBeta)
+{
+	return QuaternionRegister{
+		VectorMultiplyAdd(InBeta, InQ2.X, VectorMultiply(InAlpha, InQ1.X)),
+		VectorMultiplyAdd(InBeta, InQ2.Y, VectorMultiply(InAlpha, InQ1.Y)),
+		VectorMultiplyAdd(InBeta, InQ2.Z, VectorMultiply(InAlpha, InQ1.Z)),
+		VectorMultiplyAdd(InBeta, InQ2.W, VectorMultiply(InAlpha, InQ1.W))
+	};
+}
+
+// Quaternion::Slerp와 같이 내적이 음수이면 첫 번째 사원수를 뒤집어 최단 경로를 사용. 내적의 절대값을 반환한다.
+static FORCEINLINE VectorRegister AlignHemisphere(QuaternionRegister& InOutQ1, const QuaternionRegister& InQ2)
+{
+	const VectorRegister dot = Dot(InOutQ1, InQ2);
+	const VectorRegister negativeMask = VectorCompareLT(dot, VectorZero());
+	InOutQ1.X = VectorSelect(negativeMask, VectorNegate(InOutQ1.X), InOutQ1.X);
+	InOutQ1.Y = VectorSelect(negativeMask, VectorNegate(InOutQ1.Y), InOutQ1.Y);
+	InOutQ1.Z = VectorSelect(negativeMask, VectorNegate(InOutQ1.Z), InOutQ1.Z);
+	InOutQ1.W = VectorSelect(negativeMask, VectorNegate(InOutQ1.W), InOutQ1.W);
+	return VectorAbs(dot);
+}
+
+static FORCEINLINE QuaternionRegister Normalize(const QuaternionRegister& InQuaternion)
+{
+	const VectorRegister invSize = VectorReciprocalSqrt(Dot(InQuaternion, InQuaternion));
+	return QuaternionRegister{
+		VectorMultiply(InQuaternion.X, invSize),
+		VectorMultiply(InQuaternion.Y, invSize),
+		VectorMultiply(InQuaternion.Z, invSize),
+		VectorMultiply(InQuaternion.W, invSize)
+	};
+}
+
+void QuaternionBatch::Multiply(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, Quaternion* OutQuaternions, size_t InCount)
+{
+	for (size_t i = 0; i < InCount; i += BatchLanes)
+	{
+		const size_t count = Math::Min(BatchLanes, InCount - i);
+		const QuaternionRegister q1 = LoadQuaternions(InQuaternions1 + i, count);
+		const QuaternionRegister q2 = LoadQuaternions(InQuaternions2 + i, count);
+
+		// Quaternion::operator*와 같은 식
+		// W = w1 * w2 - v1.v2, V = v2 * w1 + v1 * w2 + v1 x v2
+		QuaternionRegister result;
+		result.W = VectorSubtract(VectorMultiply(q1.W, q2.W), VectorMultiplyAdd(q1.Z, q2.Z, VectorMultiplyAdd(q1.Y, q2.Y, VectorMultiply(q1.X, q2.X))));
+		result.X = VectorAdd(VectorMultiplyAdd(q2.X, q1.W, VectorMultiply(q1.X, q2.W)), VectorSubtract(VectorMultiply(q1.Y, q2.Z), VectorMultiply(q1.Z, q2.Y)));
+		result.Y = VectorAdd(VectorMultiplyAdd(q2.Y, q1.W, VectorMultiply(q1.Y, q2.W)), VectorSubtract(VectorMultiply(q1.Z, q2.X), VectorMultiply(q1.X, q2.Z)));
+		result.Z = VectorAdd(VectorMultiplyAdd(q2.Z, q1.W, VectorMultiply(q1.Z, q2.W)), VectorSubtract(VectorMultiply(q1.X, q2.Y), VectorMultiply(q1.Y, q2.X)));
+
+		StoreQuaternions(result, OutQuaternions + i, count);
+	}
+}
+
+void QuaternionBatch::RotateVectors(const Quaternion* InQuaternions,
+	const float* InX, const float* InY, const float* InZ,
+	float* OutX, float* OutY, float* OutZ, size_t InCount)
+{
+	const VectorRegister two = VectorSetFloat1(2.f);
+	for (size_t i = 0; i < InCount; i += BatchLanes)
+	{
+		const size_t count = Math::Min(BatchLanes, InCount - i);
+		const QuaternionRegister q = LoadQuaternions(InQuaternions + i, count);
+		const VectorRegister x = LoadFloats(InX + i, count);
+		const VectorRegister y = LoadFloats(InY + i, count);
+		const VectorRegister z = LoadFloats(InZ + i, count);
+
+		// Quaternion::RotateVector와 같은 식
+		// t = 2 * (q x v), v' = v + w * t + q x t
+		const VectorRegister tx = VectorMultiply(two, VectorSubtract(VectorMultiply(q.Y, z), VectorMultiply(q.Z, y)));
+		const VectorRegister ty = VectorMultiply(two, VectorSubtract(VectorMultiply(q.Z, x), VectorMultiply(q.X, z)));
+		const VectorRegister tz = VectorMultiply(two, VectorSubtract(VectorMultiply(q.X, y), VectorMultiply(q.Y, x)));
+
+		StoreFloats(VectorAdd(VectorMultiplyAdd(q.W, tx, x), VectorSubtract(VectorMultiply(q.Y, tz), VectorMultiply(q.Z, ty))), OutX + i, count);
+		StoreFloats(VectorAdd(VectorMultiplyAdd(q.W, ty, y), VectorSubtract(VectorMultiply(q.Z, tx), VectorMultiply(q.X, tz))), OutY + i, count);
+		StoreFloats(VectorAdd(VectorMultiplyAdd(q.W, tz, z), VectorSubtract(VectorMultiply(q.X, ty), VectorMultiply(q.Y, tx))), OutZ + i, count);
+	}
+}
+
+void QuaternionBatch::Nlerp(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, const float* InRatios, Quaternion* OutQuaternions, size_t InCount)
+{
+	const VectorRegister one = VectorSetFloat1(1.f);
+	for (size_t i = 0; i < InCount; i += BatchLanes)
+	{
+		const size_t count = Math::Min(BatchLanes, InCount - i);
+		QuaternionRegister q1 = LoadQuaternions(InQuaternions1 + i, count);
+		const QuaternionRegister q2 = LoadQuaternions(InQuaternions2 + i, count);
+		const VectorRegister ratio = LoadFloats(InRatios + i, count);
+
+		AlignHemisphere(q1, q2);
+		StoreQuaternions(Normalize(Blend(q1, q2, VectorSubtract(one, ratio), ratio)), OutQuaternions + i, count);
+	}
+}
+
+void QuaternionBatch::Slerp(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, const float* InRatios, Quaternion* OutQuaternions, size_t InCount)
+{
+	const VectorRegister one = VectorSetFloat1(1.f);
+	for (size_t i = 0; i < InCount; i += BatchLanes)
+	{
+		const size_t count = Math::Min(BatchLanes, InCount - i);
+		QuaternionRegister q1 = LoadQuaternions(InQuaternions1 + i, count);
+		const QuaternionRegister q2 = LoadQuaternions(InQuaternions2 + i, count);
+		const VectorRegister ratio = LoadFloats(InRatios + i, count);
+		const VectorRegister dot = AlignHemisphere(q1, q2);
+
+		// 사잇각의 사인 값으로 각 사원수의 가중치를 계산
+		const VectorRegister theta = VectorAcos(dot);
+		VectorRegister sinTheta, sinAlpha, sinBeta, unused;
+		VectorSinCos(theta, sinTheta, unused);
+		VectorSinCos(VectorMultiply(VectorSubtract(one, ratio), theta), sinAlpha, unused);
+		VectorSinCos(VectorMultiply(ratio, theta), sinBeta, unused);
+		const VectorRegister invSin = VectorDivide(one, sinTheta);
+
+		// 두 사원수의 사잇각이 작으면 선형 보간으로 수행
+		const VectorRegister linearMask = VectorCompareGT(dot, VectorSetFloat1(0.9995f));
+		const VectorRegister alpha = VectorSelect(linearMask, VectorSubtract(one, ratio), VectorMultiply(sinAlpha, invSin));
+		const VectorRegister beta = VectorSelect(linearMask, ratio, VectorMultiply(sinBeta, invSin));
+
+		StoreQuaternions(Blend(q1, q2, alpha, beta), OutQuaternions + i, count);
+	}
+}
+
+void QuaternionBatch::FastSlerp(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, const float* InRatios, Quaternion* OutQuaternions, size_t InCount)
+{
+	const VectorRegister one = VectorSetFloat1(1.f);
+	const VectorRegister half = VectorSetFloat1(0.5f);
+	for (size_t i = 0; i < InCount; i += BatchLanes)
+	{
+		const size_t count = Math::Min(BatchLanes, InCount - i);
+		QuaternionRegister q1 = LoadQuaternions(InQuaternions1 + i, count);
+		const QuaternionRegister q2 = LoadQuaternions(InQuaternions2 + i, count);
+		const VectorRegister ratio = LoadFloats(InRatios + i, count);
+		const VectorRegister d = AlignHemisphere(q1, q2);
+
+		// Nlerp의 각속도 편차를 상쇄하도록 비율을 보정
+		// t' = t + t * (t - 0.5) * (t - 1) * k, k = A * (t - 0.5)^2 + B
+		VectorRegister a = VectorMultiplyAdd(VectorSetFloat1(-1.43519f), d, VectorSetFloat1(3.55645f));
+		a = VectorMultiplyAdd(a, d, VectorSetFloat1(-3.2452f));
+		a = VectorMultiplyAdd(a, d, VectorSetFloat1(1.0904f));
+		VectorRegister b = VectorMultiplyAdd(VectorSetFloat1(0.215638f), d, VectorSetFloat1(-1.06021f));
+		b = VectorMultiplyAdd(b, d, VectorSetFloat1(0.848013f));
+
+		const VectorRegister centered = VectorSubtract(ratio, half);
+		const VectorRegister k = VectorMultiplyAdd(a, VectorMultiply(centered, centered), b);
+		const VectorRegister correction = VectorMultiply(VectorMultiply(ratio, centered), VectorSubtract(ratio, one));
+		const VectorRegister correctedRatio = VectorMultiplyAdd(correction, k, ratio);
+
+		StoreQuaternions(Normalize(Blend(q1, q2, VectorSubtract(one, correctedRatio), correctedRatio)), OutQuaternions + i, count);
+	}
+}
@@ -0,0 +1,131 @@
+#include "Precompiled.h"
+using namespace CK;
+
+// 역수를 구할 때 0 대신 사용할 값. 무한대와 0을 곱해 NaN이 생기지 않도록 한다.
+static constexpr float MinDirectionComponent = 1.e-20f;
+
+RayPacket::RayPacket(const Ray* InRays, size_t InCount)
+{
+	assert(InCount > 0 && InCount <= Lanes);
+
+	// 남는 레인은 첫 반직선으로 채우고 마스크로 제외
+	float values[9][Lanes];
+	for (BYTE lane = 0; lane < Lanes; ++lane)
+	{
+		const Ray& ray = InRays[(lane < InCount) ? lane : 0];
+		for (BYTE i = 0; i < 3; ++i)
+		{
+			const float direction = ray.Direction[i];
+			const float safeDirection = (Math::Abs(direction) < MinDirectionComponent) ? ((direction < 0.f) ? -MinDirectionComponent : MinDirectionComponent) : direction;
+			values[i][lane] = ray.Origin[i];
+			values[3 + i][lane] = direction;
+			values[6 + i][lane] = 1.f / safeDirection;
+		}
+	}
+
+	VectorRegister* streams[9] = { &OriginX, &OriginY, &OriginZ, &DirectionX, &DirectionY, &DirectionZ, &InvDirectionX, &InvDirectionY, &InvDirectionZ };
+	for (BYTE i = 0; i < 9; ++i)
+	{
+		*streams[i] = VectorLoad(values[i]);
+	}
+
+	ActiveMask = (1 << InCount) - 1;
+}
+
+int RayPacket::Intersect(const Sphere& InSphere, const VectorRegister& InMaxDistance, VectorRegister& OutDistance) const
+{
+	const VectorRegister zero = VectorZero();
+	const VectorRegister mx = VectorSubtract(OriginX, VectorSetFloat1(InSphere.Center.X));
+	const VectorRegister my = VectorSubtract(OriginY, VectorSetFloat1(InSphere.Center.Y));
+	const VectorRegister mz = VectorSubtract(OriginZ, VectorSetFloat1(InSphere.Center.Z));
+
+	const VectorRegister a = VectorMultiplyAdd(DirectionZ, DirectionZ, VectorMultiplyAdd(DirectionY, DirectionY, VectorMultiply(DirectionX, DirectionX)));
+	const VectorRegister b = VectorMultiplyAdd(mz, DirectionZ, VectorMultiplyAdd(my, DirectionY, VectorMultiply(mx, DirectionX)));
+	const VectorRegister c = VectorSubtract(VectorMultiplyAdd(mz, mz, VectorMultiplyAdd(my, my, VectorMultiply(mx, mx))), VectorSetFloat1(InSphere.Radius * InSphere.Radius));
+	const VectorRegister discriminant = VectorSubtract(VectorMultiply(b, b), VectorMultiply(a, c));
+
+	// 판별식이 음수인 레인은 제곱근이 NaN이 되지만 마스크로 걸러진다.
+	const VectorRegister t = VectorMax(VectorDivide(VectorSubtract(VectorSubtract(zero, b), VectorSqrt(VectorMax(discriminant, zero))), a), zero);
+
+	// 구 밖에서 멀어지는 경우, 판별식이 음수인 경우, 최대 거리보다 먼 경우를 제외
+	VectorRegister miss = VectorBitwiseAnd(VectorCompareGT(c, zero), VectorCompareGT(b, zero));
+	miss = VectorBitwiseOr(miss, VectorCompareLT(discriminant, zero));
+	miss = VectorBitwiseOr(miss, VectorCompareGT(t, InMaxDistance));
+	miss = VectorBitwiseOr(miss, VectorCompareGT(VectorSetFloat1(SMALL_NUMBER), a));
+
+	OutDistance = t;
+	return ~VectorMaskBits(miss) & ActiveMask;
+}
+
+int RayPacket::Intersect(const Box& InBox, const VectorRegister& InMaxDistance, VectorRegister& OutDistance) const
+{
+	// 축마다 두 평면까지의 거리를 구해 가까운 쪽의 최대값과 먼 쪽의 최소값을 누적
+	const VectorRegister t1x = VectorMultiply(VectorSubtract(VectorSetFloat1(InBox.Min.X), OriginX), InvDirectionX);
+	const VectorRegister t2x = VectorMultiply(VectorSubtract(VectorSetFloat1(InBox.Max.X), OriginX), InvDirectionX);
+	const VectorRegister t1y = VectorMultiply(VectorSubtract(VectorSetFloat1(InBox.Min.Y), OriginY), InvDirectionY);
+	const VectorRegister t2y = VectorMultiply(VectorSubtract(VectorSetFloat1(InBox.Max.Y), OriginY), InvDirectionY);
+	const VectorRegister t1z = VectorMultiply(VectorSubtract(VectorSetFloat1(InBox.Min.Z), OriginZ), InvDirectionZ);
+	const VectorRegister t2z = VectorMultiply(VectorSubtract(VectorSetFloat1(InBox.Max.Z), OriginZ), InvDirectionZ);
+
+	VectorRegister tMin = VectorMax(VectorMax(VectorMin(t1x, t2x), VectorMin(t1y, t2y)), VectorMin(t1z, t2z));
+	VectorRegister tMax = VectorMin(VectorMin(VectorMax(t1x, t2x), VectorMax(t1y, t2y)), VectorMax(t1z, t2z));
+
+	// 시작점 이후, 최대 거리 이전의 구간만 사용
+	tMin = VectorMax(tMin, VectorZero());
+	tMax = VectorMin(tMax, InMaxDistance);
+
+	OutDistance = tMin;
+	return ~VectorMaskBits(VectorCompareGT(tMin, tMax)) & ActiveMask;
+}
+
+int RayPacket::IntersectTriangle(const Vector3& InV0, const Vector3& InV1, const Vector3& InV2, VectorRegister& InOutDistance, VectorRegister& InOutU, VectorRegister& InOutV) const
+{
+	// 삼각형은 모든 레인이 공유하므로 모서리는 스칼라로 구해 복제
+	const Vector3 edge1 = InV1 - InV0;
+	const Vector3 edge2 = InV2 - InV0;
+	const VectorRegister e1x = VectorSetFloat1(edge1.X), e1y = VectorSetFloat1(edge1.Y), e1z = VectorSetFloat1(edge1.Z);
+	const VectorRegister e2x = VectorSetFloat1(edge2.X), e2y = VectorSetFloat1(edge2.Y), e2z = VectorSetFloat1(edge2.Z);
+
+	// p = Direction x edge2
+	const VectorRegister px = VectorSubtract(VectorMultiply(DirectionY, e2z), VectorMultiply(DirectionZ, e2y));
+	const VectorRegister py = VectorSubtract(VectorMultiply(DirectionZ, e2x), VectorMultiply(DirectionX, e2z));
+	const VectorRegister pz = VectorSubtract(VectorMultiply(DirectionX, e2y), VectorMultiply(DirectionY, e2x));
+	const VectorRegister determinant = VectorMultiplyAdd(e1z, pz, VectorMultiplyAdd(e1y, py, VectorMultiply(e1x, px)));
+	const VectorRegister invDeterminant = VectorDivide(VectorSetFloat1(1.f), determinant);
+
+	// s = Origin - V0
+	const VectorRegister sx = VectorSubtract(OriginX, VectorSetFloat1(InV0.X));
+	const VectorRegister sy = VectorSubtract(OriginY, VectorSetFloat1(InV0.Y));
+	const VectorRegister sz = VectorSubtract(OriginZ, VectorSetFloat1(InV0.Z));
+	const VectorRegister u = VectorMultiply(VectorMultiplyAdd(sz, pz, VectorMultiplyAdd(sy, py, VectorMultiply(sx, px))), invDeterminant);
+
+	// q = s x edge1
+	const VectorRegister qx = VectorSubtract(VectorMultiply(sy, e1z), VectorMultiply(sz, e1y));
+	const VectorRegister qy = VectorSubtract(VectorMultiply(sz, e1x), VectorMultiply(sx, e1z));
+	const VectorRegister qz = VectorSubtract(VectorMultiply(sx, e1y), VectorMultiply(sy, e1x));
+	const VectorRegister v = VectorMultiply(VectorMultiplyAdd(DirectionZ, qz, VectorMultiplyAdd(DirectionY, qy, VectorMultiply(DirectionX, qx))), invDeterminant);
+	const VectorRegister t = VectorMultiply(VectorMultiplyAdd(e2z, qz, VectorMultiplyAdd(e2y, qy, VectorMultiply(e2x, qx))), invDeterminant);
+
+	// 스칼라 버전과 같은 조건을 모두 마스크로 계산. 평행해서 역수가 무한대인 레인은 행렬식 검사로 걸러진다.
+	const VectorRegister zero = VectorZero();
+	const VectorRegister one = VectorSetFloat1(1.f);
+	VectorRegister miss = VectorCompareGT(VectorSetFloat1(SMALL_NUMBER), VectorAbs(determinant));
+	miss = VectorBitwiseOr(miss, VectorCompareLT(u, zero));
+	miss = VectorBitwiseOr(miss, VectorCompareGT(u, one));
+	miss = VectorBitwiseOr(miss, VectorCompareLT(v, zero));
+	miss = VectorBitwiseOr(miss, VectorCompareGT(VectorAdd(u, v), one));
+	miss = VectorBitwiseOr(miss, VectorCompareLT(t, zero));
+	miss = VectorBitwiseOr(miss, VectorCompareLT(InOutDistance, t));
+
+	const int hitMask = ~VectorMaskBits(miss) & ActiveMask;
+	if (hitMask == 0)
+	{
+		return 0;
+	}
+
+	// 교차하지 않은 레인은 기존 값을 유지. 사용하지 않는 레인은 결과를 읽지 않으므로 구분하지 않는다.
+	InOutDistance = VectorSelect(miss, InOutDistance, t);
+	InOutU = VectorSelect(miss, InOutU, u);
+	InOutV = VectorSelect(miss, InOutV, v);
+	return hitMask;
+}
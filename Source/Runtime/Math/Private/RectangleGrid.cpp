@@ -0,0 +1,109 @@
+#include "Precompiled.h"
+using namespace CK;
+
+int RectangleGrid::Insert(const Rectangle& InRectangle, void* InUserData)
+{
+	int proxyIndex = InvalidIndex;
+	if (_FreeList == InvalidIndex)
+	{
+		proxyIndex = static_cast<int>(_Proxies.size());
+		_Proxies.emplace_back();
+	}
+	else
+	{
+		proxyIndex = _FreeList;
+		_FreeList = _Proxies[proxyIndex].NextFree;
+	}
+
+	Proxy& proxy = _Proxies[proxyIndex];
+	proxy.Bound = InRectangle;
+	proxy.UserData = InUserData;
+	proxy.Cells = GetCellRange(InRectangle);
+	proxy.NextFree = InvalidIndex;
+	proxy.IsUsed = true;
+
+	AddToCells(proxyIndex, proxy.Cells);
+	++_ProxyCount;
+	return proxyIndex;
+}
+
+void RectangleGrid::Remove(int InProxy)
+{
+	assert(IsValidProxy(InProxy));
+	Proxy& proxy = _Proxies[InProxy];
+	RemoveFromCells(InProxy, proxy.Cells);
+
+	proxy.UserData = nullptr;
+	proxy.IsUsed = false;
+	proxy.NextFree = _FreeList;
+	_FreeList = InProxy;
+	--_ProxyCount;
+}
+
+bool RectangleGrid::Move(int InProxy, const Rectangle& InRectangle)
+{
+	assert(IsValidProxy(InProxy));
+	Proxy& proxy = _Proxies[InProxy];
+	proxy.Bound = InRectangle;
+
+	const CellRange newRange = GetCellRange(InRectangle);
+	if (newRange == proxy.Cells)
+	{
+		return false;
+	}
+
+	RemoveFromCells(InProxy, proxy.Cells);
+	proxy.Cells = newRange;
+	AddToCells(InProxy, newRange);
+	return true;
+}
+
+void RectangleGrid::Clear()
+{
+	_Proxies.clear();
+	_Cells.clear();
+	_FreeList = InvalidIndex;
+	_ProxyCount = 0;
+}
+
+RectangleGrid::CellRange RectangleGrid::GetCellRange(const Rectangle& InRectangle) const
+{
+	CellRange result;
+	result.MinX = Math::FloorToInt(InRectangle.Min.X * _InvCellSize);
+	result.MinY = Math::FloorToInt(InRectangle.Min.Y * _InvCellSize);
+	result.MaxX = Math::FloorToInt(InRectangle.Max.X * _InvCellSize);
+	result.MaxY = Math::FloorToInt(InRectangle.Max.Y * _InvCellSize);
+	return result;
+}
+
+void RectangleGrid::AddToCells(int InProxy, const CellRange& InRange)
+{
+	for (int y = InRange.MinY; y <= InRange.MaxY; ++y)
+	{
+		for (int x = InRange.MinX; x <= InRange.MaxX; ++x)
+		{
+			_Cells[GetCellKey(x, y)].push_back(InProxy);
+		}
+	}
+}
+
+void RectangleGrid::RemoveFromCells(int InProxy, const CellRange& InRange)
+{
+	for (int y = InRange.MinY; y <= InRange.MaxY; ++y)
+	{
+		for (int x = InRange.MinX; x <= InRange.MaxX; ++x)
+		{
+			const auto it = _Cells.find(GetCellKey(x, y));
+			assert(it != _Cells.end());
+			std::vector<int>& cell = it->second;
+
+			// 칸 안의 순서는 의미가 없으므로 마지막 항목과 바꾼 후 제거
+			const auto proxyIt = std::find(cell.begin(), cell.end(), InProxy);
+			assert(proxyIt != cell.end());
+			*proxyIt = cell.back();
+			cell.pop_back();
+
+			// 비어도 칸은 지우지 않는다. 물체가 칸을 오가도 칸과 목록의 용량을 재사용하므로 할당이 일어나지 않는다.
+		}
+	}
+}
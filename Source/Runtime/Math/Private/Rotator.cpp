@@ -2,8 +2,6 @@
 #include "Precompiled.h"
 using namespace CK;
 
-const Rotator Rotator::Identity(0.f, 0.f, 0.f);
-
 std::string Rotator::ToString() const
 {
 	char result[64];
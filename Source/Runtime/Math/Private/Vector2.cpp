@@ -2,30 +2,9 @@
 #include "Precompiled.h"
 using namespace CK;
 
-const Vector2 Vector2::UnitX(1.f, 0.f);
-const Vector2 Vector2::UnitY(0.f, 1.f);
-const Vector2 Vector2::Zero(0.f, 0.f);
-const Vector2 Vector2::One(1.f, 1.f);
-
 std::string Vector2::ToString() const
 {
 	char result[64];
 	std::snprintf(result, sizeof(result), "(%.3f, %.3f)", X, Y);
 	return result;
 }
-
-Vector2 Vector2::GetNormalize() const
-{
-	float squareSum = SizeSquared();
-	if (squareSum == 1.f)
-	{
-		return *this;
-	}
-	else if (squareSum == 0.f)
-	{
-		return Vector2::Zero;
-	}
-
-	float invLength = Math::InvSqrt(squareSum);
-	return Vector2(X, Y) * invLength;
-}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "Precompiled.h"
+using namespace CK;
+
+// 한 번에 처리하는 레인의 수
+static constexpr size_t BatchLanes = 4;
+
+void VectorBatch::Transform(const Matrix4x4& InMatrix,
+	const float* InX, const float* InY, const float* InZ, const float* InW,
+	float* OutX, float* OutY, float* OutZ, float* OutW, size_t InCount)
+{
+	// 행렬의 각 원소를 레지스터에 복제해두고 네 개의 점을 한 번에 계산
+	VectorRegister m[4][4];
+	for (BYTE c = 0; c < Matrix4x4::Rank; ++c)
+	{
+		for (BYTE r = 0; r < Matrix4x4::Rank; ++r)
+		{
+			m[c][r] = VectorSetFloat1(InMatrix.Cols[c].Scalars[r]);
+		}
+	}
+
+	size_t i = 0;
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const VectorRegister x = VectorLoad(InX + i);
+		const VectorRegister y = VectorLoad(InY + i);
+		const VectorRegister z = VectorLoad(InZ + i);
+		const VectorRegister w = VectorLoad(InW + i);
+
+		VectorRegister result[4];
+		for (BYTE r = 0; r < Matrix4x4::Rank; ++r)
+		{
+			result[r] = VectorMultiply(m[0][r], x);
+			result[r] = VectorMultiplyAdd(m[1][r], y, result[r]);
+			result[r] = VectorMultiplyAdd(m[2][r], z, result[r]);
+			result[r] = VectorMultiplyAdd(m[3][r], w, result[r]);
+		}
+
+		VectorStore(result[0], OutX + i);
+		VectorStore(result[1], OutY + i);
+		VectorStore(result[2], OutZ + i);
+		VectorStore(result[3], OutW + i);
+	}
+
+	// 남은 점은 하나씩 계산
+	for (; i < InCount; ++i)
+	{
+		Vector4 v = InMatrix * Vector4(InX[i], InY[i], InZ[i], InW[i]);
+		OutX[i] = v.X;
+		OutY[i] = v.Y;
+		OutZ[i] = v.Z;
+		OutW[i] = v.W;
+	}
+}
+
+void VectorBatch::Transform(const Matrix3x3& InMatrix,
+	const float* InX, const float* InY, const float* InZ,
+	float* OutX, float* OutY, float* OutZ, size_t InCount)
+{
+	VectorRegister m[3][3];
+	for (BYTE c = 0; c < Matrix3x3::Rank; ++c)
+	{
+		for (BYTE r = 0; r < Matrix3x3::Rank; ++r)
+		{
+			m[c][r] = VectorSetFloat1(InMatrix.Cols[c].Scalars[r]);
+		}
+	}
+
+	size_t i = 0;
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const VectorRegister x = VectorLoad(InX + i);
+		const VectorRegister y = VectorLoad(InY + i);
+		const VectorRegister z = VectorLoad(InZ + i);
+
+		VectorRegister result[3];
+		for (BYTE r = 0; r < Matrix3x3::Rank; ++r)
+		{
+			result[r] = VectorMultiply(m[0][r], x);
+			result[r] = VectorMultiplyAdd(m[1][r], y, result[r]);
+			result[r] = VectorMultiplyAdd(m[2][r], z, result[r]);
+		}
+
+		VectorStore(result[0], OutX + i);
+		VectorStore(result[1], OutY + i);
+		VectorStore(result[2], OutZ + i);
+	}
+
+	for (; i < InCount; ++i)
+	{
+		Vector3 v = InMatrix * Vector3(InX[i], InY[i], InZ[i]);
+		OutX[i] = v.X;
+		OutY[i] = v.Y;
+		OutZ[i] = v.Z;
+	}
+}
+
+void VectorBatch::TransformPoints(const Matrix3x3& InMatrix,
+	const float* InX, const float* InY,
+	float* OutX, float* OutY, size_t InCount)
+{
+	// Z가 1이므로 세 번째 열은 곱하지 않고 더하기만 한다.
+	const VectorRegister m00 = VectorSetFloat1(InMatrix.Cols[0].X);
+	const VectorRegister m01 = VectorSetFloat1(InMatrix.Cols[0].Y);
+	const VectorRegister m10 = VectorSetFloat1(InMatrix.Cols[1].X);
+	const VectorRegister m11 = VectorSetFloat1(InMatrix.Cols[1].Y);
+	const VectorRegister m20 = VectorSetFloat1(InMatrix.Cols[2].X);
+	const VectorRegister m21 = VectorSetFloat1(InMatrix.Cols[2].Y);
+
+	size_t i = 0;
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const VectorRegister x = VectorLoad(InX + i);
+		const VectorRegister y = VectorLoad(InY + i);
+
+		VectorStore(VectorMultiplyAdd(m10, y, VectorMultiplyAdd(m00, x, m20)), OutX + i);
+		VectorStore(VectorMultiplyAdd(m11, y, VectorMultiplyAdd(m01, x, m21)), OutY + i);
+	}
+
+	for (; i < InCount; ++i)
+	{
+		Vector2 v = InMatrix * Vector2(InX[i], InY[i]);
+		OutX[i] = v.X;
+		OutY[i] = v.Y;
+	}
+}
+
+void VectorBatch::TransformPoints(const Affine3x4& InAffine,
+	const float* InX, const float* InY, const float* InZ,
+	float* OutX, float* OutY, float* OutZ, size_t InCount)
+{
+	VectorRegister m[3][4];
+	for (BYTE r = 0; r < Affine3x4::Rank; ++r)
+	{
+		for (BYTE c = 0; c < 4; ++c)
+		{
+			m[r][c] = VectorSetFloat1(InAffine.Rows[r].Scalars[c]);
+		}
+	}
+
+	size_t i = 0;
+	for (; i + BatchLanes <= InCount; i += BatchLanes)
+	{
+		const VectorRegister x = VectorLoad(InX + i);
+		const VectorRegister y = VectorLoad(InY + i);
+		const VectorRegister z = VectorLoad(InZ + i);
+
+		VectorRegister result[3];
+		for (BYTE r = 0; r < Affine3x4::Rank; ++r)
+		{
+			result[r] = VectorMultiplyAdd(m[r][0], x, m[r][3]);
+			result[r] = VectorMultiplyAdd(m[r][1], y, result[r]);
+			result[r] = VectorMultiplyAdd(m[r][2], z, result[r]);
+		}
+
+		VectorStore(result[0], OutX + i);
+		VectorStore(result[1], OutY + i);
+		VectorStore(result[2], OutZ + i);
+	}
+
+	for (; i < InCount; ++i)
+	{
+		Vector3 v = InAffine.TransformPoint(Vector3(InX[i], InY[i], InZ[i]));
+		OutX[i] = v.X;
+		OutY[i] = v.Y;
+		OutZ[i] = v.Z;
+	}
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+namespace CK
+{
+
+// 마지막 행이 (0, 0, 0, 1)인 아핀 변환 행렬. 마지막 행을 생략하고 세 개의 행만 저장한다. (48바이트)
+struct alignas(16) Affine3x4
+{
+public:
+	// 생성자 
+	FORCEINLINE constexpr Affine3x4() = default;
+	FORCEINLINE explicit constexpr Affine3x4(const Vector4& InRow0, const Vector4& InRow1, const Vector4& InRow2) { Rows = { InRow0, InRow1, InRow2 }; }
+	FORCEINLINE explicit constexpr Affine3x4(const Matrix4x4& InMatrix);
+	FORCEINLINE explicit constexpr Affine3x4(const Transform& InTransform);
+
+	// 연산자 
+	FORCEINLINE constexpr Affine3x4 operator*(const Affine3x4& InAffine) const;
+
+	// 멤버함수 
+	FORCEINLINE constexpr Vector3 TransformPoint(const Vector3& InPoint) const;
+	FORCEINLINE constexpr Vector3 TransformVector(const Vector3& InVector) const;
+	FORCEINLINE constexpr Vector3 GetOrigin() const { return Vector3(Rows[0].W, Rows[1].W, Rows[2].W); }
+	FORCEINLINE constexpr Affine3x4 Inverse() const;
+	FORCEINLINE constexpr Matrix4x4 ToMatrix4x4() const;
+
+	std::vector<std::string> ToStrings() const;
+
+	// 정적멤버변수 
+	static const Affine3x4 Identity;
+	static constexpr BYTE Rank = 3;
+
+	// 멤버변수 
+	std::array<Vector4, Rank> Rows = { Vector4::UnitX, Vector4::UnitY, Vector4::UnitZ };
+};
+
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Affine3x4 Affine3x4::Identity(Vector4(1.f, 0.f, 0.f, 0.f), Vector4(0.f, 1.f, 0.f, 0.f), Vector4(0.f, 0.f, 1.f, 0.f));
+
+FORCEINLINE constexpr Affine3x4::Affine3x4(const Matrix4x4& InMatrix)
+{
+	for (BYTE r = 0; r < Rank; ++r)
+	{
+		Rows[r] = Vector4(InMatrix.Cols[0][r], InMatrix.Cols[1][r], InMatrix.Cols[2][r], InMatrix.Cols[3][r]);
+	}
+}
+
+FORCEINLINE constexpr Affine3x4::Affine3x4(const Transform& InTransform)
+{
+	// 사원수를 회전 행렬로 바로 변환해 Transform::GetMatrix의 세 번의 벡터 회전을 대신함
+	const Quaternion& q = InTransform.GetRotation();
+	const Vector3 s = InTransform.GetScale();
+	const Vector3 p = InTransform.GetPosition();
+
+	const float xx = q.X * q.X, yy = q.Y * q.Y, zz = q.Z * q.Z;
+	const float xy = q.X * q.Y, xz = q.X * q.Z, yz = q.Y * q.Z;
+	const float wx = q.W * q.X, wy = q.W * q.Y, wz = q.W * q.Z;
+
+	Rows = {
+		Vector4((1.f - 2.f * (yy + zz)) * s.X, 2.f * (xy - wz) * s.Y, 2.f * (xz + wy) * s.Z, p.X),
+		Vector4(2.f * (xy + wz) * s.X, (1.f - 2.f * (xx + zz)) * s.Y, 2.f * (yz - wx) * s.Z, p.Y),
+		Vector4(2.f * (xz - wy) * s.X, 2.f * (yz + wx) * s.Y, (1.f - 2.f * (xx + yy)) * s.Z, p.Z)
+	};
+}
+
+FORCEINLINE constexpr Affine3x4 Affine3x4::operator*(const Affine3x4& InAffine) const
+{
+	// 결과의 각 행은 오른쪽 행렬의 행을 왼쪽 행렬의 성분으로 섞은 것에 이동 성분을 더한 것
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		Affine3x4 result;
+		for (BYTE r = 0; r < Rank; ++r)
+		{
+			result.Rows[r] = InAffine.Rows[0] * Rows[r].X + InAffine.Rows[1] * Rows[r].Y + InAffine.Rows[2] * Rows[r].Z + Vector4(0.f, 0.f, 0.f, Rows[r].W);
+		}
+		return result;
+	}
+
+	const VectorRegister row0 = VectorLoadAligned(InAffine.Rows[0].Scalars.data());
+	const VectorRegister row1 = VectorLoadAligned(InAffine.Rows[1].Scalars.data());
+	const VectorRegister row2 = VectorLoadAligned(InAffine.Rows[2].Scalars.data());
+	const VectorRegister unitW = VectorSet(0.f, 0.f, 0.f, 1.f);
+
+	Affine3x4 result;
+	for (BYTE r = 0; r < Rank; ++r)
+	{
+		const VectorRegister v = VectorLoadAligned(Rows[r].Scalars.data());
+		VectorStoreAligned(VectorTransformVector(v, row0, row1, row2, unitW), result.Rows[r].Scalars.data());
+	}
+	return result;
+}
+
+FORCEINLINE constexpr Vector3 Affine3x4::TransformPoint(const Vector3& InPoint) const
+{
+	const Vector4 v(InPoint, true);
+	return Vector3(Rows[0].Dot(v), Rows[1].Dot(v), Rows[2].Dot(v));
+}
+
+FORCEINLINE constexpr Vector3 Affine3x4::TransformVector(const Vector3& InVector) const
+{
+	const Vector4 v(InVector, false);
+	return Vector3(Rows[0].Dot(v), Rows[1].Dot(v), Rows[2].Dot(v));
+}
+
+FORCEINLINE constexpr Affine3x4 Affine3x4::Inverse() const
+{
+	// 3x3 부분의 역행렬은 행 벡터의 외적으로 구한 여인수 행렬을 행렬식으로 나눈 것
+	const Vector3 r0 = Rows[0].ToVector3(), r1 = Rows[1].ToVector3(), r2 = Rows[2].ToVector3();
+	const Vector3 c0 = r1.Cross(r2), c1 = r2.Cross(r0), c2 = r0.Cross(r1);
+	const float det = r0.Dot(c0);
+	if (Math::EqualsInTolerance(det, 0.f))
+	{
+		return Affine3x4();
+	}
+
+	const float invDet = 1.f / det;
+	const Vector3 inv0 = Vector3(c0.X, c1.X, c2.X) * invDet;
+	const Vector3 inv1 = Vector3(c0.Y, c1.Y, c2.Y) * invDet;
+	const Vector3 inv2 = Vector3(c0.Z, c1.Z, c2.Z) * invDet;
+
+	// 이동 성분은 역회전, 역스케일을 적용한 후 부호를 뒤집기
+	const Vector3 t = GetOrigin();
+	return Affine3x4(
+		Vector4(inv0.X, inv0.Y, inv0.Z, -inv0.Dot(t)),
+		Vector4(inv1.X, inv1.Y, inv1.Z, -inv1.Dot(t)),
+		Vector4(inv2.X, inv2.Y, inv2.Z, -inv2.Dot(t))
+	);
+}
+
+FORCEINLINE constexpr Matrix4x4 Affine3x4::ToMatrix4x4() const
+{
+	return Matrix4x4(
+		Vector4(Rows[0].X, Rows[1].X, Rows[2].X, 0.f),
+		Vector4(Rows[0].Y, Rows[1].Y, Rows[2].Y, 0.f),
+		Vector4(Rows[0].Z, Rows[1].Z, Rows[2].Z, 0.f),
+		Vector4(Rows[0].W, Rows[1].W, Rows[2].W, 1.f)
+	);
+}
+
+}
@@ -9,7 +9,7 @@ public:
 	FORCEINLINE constexpr Box() = default;
 	FORCEINLINE constexpr Box(const Box& InBox) : Min(InBox.Min), Max(InBox.Max) { }
 	FORCEINLINE constexpr Box(const Vector3& InMinVector, const Vector3& InMaxVector) : Min(InMinVector), Max(InMaxVector) { }
-	Box(const std::vector<Vector3> InVertices);
+	Box(const std::vector<Vector3>& InVertices);
 
 	FORCEINLINE constexpr bool Intersect(const Box& InBox) const;
 	FORCEINLINE constexpr bool IsInside(const Box& InBox) const;
@@ -21,6 +21,7 @@ public:
 	FORCEINLINE constexpr Vector3 GetSize() const;
 	FORCEINLINE constexpr Vector3 GetExtent() const;
 	FORCEINLINE constexpr void GetCenterAndExtent(Vector3& OutCenter, Vector3& OutExtent) const;
+	FORCEINLINE Box TransformBy(const Matrix4x4& InMatrix) const;
 
 public:
 	Vector3 Min;
@@ -98,6 +99,22 @@ FORCEINLINE constexpr void Box::GetCenterAndExtent(Vector3 & OutCenter, Vector3
 	OutCenter = Min + OutExtent;
 }
 
+// 아핀 변환을 적용한 후 이를 감싸는 박스를 계산. 중심은 그대로 변환하고 크기는 행렬 원소의 절대값으로 투영한다.
+FORCEINLINE Box Box::TransformBy(const Matrix4x4& InMatrix) const
+{
+	Vector3 center, extent;
+	GetCenterAndExtent(center, extent);
+
+	Vector3 newCenter = InMatrix * center;
+	Vector3 newExtent(
+		Math::Abs(InMatrix.Cols[0].X) * extent.X + Math::Abs(InMatrix.Cols[1].X) * extent.Y + Math::Abs(InMatrix.Cols[2].X) * extent.Z,
+		Math::Abs(InMatrix.Cols[0].Y) * extent.X + Math::Abs(InMatrix.Cols[1].Y) * extent.Y + Math::Abs(InMatrix.Cols[2].Y) * extent.Z,
+		Math::Abs(InMatrix.Cols[0].Z) * extent.X + Math::Abs(InMatrix.Cols[1].Z) * extent.Y + Math::Abs(InMatrix.Cols[2].Z) * extent.Z
+	);
+
+	return Box(newCenter - newExtent, newCenter + newExtent);
+}
+
 }
 
 
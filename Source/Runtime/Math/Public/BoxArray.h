@@ -0,0 +1,73 @@
+#pragma once
+
+namespace CK
+{
+
+// 여러 박스를 중심과 절반 크기의 성분별 배열(SoA)로 저장. 일괄 컬링에 사용한다.
+struct BoxArray
+{
+public:
+	// 멤버함수
+	FORCEINLINE size_t Size() const { return CenterX.size(); }
+	FORCEINLINE void Reserve(size_t InCount);
+	FORCEINLINE void Resize(size_t InCount);
+	FORCEINLINE void Clear();
+	FORCEINLINE size_t Add(const Box& InBox);
+	FORCEINLINE void Set(size_t InIndex, const Box& InBox);
+	FORCEINLINE Box Get(size_t InIndex) const;
+
+	// 멤버변수
+	std::vector<float> CenterX, CenterY, CenterZ;
+	std::vector<float> ExtentX, ExtentY, ExtentZ;
+};
+
+FORCEINLINE void BoxArray::Reserve(size_t InCount)
+{
+	for (auto* stream : { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ })
+	{
+		stream->reserve(InCount);
+	}
+}
+
+FORCEINLINE void BoxArray::Resize(size_t InCount)
+{
+	for (auto* stream : { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ })
+	{
+		stream->resize(InCount);
+	}
+}
+
+FORCEINLINE void BoxArray::Clear()
+{
+	for (auto* stream : { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ })
+	{
+		stream->clear();
+	}
+}
+
+FORCEINLINE size_t BoxArray::Add(const Box& InBox)
+{
+	size_t index = Size();
+	Resize(index + 1);
+	Set(index, InBox);
+	return index;
+}
+
+FORCEINLINE void BoxArray::Set(size_t InIndex, const Box& InBox)
+{
+	assert(InIndex < Size());
+	Vector3 center, extent;
+	InBox.GetCenterAndExtent(center, extent);
+	CenterX[InIndex] = center.X; CenterY[InIndex] = center.Y; CenterZ[InIndex] = center.Z;
+	ExtentX[InIndex] = extent.X; ExtentY[InIndex] = extent.Y; ExtentZ[InIndex] = extent.Z;
+}
+
+FORCEINLINE Box BoxArray::Get(size_t InIndex) const
+{
+	assert(InIndex < Size());
+	Vector3 center(CenterX[InIndex], CenterY[InIndex], CenterZ[InIndex]);
+	Vector3 extent(ExtentX[InIndex], ExtentY[InIndex], ExtentZ[InIndex]);
+	return Box(center - extent, center + extent);
+}
+
+}
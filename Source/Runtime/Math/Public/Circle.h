@@ -8,7 +8,7 @@ struct Circle
 public:
 	FORCEINLINE constexpr Circle() = default;
 	FORCEINLINE constexpr Circle(const Circle& InCircle) : Center(InCircle.Center), Radius(InCircle.Radius) {};
-	Circle(const std::vector<Vector2> InVertices);
+	Circle(const std::vector<Vector2>& InVertices);
 
 	FORCEINLINE constexpr bool IsInside(const Vector2& InVector) const;
 	FORCEINLINE constexpr bool Intersect(const Circle& InCircle) const;
@@ -1,8 +1,11 @@
 #pragma once
 
-typedef unsigned char		BYTE;		// ȣ  8Ʈ
-typedef unsigned int		UINT32;		// ȣ  32Ʈ
-typedef signed long long	INT64;	// ȣ ִ 64Ʈ.
+typedef unsigned char		BYTE;		// 부호 없는 8비트
+typedef signed short		INT16;		// 부호 있는 16비트
+typedef unsigned short		UINT16;		// 부호 없는 16비트
+typedef unsigned int		UINT32;		// 부호 없는 32비트
+typedef signed long long	INT64;	// 부호 있는 64비트.
+typedef unsigned long long	UINT64;	// 부호 없는 64비트
 
 #define SMALL_NUMBER		(1.e-8f)
 
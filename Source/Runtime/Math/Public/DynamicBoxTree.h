@@ -0,0 +1,227 @@
+#pragma once
+
+namespace CK
+{
+
+// 움직이는 물체를 위한 축 정렬 박스 계층 구조(AABB 트리).
+// 잎 노드에는 여유 공간을 더한 박스를 저장해 작은 움직임으로는 트리를 고치지 않으며,
+// 삽입할 때는 표면적이 가장 적게 늘어나는 위치를 찾고 회전으로 높이의 균형을 맞춘다.
+class DynamicBoxTree
+{
+public:
+	// 생성자
+	DynamicBoxTree(float InMarginRatio = 0.1f) : _MarginRatio(InMarginRatio) { }
+
+public:
+	// 멤버함수
+	int Insert(const Box& InBox, void* InUserData);
+	void Remove(int InProxy);
+	bool Move(int InProxy, const Box& InBox); // 여유 박스를 벗어난 경우에만 다시 삽입하고 참을 반환
+	void Clear();
+
+	FORCEINLINE void* GetUserData(int InProxy) const { assert(IsValidProxy(InProxy)); return _Nodes[InProxy].UserData; }
+	FORCEINLINE const Box& GetFatBox(int InProxy) const { assert(IsValidProxy(InProxy)); return _Nodes[InProxy].Bound; }
+	FORCEINLINE size_t GetProxyCount() const { return _ProxyCount; }
+	FORCEINLINE int GetHeight() const { return (_Root == InvalidIndex) ? 0 : _Nodes[_Root].Height; }
+
+	// 절두체와 겹치는 잎 노드마다 InFunction(void* InUserData, BoundCheckResult InResult)를 호출.
+	// 판정은 잎 노드의 여유 박스로 진행하며, 완전히 안쪽에 있는 노드의 자손은 검사하지 않고 Inside로 전달한다.
+	template <class TFunction>
+	void Query(const Frustum& InFrustum, TFunction InFunction) const;
+
+	// 박스와 겹치는 잎 노드마다 InFunction(void* InUserData)를 호출
+	template <class TFunction>
+	void Query(const Box& InBox, TFunction InFunction) const;
+
+	// 반직선과 InMaxDistance 안에서 만나는 잎 노드마다 InFunction(void* InUserData, float InDistance)를 호출.
+	// 함수는 이후 탐색에 사용할 최대 거리를 반환하며, 가장 가까운 교차를 찾을 때는 찾은 거리를 반환해 탐색 범위를 줄인다.
+	// 음수를 반환하면 탐색을 중단한다.
+	template <class TFunction>
+	void Query(const Ray& InRay, float InMaxDistance, TFunction InFunction) const;
+
+	// 정적멤버변수
+	static constexpr int InvalidIndex = -1;
+
+private:
+	struct Node
+	{
+		FORCEINLINE bool IsLeaf() const { return Child1 == InvalidIndex; }
+
+		Box Bound;
+		void* UserData = nullptr;
+		int Parent = InvalidIndex; // 사용하지 않는 노드에서는 다음 빈 노드를 가리킨다.
+		int Child1 = InvalidIndex;
+		int Child2 = InvalidIndex;
+		int Height = -1; // 잎 노드는 0, 사용하지 않는 노드는 -1
+	};
+
+	// 탐색 스택의 항목. 절두체 탐색에서는 부모에서 완전히 안쪽으로 판정된 평면의 마스크를 함께 넘긴다.
+	struct StackEntry
+	{
+		int NodeIndex;
+		BYTE InsideMask;
+	};
+
+	// 질의마다 메모리를 할당하지 않도록 고정 크기 배열을 사용하는 탐색 스택.
+	// 깊이마다 방문하지 않은 형제 노드가 최대 하나씩 쌓이므로 항목 수는 트리의 높이 + 1을 넘지 않는다.
+	// 균형이 크게 무너진 트리에서 배열이 가득 차면 그 뒤의 항목은 힙 배열에 쌓는다.
+	static constexpr size_t MaxStackSize = 256;
+	class QueryStack
+	{
+	public:
+		FORCEINLINE bool IsEmpty() const { return _Size == 0 && _Overflow.empty(); }
+		FORCEINLINE void Push(int InNodeIndex, BYTE InInsideMask);
+		FORCEINLINE StackEntry Pop();
+
+	private:
+		std::array<StackEntry, MaxStackSize> _Entries;
+		size_t _Size = 0;
+		std::vector<StackEntry> _Overflow; // 배열이 가득 찬 뒤에 넣은 항목이므로 항상 배열의 항목보다 먼저 꺼낸다.
+	};
+
+	FORCEINLINE bool IsValidProxy(int InProxy) const { return InProxy >= 0 && InProxy < static_cast<int>(_Nodes.size()) && _Nodes[InProxy].Height == 0; }
+	Box MakeFatBox(const Box& InBox) const;
+	int AllocateNode();
+	void FreeNode(int InNode);
+	void InsertLeaf(int InLeaf);
+	void RemoveLeaf(int InLeaf);
+	void RefitAncestors(int InNode);
+	int Balance(int InNode);
+
+private:
+	// 멤버변수
+	std::vector<Node> _Nodes;
+	int _Root = InvalidIndex;
+	int _FreeList = InvalidIndex;
+	size_t _ProxyCount = 0;
+	float _MarginRatio = 0.1f;
+};
+
+FORCEINLINE void DynamicBoxTree::QueryStack::Push(int InNodeIndex, BYTE InInsideMask)
+{
+	if (_Size < MaxStackSize)
+	{
+		_Entries[_Size++] = { InNodeIndex, InInsideMask };
+		return;
+	}
+
+	_Overflow.push_back({ InNodeIndex, InInsideMask });
+}
+
+FORCEINLINE DynamicBoxTree::StackEntry DynamicBoxTree::QueryStack::Pop()
+{
+	if (!_Overflow.empty())
+	{
+		const StackEntry entry = _Overflow.back();
+		_Overflow.pop_back();
+		return entry;
+	}
+
+	assert(_Size > 0);
+	return _Entries[--_Size];
+}
+
+template <class TFunction>
+void DynamicBoxTree::Query(const Frustum& InFrustum, TFunction InFunction) const
+{
+	if (_Root == InvalidIndex)
+	{
+		return;
+	}
+
+	BYTE lastRejectPlane = 0;
+	QueryStack stack;
+	stack.Push(_Root, 0);
+	while (!stack.IsEmpty())
+	{
+		const StackEntry entry = stack.Pop();
+
+		const Node& node = _Nodes[entry.NodeIndex];
+		BYTE insideMask = entry.InsideMask;
+		BoundCheckResult result = BoundCheckResult::Inside;
+		if (insideMask != Frustum::AllPlanesMask)
+		{
+			result = InFrustum.CheckBound(node.Bound, lastRejectPlane, insideMask);
+			if (result == BoundCheckResult::Outside)
+			{
+				continue;
+			}
+		}
+
+		if (node.IsLeaf())
+		{
+			InFunction(node.UserData, result);
+			continue;
+		}
+
+		stack.Push(node.Child1, insideMask);
+		stack.Push(node.Child2, insideMask);
+	}
+}
+
+template <class TFunction>
+void DynamicBoxTree::Query(const Box& InBox, TFunction InFunction) const
+{
+	if (_Root == InvalidIndex)
+	{
+		return;
+	}
+
+	QueryStack stack;
+	stack.Push(_Root, 0);
+	while (!stack.IsEmpty())
+	{
+		const Node& node = _Nodes[stack.Pop().NodeIndex];
+		if (!node.Bound.Intersect(InBox))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			InFunction(node.UserData);
+			continue;
+		}
+
+		stack.Push(node.Child1, 0);
+		stack.Push(node.Child2, 0);
+	}
+}
+
+template <class TFunction>
+void DynamicBoxTree::Query(const Ray& InRay, float InMaxDistance, TFunction InFunction) const
+{
+	if (_Root == InvalidIndex)
+	{
+		return;
+	}
+
+	float maxDistance = InMaxDistance;
+	QueryStack stack;
+	stack.Push(_Root, 0);
+	while (!stack.IsEmpty())
+	{
+		const Node& node = _Nodes[stack.Pop().NodeIndex];
+
+		float distance = 0.f;
+		if (!InRay.Intersect(node.Bound, distance) || distance > maxDistance)
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			maxDistance = InFunction(node.UserData, distance);
+			if (maxDistance < 0.f)
+			{
+				return;
+			}
+			continue;
+		}
+
+		stack.Push(node.Child1, 0);
+		stack.Push(node.Child2, 0);
+	}
+}
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+namespace CK
+{
+
+// 한 프레임 동안만 사용하는 메모리를 큰 블록에서 앞부터 잘라 주는 할당기.
+// 개별 해제는 하지 않고 프레임이 끝날 때 한 번에 비우며, 블록은 다음 프레임에 다시 사용한다.
+// 스레드마다 하나씩 있으므로 할당할 때 잠금이 필요 없다.
+class FrameArena
+{
+public:
+	// 생성자
+	FrameArena();
+	~FrameArena();
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+public:
+	// 멤버함수
+	void* Allocate(size_t InSize, size_t InAlignment);
+	void Deallocate(void* InPointer, size_t InSize); // 마지막으로 할당한 메모리인 경우에만 되돌린다.
+	void Reset();
+
+	FORCEINLINE size_t GetUsedSize() const { return _UsedSize; }
+	FORCEINLINE size_t GetCapacity() const { return _Capacity; }
+
+	// 호출한 스레드의 아레나
+	static FrameArena& Get();
+
+	// 모든 스레드의 아레나를 비운다. 다른 스레드가 아레나를 사용하지 않는 프레임의 끝에서 호출한다.
+	static void ResetAll();
+
+	// 정적멤버변수
+	static constexpr size_t DefaultBlockSize = 1 << 20;
+
+private:
+	struct Block
+	{
+		BYTE* Memory = nullptr;
+		size_t Size = 0;
+	};
+
+	void AddBlock(size_t InMinSize);
+	void ReleaseBlocks();
+
+private:
+	// 멤버변수
+	std::vector<Block> _Blocks;
+	size_t _BlockIndex = 0; // 현재 할당 중인 블록
+	size_t _Offset = 0; // 현재 블록에서 사용한 크기
+	size_t _UsedSize = 0;
+	size_t _Capacity = 0;
+};
+
+// 프레임 아레나에서 메모리를 받는 STL 할당기. 컨테이너는 프레임이 끝나기 전에 소멸되어야 한다.
+template <class T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	// 생성자
+	FrameAllocator() = default;
+	template <class U>
+	FrameAllocator(const FrameAllocator<U>&) { }
+
+	// 연산자
+	template <class U>
+	FORCEINLINE bool operator==(const FrameAllocator<U>&) const { return true; }
+	template <class U>
+	FORCEINLINE bool operator!=(const FrameAllocator<U>&) const { return false; }
+
+	// 멤버함수
+	FORCEINLINE T* allocate(size_t InCount) { return static_cast<T*>(FrameArena::Get().Allocate(sizeof(T) * InCount, alignof(T))); }
+	FORCEINLINE void deallocate(T* InPointer, size_t InCount) { FrameArena::Get().Deallocate(InPointer, sizeof(T) * InCount); }
+};
+
+template <class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+template <class TKey, class TValue>
+using FrameUnorderedMap = std::unordered_map<TKey, TValue, std::hash<TKey>, std::equal_to<TKey>, FrameAllocator<std::pair<const TKey, TValue>>>;
+
+}
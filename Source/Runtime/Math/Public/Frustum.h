@@ -5,26 +5,83 @@ namespace CK
 
 struct Frustum
 {
-	// 
+	// 생성자
 	FORCEINLINE constexpr Frustum() = default;
 	FORCEINLINE constexpr Frustum(const std::array<Plane, 6>& InPlanes);
 
-	// Լ 
+	// 멤버함수 
 	FORCEINLINE constexpr BoundCheckResult CheckBound(const Vector3& InPoint) const;
 	FORCEINLINE constexpr BoundCheckResult CheckBound(const Sphere& InSphere) const;
 	FORCEINLINE constexpr BoundCheckResult CheckBound(const Box& InBox) const;
 	FORCEINLINE constexpr bool IsIntersect(const Box& InBox) const;
 
-	// 
-	std::array<Plane, 6> Planes; // Y+, Y-, X+, X-, Z+, Z-  
+	// 회전된 박스는 여섯 평면으로 판정한 후, 경계에 걸친 경우 박스의 축과 모서리 쌍의 외적을 분리축으로 추가 검사한다.
+	// 평면만으로는 절두체 모서리 바깥의 박스를 걸러내지 못하기 때문이다.
+	BoundCheckResult CheckBound(const OrientedBox& InBox) const;
+	BoundCheckResult CheckBound(const OrientedBox& InBox, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const;
+
+	// 평면 일관성을 활용한 판정. InOutLastRejectPlane의 평면부터 검사하고 밖으로 판정한 평면으로 갱신한다.
+	// InOutInsideMask에 켜진 평면은 이미 완전히 안쪽이므로 건너뛰며, 판정 후 완전히 안쪽인 평면의 비트가 추가된다.
+	// 계층 구조에서는 부모의 마스크를 자식에게 넘겨 검사할 평면을 줄일 수 있다.
+	FORCEINLINE constexpr BoundCheckResult CheckBound(const Sphere& InSphere, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const;
+	FORCEINLINE constexpr BoundCheckResult CheckBound(const Box& InBox, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const;
+
+	// 여러 바운딩 볼륨을 여섯 평면과 한 번에 판정. 결과는 32개씩 UINT32 비트마스크로 기록된다.
+	// OutVisibleMask는 절두체 밖에 있지 않은 볼륨, OutIntersectMask는 그 중 경계에 걸친 볼륨의 비트가 켜진다.
+	void CheckBounds(const BoxArray& InBoxes, std::vector<UINT32>& OutVisibleMask, std::vector<UINT32>& OutIntersectMask) const;
+	void CheckBounds(const SphereArray& InSpheres, std::vector<UINT32>& OutVisibleMask, std::vector<UINT32>& OutIntersectMask) const;
+	static FORCEINLINE bool IsMaskBitSet(const std::vector<UINT32>& InMask, size_t InIndex) { return (InMask[InIndex >> 5] >> (InIndex & 31)) & 1u; }
+
+private:
+	static FORCEINLINE constexpr BoundCheckResult CheckPlane(const Plane& InPlane, const Sphere& InSphere);
+	static FORCEINLINE constexpr BoundCheckResult CheckPlane(const Plane& InPlane, const Box& InBox);
+	static FORCEINLINE constexpr BoundCheckResult CheckPlane(const Plane& InPlane, const OrientedBox& InBox);
+	static FORCEINLINE constexpr Vector3 IntersectPlanes(const Plane& InPlane1, const Plane& InPlane2, const Plane& InPlane3);
+	bool IsSeparated(const OrientedBox& InBox) const;
+	template <class TBound>
+	FORCEINLINE constexpr BoundCheckResult CheckBoundCoherent(const TBound& InBound, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const;
+
+public:
+	// 정적멤버변수
+	static constexpr BYTE PlaneCount = 6;
+	static constexpr BYTE AllPlanesMask = (1 << PlaneCount) - 1;
+
+	// 멤버변수
+	std::array<Plane, PlaneCount> Planes; // Y+, Y-, X+, X-, Z+, Z- 순으로 저장
+	std::array<Vector3, 8> Corners; // 인덱스의 0번 비트는 X-, 1번 비트는 Y-, 2번 비트는 Z-(near) 평면 쪽을 의미
 };
 
 FORCEINLINE constexpr Frustum::Frustum(const std::array<Plane, 6>& InPlanes) : Planes(InPlanes)
 {
+	// 분리축 검사에 사용할 꼭지점은 생성할 때 한 번만 계산
+	for (BYTE i = 0; i < 8; ++i)
+	{
+		const Plane& xPlane = Planes[(i & 1) ? 3 : 2];
+		const Plane& yPlane = Planes[(i & 2) ? 1 : 0];
+		const Plane& zPlane = Planes[(i & 4) ? 5 : 4];
+		Corners[i] = IntersectPlanes(xPlane, yPlane, zPlane);
+	}
+}
+
+// 세 평면이 만나는 점
+FORCEINLINE constexpr Vector3 Frustum::IntersectPlanes(const Plane& InPlane1, const Plane& InPlane2, const Plane& InPlane3)
+{
+	const Vector3 n23 = InPlane2.Normal.Cross(InPlane3.Normal);
+	const float denominator = InPlane1.Normal.Dot(n23);
+	if (Math::Abs(denominator) <= SMALL_NUMBER)
+	{
+		return Vector3::Zero;
+	}
+
+	const Vector3 n31 = InPlane3.Normal.Cross(InPlane1.Normal);
+	const Vector3 n12 = InPlane1.Normal.Cross(InPlane2.Normal);
+	return (n23 * -InPlane1.D + n31 * -InPlane2.D + n12 * -InPlane3.D) / denominator;
 }
 
 FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Vector3& InPoint) const
 {
+	// 한 평면이라도 밖에 있으면 밖이므로 경계에 걸쳐도 나머지 평면을 모두 검사한다.
+	bool isOnPlane = false;
 	for (const auto& p : Planes)
 	{
 		if (p.IsOutside(InPoint))
@@ -33,70 +90,121 @@ FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Vector3& InPoin
 		}
 		else if (Math::EqualsInTolerance(p.Distance(InPoint), 0.f))
 		{
-			return BoundCheckResult::Intersect;
+			isOnPlane = true;
 		}
-	
+	}
+
+	return isOnPlane ? BoundCheckResult::Intersect : BoundCheckResult::Inside;
+}
+
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckPlane(const Plane& InPlane, const Sphere& InSphere)
+{
+	float distance = InPlane.Distance(InSphere.Center);
+	if (distance > InSphere.Radius)
+	{
+		return BoundCheckResult::Outside;
+	}
+	else if (distance > -InSphere.Radius)
+	{
+		return BoundCheckResult::Intersect;
 	}
 
 	return BoundCheckResult::Inside;
 }
 
-FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Sphere& InSphere) const
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckPlane(const Plane& InPlane, const Box& InBox)
 {
-	for (const auto& p : Planes)
+	// 법선 방향으로 가장 먼 점과 가장 가까운 점을 선택
+	Vector3 pPoint = InBox.Min, nPoint = InBox.Max;
+	if (InPlane.Normal.X >= 0.f) { pPoint.X = InBox.Max.X; nPoint.X = InBox.Min.X; }
+	if (InPlane.Normal.Y >= 0.f) { pPoint.Y = InBox.Max.Y; nPoint.Y = InBox.Min.Y; }
+	if (InPlane.Normal.Z >= 0.f) { pPoint.Z = InBox.Max.Z; nPoint.Z = InBox.Min.Z; }
+
+	if (InPlane.Distance(nPoint) > 0.f)
 	{
-		if (p.Distance(InSphere.Center) > InSphere.Radius)
-		{
-			return BoundCheckResult::Outside;
-		}
-		else if (Math::Abs(p.Distance(InSphere.Center)) <= InSphere.Radius)
-		{
-			return BoundCheckResult::Intersect;
-		}
+		return BoundCheckResult::Outside;
+	}
+	else if (InPlane.Distance(pPoint) > 0.f)
+	{
+		return BoundCheckResult::Intersect;
+	}
+
+	return BoundCheckResult::Inside;
+}
 
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckPlane(const Plane& InPlane, const OrientedBox& InBox)
+{
+	// 중심의 거리와 법선 방향으로 투영한 박스의 반경을 비교
+	float distance = InPlane.Distance(InBox.Center);
+	float radius = InBox.GetProjectedExtent(InPlane.Normal);
+	if (distance > radius)
+	{
+		return BoundCheckResult::Outside;
+	}
+	else if (distance > -radius)
+	{
+		return BoundCheckResult::Intersect;
 	}
 
 	return BoundCheckResult::Inside;
 }
 
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Sphere& InSphere) const
+{
+	BYTE lastRejectPlane = 0, insideMask = 0;
+	return CheckBoundCoherent(InSphere, lastRejectPlane, insideMask);
+}
+
 FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Box& InBox) const
 {
-	for (const auto& p : Planes)
+	BYTE lastRejectPlane = 0, insideMask = 0;
+	return CheckBoundCoherent(InBox, lastRejectPlane, insideMask);
+}
+
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Sphere& InSphere, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const
+{
+	return CheckBoundCoherent(InSphere, InOutLastRejectPlane, InOutInsideMask);
+}
+
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckBound(const Box& InBox, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const
+{
+	return CheckBoundCoherent(InBox, InOutLastRejectPlane, InOutInsideMask);
+}
+
+template <class TBound>
+FORCEINLINE constexpr BoundCheckResult Frustum::CheckBoundCoherent(const TBound& InBound, BYTE& InOutLastRejectPlane, BYTE& InOutInsideMask) const
+{
+	assert(InOutLastRejectPlane < PlaneCount);
+	BYTE insideMask = InOutInsideMask;
+	for (BYTE i = 0; i < PlaneCount; ++i)
 	{
-		Vector3 pPoint = InBox.Min, nPoint = InBox.Max;
-		if (p.Normal.X >= 0.f) { pPoint.X = InBox.Max.X; nPoint.X = InBox.Min.X; }
-		if (p.Normal.Y >= 0.f) { pPoint.Y = InBox.Max.Y; nPoint.Y = InBox.Min.Y; }
-		if (p.Normal.Z >= 0.f) { pPoint.Z = InBox.Max.Z; nPoint.Z = InBox.Min.Z; }
+		BYTE planeIndex = (InOutLastRejectPlane + i) % PlaneCount;
+		BYTE planeBit = 1 << planeIndex;
+		if (insideMask & planeBit)
+		{
+			continue;
+		}
 
-		if (p.Distance(nPoint) > 0.f)
+		BoundCheckResult result = CheckPlane(Planes[planeIndex], InBound);
+		if (result == BoundCheckResult::Outside)
 		{
+			// 다음 프레임에 이 평면부터 검사하도록 기록
+			InOutLastRejectPlane = planeIndex;
 			return BoundCheckResult::Outside;
 		}
-		if (p.Distance(nPoint) <= 0.f && p.Distance(pPoint) >= 0.f)
+		else if (result == BoundCheckResult::Inside)
 		{
-			return BoundCheckResult::Intersect;
+			insideMask |= planeBit;
 		}
 	}
 
-	return BoundCheckResult::Inside;
+	InOutInsideMask = insideMask;
+	return (insideMask == AllPlanesMask) ? BoundCheckResult::Inside : BoundCheckResult::Intersect;
 }
 
 FORCEINLINE constexpr bool Frustum::IsIntersect(const Box& InBox) const
 {
-	for (const auto& p : Planes)
-	{
-		Vector3 pVertex = InBox.Min, nVertex = InBox.Max;
-		if (p.Normal.X >= 0.f) { pVertex.X = InBox.Max.X; nVertex.X = InBox.Min.X; }
-		if (p.Normal.Y >= 0.f) { pVertex.Y = InBox.Max.Y; nVertex.Y = InBox.Min.Y; }
-		if (p.Normal.Z >= 0.f) { pVertex.Z = InBox.Max.Z; nVertex.Z = InBox.Min.Z; }
-
-		if (p.Distance(nVertex) <= 0.f && p.Distance(pVertex) >= 0.f)
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return CheckBound(InBox) == BoundCheckResult::Intersect;
 }
 
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstring>
 
 #include <math.h>
 
@@ -10,17 +11,22 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <unordered_map>
 #include <iterator>
 #include <algorithm>
+#include <mutex>
 
+#include "VectorRegister.h"
 #include "MathUtil.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
+#include "PackedVector.h"
 
 #include "Matrix2x2.h"
 #include "Matrix3x3.h"
 #include "Matrix4x4.h"
+#include "VectorBatch.h"
 
 #include "ScreenPoint.h"
 
@@ -31,8 +37,10 @@
 #include "Rotator.h"
 
 #include "Quaternion.h"
+#include "QuaternionBatch.h"
 
 #include "Transform.h"
+#include "Affine3x4.h"
 
 #include "Plane.h"
 
@@ -40,7 +48,16 @@
 #include "Rectangle.h"
 #include "Sphere.h"
 #include "Box.h"
+#include "OrientedBox.h"
+#include "SphereArray.h"
+#include "BoxArray.h"
+#include "Ray.h"
+#include "RayPacket.h"
 
 #include "Frustum.h"
+#include "DynamicBoxTree.h"
+#include "RectangleGrid.h"
+
+#include "FrameArena.h"
 
 using namespace CK;
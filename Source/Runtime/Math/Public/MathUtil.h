@@ -95,7 +95,7 @@ struct Math
 		return X < Min ? Min : X < Max ? X : Max;
 	}
 
-	// 𸮾  ڵ忡 .     ﰢԼ Բ  Լ. 
+	// 언리얼 엔진 코드에서 가져옴. 지정된 각도에 대한 두 삼각함수를 함께 가져오는 함수. 
 	static FORCEINLINE constexpr void GetSinCosRad(float& OutSin, float& OutCos, float InRadian)
 	{
 		// Copied from UE4 Source Code
@@ -184,9 +184,92 @@ struct Math
 		return (X - intPortion);
 	}
 
-	// 𸮾  ڵ忡 .   
-	FORCEINLINE static float InvSqrt(float InFloat)
+	// 컴파일 타임에는 뉴턴-랩슨 반복으로 계산하고, 런타임에는 표준 함수를 사용
+	FORCEINLINE static constexpr float Sqrt(float InFloat)
 	{
+		if (CK_IS_CONSTANT_EVALUATED())
+		{
+			if (InFloat <= 0.f)
+			{
+				return 0.f;
+			}
+
+			// 배정밀도로 수렴할 때까지 반복
+			double x = InFloat >= 1.f ? (double)InFloat : 1.0;
+			for (int i = 0; i < 64; ++i)
+			{
+				const double next = 0.5 * (x + InFloat / x);
+				if (next == x)
+				{
+					break;
+				}
+				x = next;
+			}
+			return (float)x;
+		}
+
+		return sqrtf(InFloat);
+	}
+
+	// 컴파일 타임에는 GetSinCosRad의 다항식으로 계산하고, 런타임에는 표준 함수를 사용
+	FORCEINLINE static constexpr float Sin(float InRadian)
+	{
+		if (CK_IS_CONSTANT_EVALUATED())
+		{
+			float sin = 0.f, cos = 0.f;
+			GetSinCosRad(sin, cos, InRadian);
+			return sin;
+		}
+
+		return sinf(InRadian);
+	}
+
+	FORCEINLINE static constexpr float Cos(float InRadian)
+	{
+		if (CK_IS_CONSTANT_EVALUATED())
+		{
+			float sin = 0.f, cos = 0.f;
+			GetSinCosRad(sin, cos, InRadian);
+			return cos;
+		}
+
+		return cosf(InRadian);
+	}
+
+	FORCEINLINE static constexpr float Tan(float InRadian)
+	{
+		if (CK_IS_CONSTANT_EVALUATED())
+		{
+			float sin = 0.f, cos = 0.f;
+			GetSinCosRad(sin, cos, InRadian);
+			return sin / cos;
+		}
+
+		return tanf(InRadian);
+	}
+
+	// 컴파일 타임에는 Abramowitz & Stegun 4.4.46의 근사식으로 계산하고, 런타임에는 표준 함수를 사용
+	FORCEINLINE static constexpr float Acos(float InFloat)
+	{
+		if (CK_IS_CONSTANT_EVALUATED())
+		{
+			const float x = Math::Min(Math::Abs(InFloat), 1.f);
+			const float p = ((((((-0.0012624911f * x + 0.0066700901f) * x - 0.0170881256f) * x + 0.0308918810f) * x - 0.0501743046f) * x + 0.0889789874f) * x - 0.2145988016f) * x + 1.5707963050f;
+			const float result = Sqrt(1.f - x) * p;
+			return (InFloat < 0.f) ? PI - result : result;
+		}
+
+		return acosf(InFloat);
+	}
+
+	// 언리얼 엔진 코드에서 가져옴. 고속 역제곱근 공식
+	FORCEINLINE static constexpr float InvSqrt(float InFloat)
+	{
+		if (CK_IS_CONSTANT_EVALUATED())
+		{
+			return 1.f / Sqrt(InFloat);
+		}
+
 		// Performs two passes of Newton-Raphson iteration on the hardware estimate
 		//    v^-0.5 = x
 		// => x^2 = v^-1
@@ -202,28 +285,120 @@ struct Math
 		// This final form has one more operation than the legacy factorization (X1 = 0.5*X0*(3-(Y*X0)*X0)
 		// but retains better accuracy (namely InvSqrt(1) = 1 exactly).
 
+		// constexpr 함수 안에서는 초기화되지 않은 변수를 둘 수 없으므로 선언과 동시에 계산
 		const __m128 fOneHalf = _mm_set_ss(0.5f);
-		__m128 Y0, X0, X1, X2, FOver2;
-		float temp;
-
-		Y0 = _mm_set_ss(InFloat);
-		X0 = _mm_rsqrt_ss(Y0);	// 1/sqrt estimate (12 bits)
-		FOver2 = _mm_mul_ss(Y0, fOneHalf);
+		const __m128 Y0 = _mm_set_ss(InFloat);
+		const __m128 X0 = _mm_rsqrt_ss(Y0);	// 1/sqrt estimate (12 bits)
+		const __m128 FOver2 = _mm_mul_ss(Y0, fOneHalf);
 
 		// 1st Newton-Raphson iteration
-		X1 = _mm_mul_ss(X0, X0);
+		__m128 X1 = _mm_mul_ss(X0, X0);
 		X1 = _mm_sub_ss(fOneHalf, _mm_mul_ss(FOver2, X1));
 		X1 = _mm_add_ss(X0, _mm_mul_ss(X0, X1));
 
 		// 2nd Newton-Raphson iteration
-		X2 = _mm_mul_ss(X1, X1);
+		__m128 X2 = _mm_mul_ss(X1, X1);
 		X2 = _mm_sub_ss(fOneHalf, _mm_mul_ss(FOver2, X2));
 		X2 = _mm_add_ss(X1, _mm_mul_ss(X1, X2));
 
-		_mm_store_ss(&temp, X2);
-		return temp;
+		return _mm_cvtss_f32(X2);
 	}
 
+	// 배열 단위로 계산하는 고속 근사 함수. 네 개씩 벡터 근사 함수로 계산하며, 오차는 아래 Vector 함수의 설명을 따른다.
+	// 입력과 출력 배열은 같아도 된다.
+	static void InvSqrt(const float* InValues, float* OutValues, size_t InCount);
+	static void SinCosRad(const float* InRadians, float* OutSin, float* OutCos, size_t InCount);
+	static void Acos(const float* InValues, float* OutValues, size_t InCount);
+	static void Exp(const float* InValues, float* OutValues, size_t InCount);
 };
 
+// 4개의 값을 한 번에 계산하는 근사 함수. 기존 스칼라 함수를 대체하지 않으며 필요한 곳에서 골라 사용한다.
+
+// 역제곱근. 하드웨어 근사값에 뉴턴-랩슨 보정을 두 번 적용하며 최대 상대 오차는 약 1.5e-7
+FORCEINLINE VectorRegister VectorReciprocalSqrt(const VectorRegister& InVector)
+{
+	const VectorRegister oneHalf = VectorSetFloat1(0.5f);
+	const VectorRegister halfValue = VectorMultiply(InVector, oneHalf);
+
+	// x1 = x0 + x0 * (0.5 - 0.5 * v * x0^2)
+	VectorRegister x = VectorReciprocalSqrtEstimate(InVector);
+	x = VectorMultiplyAdd(x, VectorSubtract(oneHalf, VectorMultiply(halfValue, VectorMultiply(x, x))), x);
+	x = VectorMultiplyAdd(x, VectorSubtract(oneHalf, VectorMultiply(halfValue, VectorMultiply(x, x))), x);
+	return x;
+}
+
+// 사인과 코사인을 함께 계산. Math::GetSinCosRad와 같은 다항식을 사용하며 [-100, 100] 범위에서 최대 절대 오차는 약 1e-5 ([-pi, pi] 범위에서는 약 2.5e-7)
+// 범위 축소를 한 번에 하므로 입력의 절대값이 커질수록 오차가 커진다.
+FORCEINLINE void VectorSinCos(const VectorRegister& InRadian, VectorRegister& OutSin, VectorRegister& OutCos)
+{
+	// [-pi, pi] 범위로 옮기기
+	const VectorRegister quotient = VectorRound(VectorMultiply(InRadian, VectorSetFloat1(Math::InvPI * 0.5f)));
+	VectorRegister y = VectorSubtract(InRadian, VectorMultiply(quotient, VectorSetFloat1(Math::TwoPI)));
+
+	// sin(y) = sin(pi - y)을 이용해 [-pi/2, pi/2] 범위로 옮기고 코사인의 부호를 기록
+	const VectorRegister signedPI = VectorBitwiseOr(VectorBitwiseAnd(y, VectorSetFloat1(-0.f)), VectorSetFloat1(Math::PI));
+	const VectorRegister reflectMask = VectorCompareGT(VectorAbs(y), VectorSetFloat1(Math::HalfPI));
+	y = VectorSelect(reflectMask, VectorSubtract(signedPI, y), y);
+	const VectorRegister cosSign = VectorSelect(reflectMask, VectorSetFloat1(-1.f), VectorSetFloat1(1.f));
+
+	const VectorRegister y2 = VectorMultiply(y, y);
+
+	// 11-degree minimax approximation
+	VectorRegister s = VectorMultiplyAdd(VectorSetFloat1(-2.3889859e-08f), y2, VectorSetFloat1(2.7525562e-06f));
+	s = VectorMultiplyAdd(s, y2, VectorSetFloat1(-0.00019840874f));
+	s = VectorMultiplyAdd(s, y2, VectorSetFloat1(0.0083333310f));
+	s = VectorMultiplyAdd(s, y2, VectorSetFloat1(-0.16666667f));
+	s = VectorMultiplyAdd(s, y2, VectorSetFloat1(1.f));
+	OutSin = VectorMultiply(s, y);
+
+	// 10-degree minimax approximation
+	VectorRegister c = VectorMultiplyAdd(VectorSetFloat1(-2.6051615e-07f), y2, VectorSetFloat1(2.4760495e-05f));
+	c = VectorMultiplyAdd(c, y2, VectorSetFloat1(-0.0013888378f));
+	c = VectorMultiplyAdd(c, y2, VectorSetFloat1(0.041666638f));
+	c = VectorMultiplyAdd(c, y2, VectorSetFloat1(-0.5f));
+	c = VectorMultiplyAdd(c, y2, VectorSetFloat1(1.f));
+	OutCos = VectorMultiply(c, cosSign);
+}
+
+// 아크코사인. Abramowitz & Stegun 4.4.46의 7차 다항식을 사용하며 [-1, 1] 범위에서 최대 절대 오차는 약 5e-7 라디안
+// 범위를 벗어난 입력은 [-1, 1]로 고정한다.
+FORCEINLINE VectorRegister VectorAcos(const VectorRegister& InVector)
+{
+	const VectorRegister x = VectorMin(VectorAbs(InVector), VectorSetFloat1(1.f));
+
+	VectorRegister p = VectorMultiplyAdd(VectorSetFloat1(-0.0012624911f), x, VectorSetFloat1(0.0066700901f));
+	p = VectorMultiplyAdd(p, x, VectorSetFloat1(-0.0170881256f));
+	p = VectorMultiplyAdd(p, x, VectorSetFloat1(0.0308918810f));
+	p = VectorMultiplyAdd(p, x, VectorSetFloat1(-0.0501743046f));
+	p = VectorMultiplyAdd(p, x, VectorSetFloat1(0.0889789874f));
+	p = VectorMultiplyAdd(p, x, VectorSetFloat1(-0.2145988016f));
+	p = VectorMultiplyAdd(p, x, VectorSetFloat1(1.5707963050f));
+
+	// acos(x) = sqrt(1 - x) * P(x), acos(-x) = pi - acos(x)
+	const VectorRegister result = VectorMultiply(VectorSqrt(VectorSubtract(VectorSetFloat1(1.f), x)), p);
+	const VectorRegister negativeMask = VectorCompareLT(InVector, VectorZero());
+	return VectorSelect(negativeMask, VectorSubtract(VectorSetFloat1(Math::PI), result), result);
+}
+
+// 자연지수함수. e^x = 2^n * e^r 로 나누고 e^r을 6차 테일러 다항식으로 계산하며 최대 상대 오차는 약 3e-7
+// 오버플로우와 비정규화 수를 피하기 위해 입력은 [-87, 88] 범위로 고정한다.
+FORCEINLINE VectorRegister VectorExp(const VectorRegister& InVector)
+{
+	const VectorRegister x = VectorMin(VectorMax(InVector, VectorSetFloat1(-87.f)), VectorSetFloat1(88.f));
+
+	// r = x - n * ln2 를 두 상수로 나눠 계산해 정밀도를 유지 (Cody-Waite)
+	const VectorRegister n = VectorRound(VectorMultiply(x, VectorSetFloat1(1.44269504089f)));
+	VectorRegister r = VectorSubtract(x, VectorMultiply(n, VectorSetFloat1(0.693359375f)));
+	r = VectorSubtract(r, VectorMultiply(n, VectorSetFloat1(-2.12194440e-4f)));
+
+	VectorRegister p = VectorMultiplyAdd(VectorSetFloat1(1.f / 720.f), r, VectorSetFloat1(1.f / 120.f));
+	p = VectorMultiplyAdd(p, r, VectorSetFloat1(1.f / 24.f));
+	p = VectorMultiplyAdd(p, r, VectorSetFloat1(1.f / 6.f));
+	p = VectorMultiplyAdd(p, r, VectorSetFloat1(0.5f));
+	p = VectorMultiplyAdd(p, r, VectorSetFloat1(1.f));
+	p = VectorMultiplyAdd(p, r, VectorSetFloat1(1.f));
+
+	return VectorMultiply(p, VectorPow2Int(n));
+}
+
 }
\ No newline at end of file
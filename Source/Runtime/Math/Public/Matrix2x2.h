@@ -6,13 +6,13 @@ namespace CK
 struct Matrix2x2
 {
 public:
-	//  
+	// 생성자 
 	FORCEINLINE constexpr Matrix2x2() = default;
 	FORCEINLINE explicit constexpr Matrix2x2(const Vector2& InCol0, const Vector2& InCol1) { Cols = { InCol0, InCol1 }; }
 
-	//  
-	FORCEINLINE const Vector2& operator[](BYTE InIndex) const;
-	FORCEINLINE Vector2& operator[](BYTE InIndex);
+	// 연산자 
+	FORCEINLINE constexpr const Vector2& operator[](BYTE InIndex) const;
+	FORCEINLINE constexpr Vector2& operator[](BYTE InIndex);
 	FORCEINLINE Matrix2x2 operator*(float InScalar) const;
 	FORCEINLINE Matrix2x2 operator*(const Matrix2x2& InMatrix) const;
 	FORCEINLINE Vector2 operator*(const Vector2& InVector) const;
@@ -22,20 +22,23 @@ public:
 		return InVector;
 	}
 
-	// Լ 
+	// 멤버함수 
 	FORCEINLINE void SetIdentity();
 	FORCEINLINE Matrix2x2 Transpose() const;
 
 	std::vector<std::string> ToStrings() const;
 
-	//  
+	// 정적멤버변수 
 	static const Matrix2x2 Identity;
 	static constexpr BYTE Rank = 2;
 
-	//  
+	// 멤버변수 
 	std::array<Vector2, Rank> Cols = { Vector2::UnitX, Vector2::UnitY };
 };
 
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Matrix2x2 Matrix2x2::Identity(Vector2(1.f, 0.f), Vector2(0.f, 1.f));
+
 FORCEINLINE void Matrix2x2::SetIdentity()
 {
 	*this = Matrix2x2::Identity;
@@ -49,13 +52,13 @@ FORCEINLINE Matrix2x2 Matrix2x2::Transpose() const
 	);
 }
 
-FORCEINLINE const Vector2& Matrix2x2::operator[](BYTE InIndex) const
+FORCEINLINE constexpr const Vector2& Matrix2x2::operator[](BYTE InIndex) const
 {
 	assert(InIndex < Rank);
 	return Cols[InIndex];
 }
 
-FORCEINLINE Vector2& Matrix2x2::operator[](BYTE InIndex)
+FORCEINLINE constexpr Vector2& Matrix2x2::operator[](BYTE InIndex)
 {
 	assert(InIndex < Rank);
 	return Cols[InIndex];
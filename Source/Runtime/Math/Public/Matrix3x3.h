@@ -6,17 +6,17 @@ namespace CK
 struct Matrix3x3
 {
 public:
-	//  
+	// 생성자 
 	FORCEINLINE constexpr Matrix3x3() = default;
 	FORCEINLINE explicit constexpr Matrix3x3(const Vector3& InCol0, const Vector3& InCol1, const Vector3& InCol2) { Cols = { InCol0, InCol1, InCol2 }; }
 
-	//  
-	FORCEINLINE const Vector3& operator[](BYTE InIndex) const;
-	FORCEINLINE Vector3& operator[](BYTE InIndex);
+	// 연산자 
+	FORCEINLINE constexpr const Vector3& operator[](BYTE InIndex) const;
+	FORCEINLINE constexpr Vector3& operator[](BYTE InIndex);
 
 	FORCEINLINE Matrix3x3 operator*(float InScalar) const;
-	FORCEINLINE Matrix3x3 operator*(const Matrix3x3& InMatrix) const;
-	FORCEINLINE Vector3 operator*(const Vector3& InVector) const;
+	FORCEINLINE constexpr Matrix3x3 operator*(const Matrix3x3& InMatrix) const;
+	FORCEINLINE constexpr Vector3 operator*(const Vector3& InVector) const;
 	FORCEINLINE friend Vector3 operator*=(Vector3& InVector, const Matrix3x3& InMatrix)
 	{
 		InVector = InMatrix * InVector;
@@ -29,27 +29,30 @@ public:
 		return InVector;
 	}
 
-	// Լ 
+	// 멤버함수 
 	FORCEINLINE Matrix2x2 ToMatrix2x2() const;
 	FORCEINLINE void SetIdentity();
-	FORCEINLINE Matrix3x3 Transpose() const;
+	FORCEINLINE constexpr Matrix3x3 Transpose() const;
 
 	std::vector<std::string> ToStrings() const;
 
-	//  
+	// 정적멤버변수 
 	static const Matrix3x3 Identity;
 	static constexpr BYTE Rank = 3;
 
-	//  
+	// 멤버변수 
 	std::array<Vector3, Rank> Cols = { Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ };
 };
 
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Matrix3x3 Matrix3x3::Identity(Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f));
+
 FORCEINLINE void Matrix3x3::SetIdentity()
 {
 	*this = Matrix3x3::Identity;
 }
 
-FORCEINLINE Matrix3x3 Matrix3x3::Transpose() const
+FORCEINLINE constexpr Matrix3x3 Matrix3x3::Transpose() const
 {
 	return Matrix3x3(
 		Vector3(Cols[0].X, Cols[1].X, Cols[2].X),
@@ -58,13 +61,13 @@ FORCEINLINE Matrix3x3 Matrix3x3::Transpose() const
 	);
 }
 
-FORCEINLINE const Vector3& Matrix3x3::operator[](BYTE InIndex) const
+FORCEINLINE constexpr const Vector3& Matrix3x3::operator[](BYTE InIndex) const
 {
 	assert(InIndex < Rank);
 	return Cols[InIndex];
 }
 
-FORCEINLINE Vector3& Matrix3x3::operator[](BYTE InIndex)
+FORCEINLINE constexpr Vector3& Matrix3x3::operator[](BYTE InIndex)
 {
 	assert(InIndex < Rank);
 	return Cols[InIndex];
@@ -79,25 +82,53 @@ FORCEINLINE Matrix3x3 Matrix3x3::operator*(float InScalar) const
 	);
 }
 
-FORCEINLINE Matrix3x3 Matrix3x3::operator*(const Matrix3x3 &InMatrix) const
+FORCEINLINE constexpr Matrix3x3 Matrix3x3::operator*(const Matrix3x3 &InMatrix) const
 {
-	Matrix3x3 transposedMatrix = Transpose();
-	return Matrix3x3(
-		Vector3(transposedMatrix[0].Dot(InMatrix[0]), transposedMatrix[1].Dot(InMatrix[0]), transposedMatrix[2].Dot(InMatrix[0])),
-		Vector3(transposedMatrix[0].Dot(InMatrix[1]), transposedMatrix[1].Dot(InMatrix[1]), transposedMatrix[2].Dot(InMatrix[1])),
-		Vector3(transposedMatrix[0].Dot(InMatrix[2]), transposedMatrix[1].Dot(InMatrix[2]), transposedMatrix[2].Dot(InMatrix[2]))
-	);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		Matrix3x3 transposedMatrix = Transpose();
+		return Matrix3x3(
+			Vector3(transposedMatrix.Cols[0].Dot(InMatrix.Cols[0]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[0]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[0])),
+			Vector3(transposedMatrix.Cols[0].Dot(InMatrix.Cols[1]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[1]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[1])),
+			Vector3(transposedMatrix.Cols[0].Dot(InMatrix.Cols[2]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[2]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[2]))
+		);
+	}
+
+	// Vector3는 12바이트이므로 배열 끝을 넘어 읽지 않도록 3개씩 불러온다.
+	const VectorRegister col0 = VectorLoadFloat3(Cols[0].Scalars.data());
+	const VectorRegister col1 = VectorLoadFloat3(Cols[1].Scalars.data());
+	const VectorRegister col2 = VectorLoadFloat3(Cols[2].Scalars.data());
 
+	Matrix3x3 result;
+	for (BYTE i = 0; i < Rank; ++i)
+	{
+		VectorRegister v = VectorLoadFloat3(InMatrix.Cols[i].Scalars.data());
+		VectorStoreFloat3(VectorTransformVector(v, col0, col1, col2), result.Cols[i].Scalars.data());
+	}
+	return result;
 }
 
-FORCEINLINE Vector3 Matrix3x3::operator*(const Vector3& InVector) const
+FORCEINLINE constexpr Vector3 Matrix3x3::operator*(const Vector3& InVector) const
 {
-	Matrix3x3 transposedMatrix = Transpose();
-	return Vector3(
-		transposedMatrix[0].Dot(InVector),
-		transposedMatrix[1].Dot(InVector),
-		transposedMatrix[2].Dot(InVector)
-	);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		Matrix3x3 transposedMatrix = Transpose();
+		return Vector3(
+			transposedMatrix.Cols[0].Dot(InVector),
+			transposedMatrix.Cols[1].Dot(InVector),
+			transposedMatrix.Cols[2].Dot(InVector)
+		);
+	}
+
+	VectorRegister v = VectorLoadFloat3(InVector.Scalars.data());
+	v = VectorTransformVector(v,
+		VectorLoadFloat3(Cols[0].Scalars.data()),
+		VectorLoadFloat3(Cols[1].Scalars.data()),
+		VectorLoadFloat3(Cols[2].Scalars.data()));
+
+	Vector3 result;
+	VectorStoreFloat3(v, result.Scalars.data());
+	return result;
 }
 
 FORCEINLINE Vector2 Matrix3x3::operator*(const Vector2& InVector) const
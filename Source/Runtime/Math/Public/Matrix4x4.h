@@ -3,16 +3,16 @@
 namespace CK
 {
 
-struct Matrix4x4
+struct alignas(16) Matrix4x4
 {
 public:
-	//  
+	// 생성자 
 	FORCEINLINE constexpr Matrix4x4() = default;
 	FORCEINLINE explicit constexpr Matrix4x4(const Vector4& InCol0, const Vector4& InCol1, const Vector4& InCol2, const Vector4& InCol3) { Cols = { InCol0, InCol1, InCol2, InCol3 }; }
 
-	//  
-	FORCEINLINE const Vector4& operator[](BYTE InIndex) const;
-	FORCEINLINE Vector4& operator[](BYTE InIndex);
+	// 연산자 
+	FORCEINLINE constexpr const Vector4& operator[](BYTE InIndex) const;
+	FORCEINLINE constexpr Vector4& operator[](BYTE InIndex);
 	FORCEINLINE constexpr Matrix4x4 operator*(float InScalar) const;
 	FORCEINLINE constexpr Matrix4x4 operator*(const Matrix4x4& InMatrix) const;
 	FORCEINLINE constexpr Vector4 operator*(const Vector4& InVector) const;
@@ -28,21 +28,24 @@ public:
 		return InVector;
 	}
 
-	// Լ 
+	// 멤버함수 
 	FORCEINLINE Matrix3x3 ToMatrix3x3() const;
 	FORCEINLINE void SetIdentity();
 	FORCEINLINE constexpr Matrix4x4 Transpose() const;
 
 	std::vector<std::string> ToStrings() const;
 
-	//  
+	// 정적멤버변수 
 	static const Matrix4x4 Identity;
 	static constexpr BYTE Rank = 4;
 
-	//  
+	// 멤버변수 
 	std::array<Vector4, Rank> Cols = { Vector4::UnitX, Vector4::UnitY, Vector4::UnitZ, Vector4::UnitW };
 };
 
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Matrix4x4 Matrix4x4::Identity(Vector4(1.f, 0.f, 0.f, 0.f), Vector4(0.f, 1.f, 0.f, 0.f), Vector4(0.f, 0.f, 1.f, 0.f), Vector4(0.f, 0.f, 0.f, 1.f));
+
 FORCEINLINE void Matrix4x4::SetIdentity()
 {
 	*this = Matrix4x4::Identity;
@@ -58,13 +61,13 @@ FORCEINLINE constexpr Matrix4x4 Matrix4x4::Transpose() const
 	);
 }
 
-FORCEINLINE const Vector4& Matrix4x4::operator[](BYTE InIndex) const
+FORCEINLINE constexpr const Vector4& Matrix4x4::operator[](BYTE InIndex) const
 {
 	assert(InIndex < Rank);
 	return Cols[InIndex];
 }
 
-FORCEINLINE Vector4& Matrix4x4::operator[](BYTE InIndex)
+FORCEINLINE constexpr Vector4& Matrix4x4::operator[](BYTE InIndex)
 {
 	assert(InIndex < Rank);
 	return Cols[InIndex];
@@ -82,24 +85,55 @@ FORCEINLINE constexpr Matrix4x4 Matrix4x4::operator*(float InScalar) const
 
 FORCEINLINE constexpr Matrix4x4 Matrix4x4::operator*(const Matrix4x4 &InMatrix) const
 {
-	Matrix4x4 transposedMatrix = Transpose();
-	return Matrix4x4(
-		Vector4(transposedMatrix[0].Dot(InMatrix[0]), transposedMatrix[1].Dot(InMatrix[0]), transposedMatrix[2].Dot(InMatrix[0]), transposedMatrix[3].Dot(InMatrix[0])),
-		Vector4(transposedMatrix[0].Dot(InMatrix[1]), transposedMatrix[1].Dot(InMatrix[1]), transposedMatrix[2].Dot(InMatrix[1]), transposedMatrix[3].Dot(InMatrix[1])),
-		Vector4(transposedMatrix[0].Dot(InMatrix[2]), transposedMatrix[1].Dot(InMatrix[2]), transposedMatrix[2].Dot(InMatrix[2]), transposedMatrix[3].Dot(InMatrix[2])),
-		Vector4(transposedMatrix[0].Dot(InMatrix[3]), transposedMatrix[1].Dot(InMatrix[3]), transposedMatrix[2].Dot(InMatrix[3]), transposedMatrix[3].Dot(InMatrix[3]))
-	);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		Matrix4x4 transposedMatrix = Transpose();
+		return Matrix4x4(
+			Vector4(transposedMatrix.Cols[0].Dot(InMatrix.Cols[0]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[0]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[0]), transposedMatrix.Cols[3].Dot(InMatrix.Cols[0])),
+			Vector4(transposedMatrix.Cols[0].Dot(InMatrix.Cols[1]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[1]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[1]), transposedMatrix.Cols[3].Dot(InMatrix.Cols[1])),
+			Vector4(transposedMatrix.Cols[0].Dot(InMatrix.Cols[2]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[2]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[2]), transposedMatrix.Cols[3].Dot(InMatrix.Cols[2])),
+			Vector4(transposedMatrix.Cols[0].Dot(InMatrix.Cols[3]), transposedMatrix.Cols[1].Dot(InMatrix.Cols[3]), transposedMatrix.Cols[2].Dot(InMatrix.Cols[3]), transposedMatrix.Cols[3].Dot(InMatrix.Cols[3]))
+		);
+	}
+
+	// 런타임에는 전치 행렬을 만들지 않고 각 열을 SIMD 레지스터로 변환
+	const VectorRegister col0 = VectorLoadAligned(Cols[0].Scalars.data());
+	const VectorRegister col1 = VectorLoadAligned(Cols[1].Scalars.data());
+	const VectorRegister col2 = VectorLoadAligned(Cols[2].Scalars.data());
+	const VectorRegister col3 = VectorLoadAligned(Cols[3].Scalars.data());
+
+	Matrix4x4 result;
+	for (BYTE i = 0; i < Rank; ++i)
+	{
+		VectorRegister v = VectorLoadAligned(InMatrix.Cols[i].Scalars.data());
+		VectorStoreAligned(VectorTransformVector(v, col0, col1, col2, col3), result.Cols[i].Scalars.data());
+	}
+	return result;
 }
 
 FORCEINLINE constexpr Vector4 Matrix4x4::operator*(const Vector4& InVector) const
 {
-	Matrix4x4 transposedMatrix = Transpose();
-	return Vector4(
-		transposedMatrix[0].Dot(InVector),
-		transposedMatrix[1].Dot(InVector),
-		transposedMatrix[2].Dot(InVector),
-		transposedMatrix[3].Dot(InVector)
-	);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		Matrix4x4 transposedMatrix = Transpose();
+		return Vector4(
+			transposedMatrix.Cols[0].Dot(InVector),
+			transposedMatrix.Cols[1].Dot(InVector),
+			transposedMatrix.Cols[2].Dot(InVector),
+			transposedMatrix.Cols[3].Dot(InVector)
+		);
+	}
+
+	VectorRegister v = VectorLoad(InVector.Scalars.data());
+	v = VectorTransformVector(v,
+		VectorLoadAligned(Cols[0].Scalars.data()),
+		VectorLoadAligned(Cols[1].Scalars.data()),
+		VectorLoadAligned(Cols[2].Scalars.data()),
+		VectorLoadAligned(Cols[3].Scalars.data()));
+
+	Vector4 result;
+	VectorStore(v, result.Scalars.data());
+	return result;
 }
 
 FORCEINLINE constexpr Vector3 Matrix4x4::operator*(const Vector3& InVector) const
@@ -0,0 +1,101 @@
+#pragma once
+
+namespace CK
+{
+
+// 임의의 방향으로 회전된 바운딩 박스. 중심과 서로 수직인 세 단위 축, 각 축 방향의 반 크기로 표현한다.
+struct OrientedBox
+{
+public:
+	// 생성자
+	FORCEINLINE constexpr OrientedBox() = default;
+	FORCEINLINE constexpr OrientedBox(const Vector3& InCenter, const std::array<Vector3, 3>& InAxes, const Vector3& InExtent) : Center(InCenter), Axes(InAxes), Extent(InExtent) { }
+	FORCEINLINE explicit constexpr OrientedBox(const Box& InBox);
+	FORCEINLINE constexpr OrientedBox(const Box& InBox, const Transform& InTransform);
+	FORCEINLINE constexpr OrientedBox(const Box& InBox, const Affine3x4& InMatrix); // 전단이 없는 행렬을 가정
+	OrientedBox(const std::vector<Vector3>& InVertices); // 정점 분포의 주성분 방향으로 맞춘 박스
+
+	// 멤버함수
+	FORCEINLINE constexpr bool IsInside(const Vector3& InPoint) const;
+	FORCEINLINE constexpr float GetProjectedExtent(const Vector3& InDirection) const;
+	FORCEINLINE constexpr Box GetBox() const;
+	FORCEINLINE constexpr void GetCorners(std::array<Vector3, 8>& OutCorners) const;
+	bool Intersect(const OrientedBox& InBox) const;
+
+public:
+	// 멤버변수
+	Vector3 Center;
+	std::array<Vector3, 3> Axes = { Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ };
+	Vector3 Extent;
+};
+
+FORCEINLINE constexpr OrientedBox::OrientedBox(const Box& InBox)
+{
+	InBox.GetCenterAndExtent(Center, Extent);
+}
+
+FORCEINLINE constexpr OrientedBox::OrientedBox(const Box& InBox, const Transform& InTransform)
+{
+	Vector3 localCenter, localExtent;
+	InBox.GetCenterAndExtent(localCenter, localExtent);
+
+	const Vector3 scale = InTransform.GetScale();
+	Center = InTransform.GetPosition() + InTransform.GetRotation() * (scale * localCenter);
+	Axes = { InTransform.GetXAxis(), InTransform.GetYAxis(), InTransform.GetZAxis() };
+	Extent = Vector3(localExtent.X * Math::Abs(scale.X), localExtent.Y * Math::Abs(scale.Y), localExtent.Z * Math::Abs(scale.Z));
+}
+
+FORCEINLINE constexpr OrientedBox::OrientedBox(const Box& InBox, const Affine3x4& InMatrix)
+{
+	Vector3 localCenter, localExtent;
+	InBox.GetCenterAndExtent(localCenter, localExtent);
+
+	// 행렬의 각 열이 박스의 축이 되며, 열의 길이는 축 방향의 크기로 반영한다.
+	Center = InMatrix.TransformPoint(localCenter);
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		const Vector3 column(InMatrix.Rows[0][i], InMatrix.Rows[1][i], InMatrix.Rows[2][i]);
+		const float length = column.Size();
+		Axes[i] = (length > SMALL_NUMBER) ? column * (1.f / length) : Vector3::Zero;
+		Extent[i] = localExtent[i] * length;
+	}
+}
+
+FORCEINLINE constexpr bool OrientedBox::IsInside(const Vector3& InPoint) const
+{
+	const Vector3 d = InPoint - Center;
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		if (Math::Abs(d.Dot(Axes[i])) > Extent[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// 주어진 방향으로 투영했을 때 중심에서 경계까지의 거리
+FORCEINLINE constexpr float OrientedBox::GetProjectedExtent(const Vector3& InDirection) const
+{
+	return Math::Abs(InDirection.Dot(Axes[0])) * Extent.X + Math::Abs(InDirection.Dot(Axes[1])) * Extent.Y + Math::Abs(InDirection.Dot(Axes[2])) * Extent.Z;
+}
+
+// 회전된 박스를 감싸는 축 정렬 박스
+FORCEINLINE constexpr Box OrientedBox::GetBox() const
+{
+	const Vector3 worldExtent(GetProjectedExtent(Vector3::UnitX), GetProjectedExtent(Vector3::UnitY), GetProjectedExtent(Vector3::UnitZ));
+	return Box(Center - worldExtent, Center + worldExtent);
+}
+
+// 꼭지점의 순서는 축 별로 음수 방향을 0, 양수 방향을 1로 했을 때 X 비트가 가장 낮은 이진수의 순서
+FORCEINLINE constexpr void OrientedBox::GetCorners(std::array<Vector3, 8>& OutCorners) const
+{
+	const Vector3 x = Axes[0] * Extent.X, y = Axes[1] * Extent.Y, z = Axes[2] * Extent.Z;
+	for (BYTE i = 0; i < 8; ++i)
+	{
+		OutCorners[i] = Center + ((i & 1) ? x : -x) + ((i & 2) ? y : -y) + ((i & 4) ? z : -z);
+	}
+}
+
+}
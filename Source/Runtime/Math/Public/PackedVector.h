@@ -0,0 +1,239 @@
+#pragma once
+
+namespace CK
+{
+
+// 메시와 텍스쳐 데이터를 작게 저장하기 위한 압축 벡터 타입 모음.
+// 계산은 float 벡터로 풀어서 진행하고, 저장할 때만 압축된 형태를 사용한다.
+
+// 16비트 부동소수점. 부호 1비트, 지수 5비트, 가수 10비트로 구성되며 가장 가까운 짝수로 반올림한다.
+struct Half
+{
+public:
+	// 생성자
+	FORCEINLINE constexpr Half() = default;
+	FORCEINLINE explicit Half(float InValue) : Bits(FromFloat(InValue)) { }
+
+	// 멤버함수
+	FORCEINLINE float ToFloat() const { return ToFloat(Bits); }
+
+	FORCEINLINE static UINT16 FromFloat(float InValue);
+	FORCEINLINE static float ToFloat(UINT16 InBits);
+
+	// 배열 단위 변환. 네 개씩 SIMD로 처리한다.
+	static void Pack(const float* InValues, Half* OutValues, size_t InCount);
+	static void Unpack(const Half* InValues, float* OutValues, size_t InCount);
+
+	// 멤버변수
+	UINT16 Bits = 0;
+};
+
+struct Half2
+{
+public:
+	FORCEINLINE constexpr Half2() = default;
+	FORCEINLINE explicit Half2(const Vector2& InVector) : X(InVector.X), Y(InVector.Y) { }
+
+	FORCEINLINE Vector2 ToVector2() const { return Vector2(X.ToFloat(), Y.ToFloat()); }
+
+	Half X, Y;
+};
+
+struct Half4
+{
+public:
+	FORCEINLINE constexpr Half4() = default;
+	FORCEINLINE explicit Half4(const Vector4& InVector) { Half::Pack(InVector.Scalars.data(), &X, 4); }
+
+	FORCEINLINE Vector4 ToVector4() const
+	{
+		Vector4 result;
+		Half::Unpack(&X, result.Scalars.data(), 4);
+		return result;
+	}
+
+	Half X, Y, Z, W;
+};
+
+// [-1, 1] 범위의 값을 16비트 부호 있는 정수로 저장. 노멀과 탄젠트 저장에 사용한다.
+struct SNorm16x4
+{
+public:
+	FORCEINLINE constexpr SNorm16x4() = default;
+	FORCEINLINE explicit SNorm16x4(const Vector4& InVector);
+
+	FORCEINLINE Vector4 ToVector4() const;
+
+	static void Pack(const Vector4* InVectors, SNorm16x4* OutValues, size_t InCount);
+	static void Unpack(const SNorm16x4* InValues, Vector4* OutVectors, size_t InCount);
+
+	INT16 X = 0, Y = 0, Z = 0, W = 0;
+};
+
+// [0, 1] 범위의 값을 8비트 부호 없는 정수로 저장. 색상 저장에 사용한다.
+struct UNorm8x4
+{
+public:
+	FORCEINLINE constexpr UNorm8x4() = default;
+	FORCEINLINE explicit constexpr UNorm8x4(BYTE InX, BYTE InY, BYTE InZ, BYTE InW) : X(InX), Y(InY), Z(InZ), W(InW) { }
+	FORCEINLINE explicit UNorm8x4(const Vector4& InVector);
+
+	FORCEINLINE Vector4 ToVector4() const;
+
+	static void Pack(const Vector4* InVectors, UNorm8x4* OutValues, size_t InCount);
+	static void Unpack(const UNorm8x4* InValues, Vector4* OutVectors, size_t InCount);
+
+	BYTE X = 0, Y = 0, Z = 0, W = 0;
+};
+
+FORCEINLINE UINT16 Half::FromFloat(float InValue)
+{
+	// 비트 연산만으로 변환 (Fabian Giesen의 float_to_half_fast3_rtne)
+	constexpr UINT32 f32Infinity = 255u << 23;
+	constexpr UINT32 f16Max = (127u + 16u) << 23;
+	constexpr UINT32 denormalMagicBits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+	UINT32 bits = 0;
+	std::memcpy(&bits, &InValue, sizeof(float));
+	const UINT32 sign = bits & 0x80000000u;
+	bits ^= sign;
+
+	UINT16 result = 0;
+	if (bits >= f16Max)
+	{
+		// 표현 범위를 넘으면 무한대, NaN은 NaN으로
+		result = (bits > f32Infinity) ? 0x7E00 : 0x7C00;
+	}
+	else if (bits < (113u << 23))
+	{
+		// 비정규화 수는 덧셈으로 가수를 정렬해 반올림
+		float denormalMagic = 0.f, value = 0.f;
+		std::memcpy(&denormalMagic, &denormalMagicBits, sizeof(float));
+		std::memcpy(&value, &bits, sizeof(float));
+		value += denormalMagic;
+		std::memcpy(&bits, &value, sizeof(float));
+		result = static_cast<UINT16>(bits - denormalMagicBits);
+	}
+	else
+	{
+		const UINT32 mantissaOdd = (bits >> 13) & 1u;
+		bits += ((15u - 127u) << 23) + 0xFFFu;
+		bits += mantissaOdd;
+		result = static_cast<UINT16>(bits >> 13);
+	}
+
+	return static_cast<UINT16>(result | (sign >> 16));
+}
+
+FORCEINLINE float Half::ToFloat(UINT16 InBits)
+{
+	constexpr UINT32 shiftedExponent = 0x7C00u << 13;
+	constexpr UINT32 magicBits = 113u << 23;
+
+	UINT32 bits = (InBits & 0x7FFFu) << 13;
+	const UINT32 exponent = shiftedExponent & bits;
+	bits += (127u - 15u) << 23;
+
+	float result = 0.f;
+	if (exponent == shiftedExponent)
+	{
+		// 무한대와 NaN
+		bits += (128u - 16u) << 23;
+		std::memcpy(&result, &bits, sizeof(float));
+	}
+	else if (exponent == 0)
+	{
+		// 비정규화 수
+		float magic = 0.f;
+		std::memcpy(&magic, &magicBits, sizeof(float));
+		bits += 1u << 23;
+		std::memcpy(&result, &bits, sizeof(float));
+		result -= magic;
+	}
+	else
+	{
+		std::memcpy(&result, &bits, sizeof(float));
+	}
+
+	UINT32 resultBits = 0;
+	std::memcpy(&resultBits, &result, sizeof(float));
+	resultBits |= static_cast<UINT32>(InBits & 0x8000u) << 16;
+	std::memcpy(&result, &resultBits, sizeof(float));
+	return result;
+}
+
+FORCEINLINE SNorm16x4::SNorm16x4(const Vector4& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	// 범위를 제한하고 32767을 곱해 반올림한 후 16비트로 포화 변환
+	__m128 v = _mm_loadu_ps(InVector.Scalars.data());
+	v = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.f)), _mm_set1_ps(1.f));
+	const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(32767.f))), _mm_setzero_si128());
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(&X), packed);
+#else
+	INT16* components[4] = { &X, &Y, &Z, &W };
+	for (BYTE i = 0; i < 4; ++i)
+	{
+		*components[i] = static_cast<INT16>(Math::RountToInt(Math::Clamp(InVector[i], -1.f, 1.f) * 32767.f));
+	}
+#endif
+}
+
+FORCEINLINE Vector4 SNorm16x4::ToVector4() const
+{
+	// -32768은 -1로 취급
+	Vector4 result;
+#if defined(CK_SIMD_SSE)
+	const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&X));
+	const __m128i expanded = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+	const __m128 v = _mm_mul_ps(_mm_cvtepi32_ps(expanded), _mm_set1_ps(1.f / 32767.f));
+	_mm_storeu_ps(result.Scalars.data(), _mm_max_ps(v, _mm_set1_ps(-1.f)));
+#else
+	const INT16 components[4] = { X, Y, Z, W };
+	for (BYTE i = 0; i < 4; ++i)
+	{
+		result[i] = Math::Max(static_cast<float>(components[i]) * (1.f / 32767.f), -1.f);
+	}
+#endif
+	return result;
+}
+
+FORCEINLINE UNorm8x4::UNorm8x4(const Vector4& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	// 범위를 제한하고 255를 곱해 반올림한 후 8비트로 포화 변환
+	__m128 v = _mm_loadu_ps(InVector.Scalars.data());
+	v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.f));
+	__m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(255.f))), _mm_setzero_si128());
+	packed = _mm_packus_epi16(packed, packed);
+	const int bits = _mm_cvtsi128_si32(packed);
+	std::memcpy(&X, &bits, sizeof(int));
+#else
+	BYTE* components[4] = { &X, &Y, &Z, &W };
+	for (BYTE i = 0; i < 4; ++i)
+	{
+		*components[i] = static_cast<BYTE>(Math::RountToInt(Math::Clamp(InVector[i], 0.f, 1.f) * 255.f));
+	}
+#endif
+}
+
+FORCEINLINE Vector4 UNorm8x4::ToVector4() const
+{
+	Vector4 result;
+#if defined(CK_SIMD_SSE)
+	int bits = 0;
+	std::memcpy(&bits, &X, sizeof(int));
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i expanded = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bits), zero), zero);
+	_mm_storeu_ps(result.Scalars.data(), _mm_mul_ps(_mm_cvtepi32_ps(expanded), _mm_set1_ps(1.f / 255.f)));
+#else
+	const BYTE components[4] = { X, Y, Z, W };
+	for (BYTE i = 0; i < 4; ++i)
+	{
+		result[i] = static_cast<float>(components[i]) * (1.f / 255.f);
+	}
+#endif
+	return result;
+}
+
+}
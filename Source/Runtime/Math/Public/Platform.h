@@ -10,3 +10,11 @@
 #define FORCEINLINE inline
 #endif
 
+// constexpr 함수 안에서 컴파일 타임 평가 중인지 확인. 지원하지 않는 컴파일러는 항상 컴파일 타임 경로를 사용한다.
+#if (defined(_MSC_VER) && _MSC_VER >= 1925) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9)
+#define CK_HAS_CONSTANT_EVALUATED 1
+#define CK_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define CK_HAS_CONSTANT_EVALUATED 0
+#define CK_IS_CONSTANT_EVALUATED() true
+#endif
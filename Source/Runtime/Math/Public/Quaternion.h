@@ -18,19 +18,19 @@ public:
 		FromRotator(InRotator);
 	}
 
-	FORCEINLINE Quaternion(const Vector3& InVector, const Vector3& InUp = Vector3::UnitY)
+	FORCEINLINE constexpr Quaternion(const Vector3& InVector, const Vector3& InUp = Vector3::UnitY)
 	{
 		FromVector(InVector, InUp);
 	}
 
-	FORCEINLINE Quaternion(const Matrix3x3& InMatrix)
+	FORCEINLINE constexpr Quaternion(const Matrix3x3& InMatrix)
 	{
 		FromMatrix(InMatrix);
 	}
 
-	// 
-	FORCEINLINE void FromMatrix(const Matrix3x3& InMatrix);
-	FORCEINLINE void FromVector(const Vector3& InVector, const Vector3& InUp = Vector3::UnitY);
+	// 생성
+	FORCEINLINE constexpr void FromMatrix(const Matrix3x3& InMatrix);
+	FORCEINLINE constexpr void FromVector(const Vector3& InVector, const Vector3& InUp = Vector3::UnitY);
 	FORCEINLINE constexpr void FromAxisAngle(const Vector3& InAxis, float InAngleDegree);
 	FORCEINLINE constexpr void FromRotator(const Rotator& InRotator);
 
@@ -38,17 +38,17 @@ public:
 	FORCEINLINE constexpr Quaternion operator*(const Quaternion& InQuaternion) const;
 	FORCEINLINE constexpr Quaternion operator*=(const Quaternion& InQuaternion);
 	FORCEINLINE constexpr Vector3 operator*(const Vector3& InVector) const;
-	static Quaternion Slerp(const Quaternion &InQuaternion1, const Quaternion &InQuaternion2, float InRatio);
+	FORCEINLINE static constexpr Quaternion Slerp(const Quaternion &InQuaternion1, const Quaternion &InQuaternion2, float InRatio);
 
 	FORCEINLINE constexpr Vector3 RotateVector(const Vector3& InVector) const;
 	FORCEINLINE constexpr Quaternion Inverse() const { return Quaternion(-X, -Y, -Z, W); }
 	FORCEINLINE constexpr float Dot(const Quaternion& InQuaternion) const { return X * InQuaternion.X + Y * InQuaternion.Y + Z * InQuaternion.Z + W * InQuaternion.W; }
-	FORCEINLINE float Angle(const Quaternion& InQuaternion) const { return acosf(Dot(InQuaternion)); }
-	FORCEINLINE void Normalize();
+	FORCEINLINE constexpr float Angle(const Quaternion& InQuaternion) const { return Math::Acos(Dot(InQuaternion)); }
+	FORCEINLINE constexpr void Normalize();
 	FORCEINLINE Rotator ToRotator() const;
-	FORCEINLINE bool IsUnitQuaternion() const
+	FORCEINLINE constexpr bool IsUnitQuaternion() const
 	{
-		float size = sqrtf(Dot(*this));
+		float size = Math::Sqrt(Dot(*this));
 		if (Math::EqualsInTolerance(size, 1.f))
 		{
 			return true;
@@ -70,20 +70,23 @@ public:
 	float W = 1.f;
 };
 
-FORCEINLINE void Quaternion::FromMatrix(const Matrix3x3& InMatrix)
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Quaternion Quaternion::Identity(0.f, 0.f, 0.f, 1.f);
+
+FORCEINLINE constexpr void Quaternion::FromMatrix(const Matrix3x3& InMatrix)
 {
 	float root = 0.f;
 	float trace = InMatrix[0][0] + InMatrix[1][1] + InMatrix[2][2];
 
 	if (!Math::EqualsInTolerance(InMatrix[0].SizeSquared(), 1.f) || !Math::EqualsInTolerance(InMatrix[1].SizeSquared(), 1.f) || !Math::EqualsInTolerance(InMatrix[2].SizeSquared(), 1.f))
 	{
-		*this = Quaternion::Identity;
+		*this = Quaternion();
 	}
 
 	if (trace > 0.f)
 	{
-		// W Ҹ ϰ  X,Y,Z 
-		root = sqrtf(trace + 1.f);
+		// W 요소를 구하고 나머지 X,Y,Z를 계산
+		root = Math::Sqrt(trace + 1.f);
 		W = 0.5f * root;
 		root = 0.5f / root;
 
@@ -95,43 +98,43 @@ FORCEINLINE void Quaternion::FromMatrix(const Matrix3x3& InMatrix)
 	{
 		BYTE i = 0;
 
-		// X,Y,Z ߿  ū Ҹ ľ
+		// X,Y,Z 중에서 가장 큰 요소를 파악
 		if (InMatrix[1][1] > InMatrix[0][0]) { i = 1; }
 		if (InMatrix[2][2] > InMatrix[i][i]) { i = 2; }
 
-		// i, j, k   
-		static const BYTE next[3] = { 1, 2, 0 };
+		// i, j, k 의 순서 지정
+		constexpr BYTE next[3] = { 1, 2, 0 };
 		BYTE j = next[i];
 		BYTE k = next[j];
 
-		//  ū   ϱ
-		root = sqrtf(InMatrix[i][i] - InMatrix[j][j] - InMatrix[k][k] + 1.f);
+		// 가장 큰 요소의 값을 구하기
+		root = Math::Sqrt(InMatrix[i][i] - InMatrix[j][j] - InMatrix[k][k] + 1.f);
 
 		float* qt[3] = { &X, &Y, &Z };
 		*qt[i] = 0.5f * root;
 
 		root = 0.5f / root;
 
-		//     ϱ
+		// 나머지 두 요소의 값을 구하기
 		*qt[j] = (InMatrix[i][j] + InMatrix[j][i]) * root;
 		*qt[k] = (InMatrix[i][k] + InMatrix[k][i]) * root;
 
-		//  W  ϱ
+		// 마지막 W 값 구하기
 		W = (InMatrix[j][k] - InMatrix[k][j]) * root;
 	}
 }
 
-FORCEINLINE void Quaternion::FromVector(const Vector3& InVector, const Vector3& InUp)
+FORCEINLINE constexpr void Quaternion::FromVector(const Vector3& InVector, const Vector3& InUp)
 {
 	Vector3 localX, localY, localZ;
 
-	//  Z 
+	// 단위 Z축 생성
 	localZ = InVector.GetNormalize();
-	// ü   Y  
+	// 시선 방향과 월드 Y축이 평행한 경우
 	if (Math::Abs(localZ.Y) >= (1.f - SMALL_NUMBER))
 	{
-		// Ư Ȳ  X ǥ  Ƿ .
-		localX = Vector3::UnitX;
+		// 특이 상황에서 로컬 X 좌표 값을 임의로 지정.
+		localX = Vector3(1.f, 0.f, 0.f);
 	}
 	else
 	{
@@ -201,21 +204,21 @@ FORCEINLINE constexpr Vector3 Quaternion::operator*(const Vector3& InVector) con
 	return RotateVector(InVector);
 }
 
-FORCEINLINE Quaternion Quaternion::Slerp(const Quaternion & InQuaternion1, const Quaternion & InQuaternion2, float InRatio)
+FORCEINLINE constexpr Quaternion Quaternion::Slerp(const Quaternion & InQuaternion1, const Quaternion & InQuaternion2, float InRatio)
 {
 	Quaternion q1 = InQuaternion1, q2 = InQuaternion2;
 
-	//   ϱ
+	// 사원수의 내적 구하기
 	float dot = q1.Dot(q2);
 
-	//   0  ִܰŸ ϵ  ȯ
+	// 내적 값이 0보다 작으면 최단거리를 사용하도록 방향을 전환
 	if (dot < 0.0f) {
 		q1 = -q1;
 		dot = -dot;
 	}
 
 	float alpha = 1.f, beta = 0.f;
-	//   հ    
+	// 두 사원수의 사잇각이 작으면 선형 보간으로 수행
 	if (dot > 0.9995f)
 	{
 		alpha = 1.0f - InRatio;
@@ -223,10 +226,10 @@ FORCEINLINE Quaternion Quaternion::Slerp(const Quaternion & InQuaternion1, const
 	}
 	else
 	{
-		const float theta = acosf(dot);
-		const float invSin = 1.f / sinf(theta);
-		alpha = sinf((1.f - InRatio) * theta) * invSin;
-		beta = sinf(InRatio * theta) * invSin;
+		const float theta = Math::Acos(dot);
+		const float invSin = 1.f / Math::Sin(theta);
+		alpha = Math::Sin((1.f - InRatio) * theta) * invSin;
+		beta = Math::Sin(InRatio * theta) * invSin;
 	}
 
 	Quaternion result;
@@ -246,13 +249,13 @@ FORCEINLINE constexpr Vector3 Quaternion::RotateVector(const Vector3& InVector)
 	return result;
 }
 
-FORCEINLINE void Quaternion::Normalize()
+FORCEINLINE constexpr void Quaternion::Normalize()
 {
 	const float squareSum = X * X + Y * Y + Z * Z + W * W;
 
 	if (squareSum >= SMALL_NUMBER)
 	{
-		const float scale = 1.f / sqrtf(squareSum);
+		const float scale = 1.f / Math::Sqrt(squareSum);
 
 		X *= scale;
 		Y *= scale;
@@ -261,7 +264,7 @@ FORCEINLINE void Quaternion::Normalize()
 	}
 	else
 	{
-		*this = Quaternion::Identity;
+		*this = Quaternion();
 	}
 }
 
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace CK
+{
+
+// 사원수 배열을 일괄 계산하는 함수 모음. 입력과 출력 배열은 같아도 된다.
+// 벡터는 VectorBatch와 같이 성분별로 나눈 배열(SoA)로 전달한다.
+struct QuaternionBatch
+{
+	// OutQuaternions[i] = InQuaternions1[i] * InQuaternions2[i]
+	static void Multiply(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, Quaternion* OutQuaternions, size_t InCount);
+
+	// i번째 벡터를 i번째 사원수로 회전
+	static void RotateVectors(const Quaternion* InQuaternions,
+		const float* InX, const float* InY, const float* InZ,
+		float* OutX, float* OutY, float* OutZ, size_t InCount);
+
+	// 최단 경로로 선형 보간한 후 정규화. 각속도가 일정하지 않은 대신 가장 빠르다.
+	static void Nlerp(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, const float* InRatios, Quaternion* OutQuaternions, size_t InCount);
+
+	// Quaternion::Slerp와 같은 식을 벡터 근사 함수로 계산. Quaternion::Slerp와의 차이는 성분당 약 5e-7
+	static void Slerp(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, const float* InRatios, Quaternion* OutQuaternions, size_t InCount);
+
+	// 보간 비율을 3차 다항식으로 보정한 Nlerp로 Slerp를 근사. 역삼각함수 없이 계산하며
+	// 두 사원수의 사잇각이 180도 이내일 때 Slerp 결과와의 최대 회전 각도 오차는 약 1.5e-3 라디안(0.08도)이다. 보정하지 않은 Nlerp는 약 0.14 라디안
+	static void FastSlerp(const Quaternion* InQuaternions1, const Quaternion* InQuaternions2, const float* InRatios, Quaternion* OutQuaternions, size_t InCount);
+};
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+namespace CK
+{
+
+// 시작점에서 한 방향으로 뻗어나가는 반직선. 교차 거리는 방향 벡터의 길이를 단위로 한다.
+struct Ray
+{
+public:
+	// 생성자
+	FORCEINLINE constexpr Ray() = default;
+	FORCEINLINE constexpr Ray(const Vector3& InOrigin, const Vector3& InDirection) : Origin(InOrigin), Direction(InDirection) { }
+
+	// 멤버함수
+	FORCEINLINE constexpr Vector3 GetPoint(float InDistance) const { return Origin + Direction * InDistance; }
+	FORCEINLINE constexpr bool Intersect(const Sphere& InSphere, float& OutDistance) const;
+	FORCEINLINE constexpr bool Intersect(const Box& InBox, float& OutDistance) const;
+	FORCEINLINE constexpr bool IntersectTriangle(const Vector3& InV0, const Vector3& InV1, const Vector3& InV2, float& OutDistance, float& OutU, float& OutV) const;
+
+public:
+	// 멤버변수
+	Vector3 Origin;
+	Vector3 Direction = Vector3::UnitZ;
+};
+
+// 시작점이 구 안에 있으면 거리는 0
+FORCEINLINE constexpr bool Ray::Intersect(const Sphere& InSphere, float& OutDistance) const
+{
+	const Vector3 m = Origin - InSphere.Center;
+	const float a = Direction.SizeSquared();
+	const float b = m.Dot(Direction);
+	const float c = m.SizeSquared() - InSphere.Radius * InSphere.Radius;
+
+	// 구 밖에서 멀어지는 방향이면 교차하지 않음
+	if (c > 0.f && b > 0.f)
+	{
+		return false;
+	}
+
+	const float discriminant = b * b - a * c;
+	if (discriminant < 0.f || a < SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	OutDistance = Math::Max((-b - Math::Sqrt(discriminant)) / a, 0.f);
+	return true;
+}
+
+// 세 축의 평행한 두 평면 사이를 지나는 구간을 겹쳐서 판정 (슬랩 검사). 시작점이 박스 안에 있으면 거리는 0
+FORCEINLINE constexpr bool Ray::Intersect(const Box& InBox, float& OutDistance) const
+{
+	float tMin = 0.f;
+	float tMax = 0.f;
+	bool hasRange = false;
+	for (BYTE i = 0; i < 3; ++i)
+	{
+		if (Math::Abs(Direction[i]) <= SMALL_NUMBER)
+		{
+			// 축과 평행하면 시작점이 슬랩 안에 있어야 한다.
+			if (Origin[i] < InBox.Min[i] || Origin[i] > InBox.Max[i])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const float invDirection = 1.f / Direction[i];
+		const float tNear = (InBox.Min[i] - Origin[i]) * invDirection;
+		const float tFar = (InBox.Max[i] - Origin[i]) * invDirection;
+		const float t1 = Math::Min(tNear, tFar);
+		const float t2 = Math::Max(tNear, tFar);
+
+		tMin = hasRange ? Math::Max(tMin, t1) : t1;
+		tMax = hasRange ? Math::Min(tMax, t2) : t2;
+		hasRange = true;
+		if (tMin > tMax)
+		{
+			return false;
+		}
+	}
+
+	if (hasRange && tMax < 0.f)
+	{
+		return false;
+	}
+
+	OutDistance = Math::Max(tMin, 0.f);
+	return true;
+}
+
+// 묄러-트럼보어 알고리즘. 양면을 모두 판정하며 OutU, OutV는 InV1, InV2에 대한 무게중심 좌표
+FORCEINLINE constexpr bool Ray::IntersectTriangle(const Vector3& InV0, const Vector3& InV1, const Vector3& InV2, float& OutDistance, float& OutU, float& OutV) const
+{
+	const Vector3 edge1 = InV1 - InV0;
+	const Vector3 edge2 = InV2 - InV0;
+	const Vector3 p = Direction.Cross(edge2);
+	const float determinant = edge1.Dot(p);
+	if (Math::Abs(determinant) < SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const float invDeterminant = 1.f / determinant;
+	const Vector3 s = Origin - InV0;
+	const float u = s.Dot(p) * invDeterminant;
+	if (u < 0.f || u > 1.f)
+	{
+		return false;
+	}
+
+	const Vector3 q = s.Cross(edge1);
+	const float v = Direction.Dot(q) * invDeterminant;
+	if (v < 0.f || u + v > 1.f)
+	{
+		return false;
+	}
+
+	const float t = edge2.Dot(q) * invDeterminant;
+	if (t < 0.f)
+	{
+		return false;
+	}
+
+	OutDistance = t;
+	OutU = u;
+	OutV = v;
+	return true;
+}
+
+}
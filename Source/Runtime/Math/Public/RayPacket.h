@@ -0,0 +1,49 @@
+#pragma once
+
+namespace CK
+{
+
+// 네 개의 반직선을 성분별로 나누어(SoA) 레지스터에 담은 묶음. 하나의 도형을 네 반직선과 한 번에 판정한다.
+// 판정 함수는 교차한 레인의 비트가 켜진 4비트 마스크를 반환한다.
+struct RayPacket
+{
+public:
+	// 생성자
+	RayPacket() = default;
+	RayPacket(const Ray* InRays, size_t InCount);
+
+	// 멤버함수
+	FORCEINLINE int GetActiveMask() const { return ActiveMask; }
+	FORCEINLINE Ray GetRay(BYTE InLane) const;
+
+	// InMaxDistance보다 가까이에서 교차하면 진입 거리를 OutDistance에 기록. 시작점이 안에 있으면 거리는 0
+	int Intersect(const Sphere& InSphere, const VectorRegister& InMaxDistance, VectorRegister& OutDistance) const;
+	int Intersect(const Box& InBox, const VectorRegister& InMaxDistance, VectorRegister& OutDistance) const;
+
+	// 지금까지 찾은 거리보다 가까운 삼각형과 교차한 레인만 거리와 무게중심 좌표를 갱신
+	int IntersectTriangle(const Vector3& InV0, const Vector3& InV1, const Vector3& InV2, VectorRegister& InOutDistance, VectorRegister& InOutU, VectorRegister& InOutV) const;
+
+	// 정적멤버변수
+	static constexpr BYTE Lanes = 4;
+
+	// 멤버변수
+	VectorRegister OriginX, OriginY, OriginZ;
+	VectorRegister DirectionX, DirectionY, DirectionZ;
+	VectorRegister InvDirectionX, InvDirectionY, InvDirectionZ; // 슬랩 검사용. 0인 성분은 아주 작은 값으로 바꾸어 역수를 구한다.
+	int ActiveMask = 0; // 반직선이 네 개보다 적게 담긴 경우 사용하지 않는 레인을 제외하기 위한 마스크
+};
+
+FORCEINLINE Ray RayPacket::GetRay(BYTE InLane) const
+{
+	assert(InLane < Lanes);
+	float values[6][Lanes];
+	const VectorRegister* streams[6] = { &OriginX, &OriginY, &OriginZ, &DirectionX, &DirectionY, &DirectionZ };
+	for (BYTE i = 0; i < 6; ++i)
+	{
+		VectorStore(*streams[i], values[i]);
+	}
+
+	return Ray(Vector3(values[0][InLane], values[1][InLane], values[2][InLane]), Vector3(values[3][InLane], values[4][InLane], values[5][InLane]));
+}
+
+}
@@ -21,6 +21,7 @@ public:
 	FORCEINLINE constexpr Vector2 GetSize() const;
 	FORCEINLINE constexpr Vector2 GetExtent() const;
 	FORCEINLINE constexpr void GetCenterAndExtent(Vector2& OutCenter, Vector2& OutExtent) const;
+	FORCEINLINE constexpr Rectangle TransformBy(const Matrix3x3& InMatrix) const;
 
 public:
 	Vector2 Min;
@@ -88,4 +89,22 @@ FORCEINLINE constexpr void Rectangle::GetCenterAndExtent(Vector2 & OutCenter, Ve
 	OutCenter = Min + OutExtent;
 }
 
+// 아핀 변환을 적용한 후 이를 감싸는 사각형을 계산. 중심은 그대로 변환하고 크기는 행렬 원소의 절대값으로 투영한다.
+FORCEINLINE constexpr Rectangle Rectangle::TransformBy(const Matrix3x3& InMatrix) const
+{
+	Vector2 center, extent;
+	GetCenterAndExtent(center, extent);
+
+	const Vector2 newCenter(
+		InMatrix.Cols[0].X * center.X + InMatrix.Cols[1].X * center.Y + InMatrix.Cols[2].X,
+		InMatrix.Cols[0].Y * center.X + InMatrix.Cols[1].Y * center.Y + InMatrix.Cols[2].Y
+	);
+	const Vector2 newExtent(
+		Math::Abs(InMatrix.Cols[0].X) * extent.X + Math::Abs(InMatrix.Cols[1].X) * extent.Y,
+		Math::Abs(InMatrix.Cols[0].Y) * extent.X + Math::Abs(InMatrix.Cols[1].Y) * extent.Y
+	);
+
+	return Rectangle(newCenter - newExtent, newCenter + newExtent);
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+namespace CK
+{
+
+// 평면을 같은 크기의 칸으로 나누고 각 칸에 겹치는 사각형을 등록하는 균일 격자.
+// 한 번이라도 사용한 칸만 해시 테이블에 만들기 때문에 월드의 크기에 제한이 없으며,
+// 물체가 움직여도 걸치는 칸의 범위가 같으면 칸 목록은 고치지 않는다.
+// 비워진 칸은 다시 쓰일 때를 위해 남겨 두고 Clear를 호출할 때 모두 해제한다.
+class RectangleGrid
+{
+public:
+	// 생성자
+	RectangleGrid(float InCellSize = 256.f) : _CellSize(InCellSize), _InvCellSize(1.f / InCellSize) { assert(InCellSize > 0.f); }
+
+public:
+	// 멤버함수
+	int Insert(const Rectangle& InRectangle, void* InUserData);
+	void Remove(int InProxy);
+	bool Move(int InProxy, const Rectangle& InRectangle); // 걸치는 칸이 바뀐 경우에만 칸 목록을 고치고 참을 반환
+	void Clear();
+
+	FORCEINLINE void* GetUserData(int InProxy) const { assert(IsValidProxy(InProxy)); return _Proxies[InProxy].UserData; }
+	FORCEINLINE const Rectangle& GetRectangle(int InProxy) const { assert(IsValidProxy(InProxy)); return _Proxies[InProxy].Bound; }
+	FORCEINLINE size_t GetProxyCount() const { return _ProxyCount; }
+	FORCEINLINE size_t GetCellCount() const { return _Cells.size(); }
+	FORCEINLINE float GetCellSize() const { return _CellSize; }
+
+	// 사각형과 겹치는 항목마다 InFunction(void* InUserData)를 한 번씩 호출
+	template <class TFunction>
+	void Query(const Rectangle& InRectangle, TFunction InFunction) const;
+
+	// 정적멤버변수
+	static constexpr int InvalidIndex = -1;
+
+private:
+	// 사각형이 걸치는 칸의 범위. 양 끝을 모두 포함한다.
+	struct CellRange
+	{
+		FORCEINLINE bool operator==(const CellRange& InRange) const { return MinX == InRange.MinX && MinY == InRange.MinY && MaxX == InRange.MaxX && MaxY == InRange.MaxY; }
+
+		int MinX = 0;
+		int MinY = 0;
+		int MaxX = -1;
+		int MaxY = -1;
+	};
+
+	struct Proxy
+	{
+		Rectangle Bound;
+		void* UserData = nullptr;
+		CellRange Cells;
+		int NextFree = InvalidIndex;
+		bool IsUsed = false;
+	};
+
+	FORCEINLINE bool IsValidProxy(int InProxy) const { return InProxy >= 0 && InProxy < static_cast<int>(_Proxies.size()) && _Proxies[InProxy].IsUsed; }
+	FORCEINLINE static UINT64 GetCellKey(int InX, int InY) { return (static_cast<UINT64>(static_cast<UINT32>(InX)) << 32) | static_cast<UINT32>(InY); }
+	CellRange GetCellRange(const Rectangle& InRectangle) const;
+	void AddToCells(int InProxy, const CellRange& InRange);
+	void RemoveFromCells(int InProxy, const CellRange& InRange);
+
+private:
+	// 멤버변수
+	std::vector<Proxy> _Proxies;
+	std::unordered_map<UINT64, std::vector<int>> _Cells;
+	int _FreeList = InvalidIndex;
+	size_t _ProxyCount = 0;
+	float _CellSize = 256.f;
+	float _InvCellSize = 1.f / 256.f;
+};
+
+template <class TFunction>
+void RectangleGrid::Query(const Rectangle& InRectangle, TFunction InFunction) const
+{
+	const CellRange queryRange = GetCellRange(InRectangle);
+	for (int y = queryRange.MinY; y <= queryRange.MaxY; ++y)
+	{
+		for (int x = queryRange.MinX; x <= queryRange.MaxX; ++x)
+		{
+			const auto it = _Cells.find(GetCellKey(x, y));
+			if (it == _Cells.end())
+			{
+				continue;
+			}
+
+			for (int proxyIndex : it->second)
+			{
+				// 여러 칸에 걸친 항목은 질의 범위와 겹치는 칸 중 첫 번째 칸에서만 전달해 중복을 막는다.
+				const Proxy& proxy = _Proxies[proxyIndex];
+				const int firstX = Math::Max(proxy.Cells.MinX, queryRange.MinX);
+				const int firstY = Math::Max(proxy.Cells.MinY, queryRange.MinY);
+				if (x != firstX || y != firstY)
+				{
+					continue;
+				}
+
+				if (proxy.Bound.Intersect(InRectangle))
+				{
+					InFunction(proxy.UserData);
+				}
+			}
+		}
+	}
+}
+
+}
@@ -47,4 +47,7 @@ public:
 	float Pitch = 0.f;
 };
 
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Rotator Rotator::Identity(0.f, 0.f, 0.f);
+
 }
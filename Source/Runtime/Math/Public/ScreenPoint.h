@@ -12,7 +12,7 @@ public:
 	FORCEINLINE explicit constexpr ScreenPoint(const Vector2& InPos) : ScreenPoint(InPos.X, InPos.Y) {}
 
 	constexpr ScreenPoint GetHalf() const { return ScreenPoint(Math::FloorToInt(0.5f * X), Math::FloorToInt(0.5f * Y)); }
-	constexpr float AspectRatio() const { return (float)X / (float)Y; } // Y  
+	constexpr float AspectRatio() const { return (float)X / (float)Y; } // Y축 기준으로 측정
 	FORCEINLINE constexpr bool HasZero() const { return ( X == 0 || Y == 0 ); }
 
 	FORCEINLINE static constexpr ScreenPoint ToScreenCoordinate(const ScreenPoint& InScreenSize, const Vector2& InPos)
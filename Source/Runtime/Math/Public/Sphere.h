@@ -7,6 +7,7 @@ struct Sphere
 {
 public:
 	FORCEINLINE constexpr Sphere() = default;
+	FORCEINLINE constexpr Sphere(const Vector3& InCenter, float InRadius) : Center(InCenter), Radius(InRadius) {};
 	FORCEINLINE constexpr Sphere(const Circle& InCircle) : Center(InCircle.Center), Radius(InCircle.Radius) {};
 	Sphere(const std::vector<Vector3>& InVertices);
 
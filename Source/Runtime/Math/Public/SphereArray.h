@@ -0,0 +1,74 @@
+#pragma once
+
+namespace CK
+{
+
+// 여러 구를 중심과 반지름의 성분별 배열(SoA)로 저장. 일괄 컬링에 사용한다.
+struct SphereArray
+{
+public:
+	// 멤버함수
+	FORCEINLINE size_t Size() const { return CenterX.size(); }
+	FORCEINLINE void Reserve(size_t InCount);
+	FORCEINLINE void Resize(size_t InCount);
+	FORCEINLINE void Clear();
+	FORCEINLINE size_t Add(const Sphere& InSphere);
+	FORCEINLINE void Set(size_t InIndex, const Sphere& InSphere);
+	FORCEINLINE Sphere Get(size_t InIndex) const;
+
+	// 멤버변수
+	std::vector<float> CenterX, CenterY, CenterZ;
+	std::vector<float> Radius;
+};
+
+FORCEINLINE void SphereArray::Reserve(size_t InCount)
+{
+	for (auto* stream : { &CenterX, &CenterY, &CenterZ, &Radius })
+	{
+		stream->reserve(InCount);
+	}
+}
+
+FORCEINLINE void SphereArray::Resize(size_t InCount)
+{
+	for (auto* stream : { &CenterX, &CenterY, &CenterZ, &Radius })
+	{
+		stream->resize(InCount);
+	}
+}
+
+FORCEINLINE void SphereArray::Clear()
+{
+	for (auto* stream : { &CenterX, &CenterY, &CenterZ, &Radius })
+	{
+		stream->clear();
+	}
+}
+
+FORCEINLINE size_t SphereArray::Add(const Sphere& InSphere)
+{
+	size_t index = Size();
+	Resize(index + 1);
+	Set(index, InSphere);
+	return index;
+}
+
+FORCEINLINE void SphereArray::Set(size_t InIndex, const Sphere& InSphere)
+{
+	assert(InIndex < Size());
+	CenterX[InIndex] = InSphere.Center.X;
+	CenterY[InIndex] = InSphere.Center.Y;
+	CenterZ[InIndex] = InSphere.Center.Z;
+	Radius[InIndex] = InSphere.Radius;
+}
+
+FORCEINLINE Sphere SphereArray::Get(size_t InIndex) const
+{
+	assert(InIndex < Size());
+	Sphere result;
+	result.Center = Vector3(CenterX[InIndex], CenterY[InIndex], CenterZ[InIndex]);
+	result.Radius = Radius[InIndex];
+	return result;
+}
+
+}
@@ -12,7 +12,7 @@ public:
 	FORCEINLINE constexpr Transform(const Vector3& InPosition, const Quaternion& InRotation, const Vector3& InScale) : Position(InPosition), Rotation(InRotation), Scale(InScale) { }
 	Transform(const Matrix4x4& InMatrix);
 
-public: // Ʈ Լ
+public: // 트랜스폼 설정함수
 	constexpr void SetPosition(const Vector3& InPosition) { Position = InPosition; }
 	constexpr void AddPosition(const Vector3& InDeltaPosition) { Position += InDeltaPosition; }
 	void AddYawRotation(float InDegree)
@@ -51,13 +51,13 @@ public: // Ʈ
 	FORCEINLINE constexpr Quaternion GetRotation() const { return Rotation; }
 	FORCEINLINE constexpr Vector3 GetScale() const { return Scale; }
 
-	// Ʈ ȯ
+	// 트랜스폼 변환
 	FORCEINLINE constexpr Transform Inverse() const;
 	FORCEINLINE constexpr Transform LocalToWorld(const Transform& InParentWorldTransform) const;
 	FORCEINLINE constexpr Transform WorldToLocal(const Transform& InParentWorldTransform) const;
 	FORCEINLINE constexpr Vector3 WorldToLocalVector(const Vector3& InWorldVector) const;
 
-private: // Ʈ õ 
+private: // 트랜스폼에 관련된 변수
 	Vector3 Position;
 	Quaternion Rotation;
 	Vector3 Scale = Vector3::One;
@@ -76,7 +76,7 @@ FORCEINLINE constexpr Matrix4x4 Transform::GetMatrix() const
 
 FORCEINLINE constexpr Transform Transform::Inverse() const
 {
-	//     Ʈ (  )
+	// 로컬 정보만 남기기 위한 트랜스폼 ( 역행렬 )
 	Vector3 reciprocalScale = Vector3::Zero;
 	if (!Math::EqualsInTolerance(Scale.X, 0.f)) reciprocalScale.X = 1.f / Scale.X;
 	if (!Math::EqualsInTolerance(Scale.Y, 0.f)) reciprocalScale.Y = 1.f / Scale.Y;
@@ -92,7 +92,7 @@ FORCEINLINE constexpr Transform Transform::Inverse() const
 
 FORCEINLINE constexpr Transform Transform::LocalToWorld(const Transform& InParentWorldTransform) const
 {
-	//  Ʈ   
+	// 현재 트랜스폼 정보가 로컬인 경우
 	Transform result;
 	result.SetScale(InParentWorldTransform.GetScale() * GetScale());
 	result.SetRotation(InParentWorldTransform.GetRotation() * GetRotation());
@@ -102,7 +102,7 @@ FORCEINLINE constexpr Transform Transform::LocalToWorld(const Transform& InParen
 
 FORCEINLINE constexpr Transform Transform::WorldToLocal(const Transform& InParentWorldTransform) const
 {
-	//  Ʈ   
+	// 현재 트랜스폼 정보가 월드인 경우
 	Transform invParent = InParentWorldTransform.Inverse();
 
 	Transform result;
@@ -112,10 +112,10 @@ FORCEINLINE constexpr Transform Transform::WorldToLocal(const Transform& InParen
 	return result;
 }
 
-// Ⱦ Լ ּ ó
+// 안쓰는 함수 주석 처리
 //FORCEINLINE constexpr Vector3 Transform::WorldToLocalVector(const Vector3& InWorldVector) const
 //{
-//	//  Ʈ   ͸  ͷ ȯ
+//	// 현재 트랜스폼을 기준으로 월드 벡터를 로컬 벡터로 변환
 //	Transform invTransform = Inverse();
 //
 //	return invTransform.GetPosition() + invTransform.GetScale() * (invTransform.GetRotation() * InWorldVector);
@@ -6,12 +6,12 @@ namespace CK
 struct Vector2
 {
 public:
-	//  
+	// 생성자 
 	FORCEINLINE constexpr Vector2() = default;
 	FORCEINLINE explicit constexpr Vector2(int InX, int InY) : X((float)InX), Y((float)InY) { }
 	FORCEINLINE explicit constexpr Vector2(float InX, float InY) : X(InX), Y(InY) { }
 
-	//  
+	// 연산자 
 	FORCEINLINE constexpr float operator[](BYTE InIndex) const;
 	FORCEINLINE constexpr float& operator[](BYTE InIndex);
 	FORCEINLINE constexpr Vector2 operator-() const;
@@ -25,11 +25,11 @@ public:
 	FORCEINLINE constexpr Vector2& operator+=(const Vector2& InVector);
 	FORCEINLINE constexpr Vector2& operator-=(const Vector2& InVector);
 
-	// Լ 
-	FORCEINLINE float Size() const;
+	// 멤버함수 
+	FORCEINLINE constexpr float Size() const;
 	FORCEINLINE constexpr float SizeSquared() const;
-	void Normalize();
-	[[nodiscard]] Vector2 GetNormalize() const;
+	FORCEINLINE constexpr void Normalize();
+	[[nodiscard]] FORCEINLINE constexpr Vector2 GetNormalize() const;
 	FORCEINLINE constexpr bool EqualsInTolerance(const Vector2& InVector, float InTolerance = SMALL_NUMBER) const;
 	FORCEINLINE constexpr float Max() const;
 	FORCEINLINE constexpr float Dot(const Vector2& InVector) const;
@@ -40,14 +40,14 @@ public:
 
 	std::string ToString() const;
 
-	//  
+	// 정적멤버변수 
 	static const Vector2 UnitX;
 	static const Vector2 UnitY;
 	static const Vector2 One;
 	static const Vector2 Zero;
 	static constexpr BYTE Dimension = 2;
 
-	// 
+	// 멤버변수
 	union
 	{
 		struct
@@ -59,9 +59,15 @@ public:
 	};
 };
 
-FORCEINLINE float Vector2::Size() const
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Vector2 Vector2::UnitX(1.f, 0.f);
+constexpr Vector2 Vector2::UnitY(0.f, 1.f);
+constexpr Vector2 Vector2::Zero(0.f, 0.f);
+constexpr Vector2 Vector2::One(1.f, 1.f);
+
+FORCEINLINE constexpr float Vector2::Size() const
 {
-	return sqrtf(SizeSquared());
+	return Math::Sqrt(SizeSquared());
 }
 
 FORCEINLINE constexpr float Vector2::SizeSquared() const
@@ -69,20 +75,47 @@ FORCEINLINE constexpr float Vector2::SizeSquared() const
 	return X * X + Y * Y;
 }
 
-FORCEINLINE void Vector2::Normalize()
+FORCEINLINE constexpr void Vector2::Normalize()
 {
 	*this = GetNormalize();
 }
 
+FORCEINLINE constexpr Vector2 Vector2::GetNormalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 1.f)
+	{
+		return *this;
+	}
+	else if (squareSum == 0.f)
+	{
+		return Vector2(0.f, 0.f);
+	}
+
+	float invLength = Math::InvSqrt(squareSum);
+	return Vector2(X * invLength, Y * invLength);
+}
+
 FORCEINLINE constexpr float Vector2::operator[](BYTE InIndex) const
 {
 	assert(InIndex < Dimension);
+	// 컴파일 타임에는 공용체에서 초기화되지 않은 멤버를 읽을 수 없으므로 성분 이름으로 접근
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		return (InIndex == 0) ? X : Y;
+	}
+
 	return Scalars[InIndex];
 }
 
 FORCEINLINE constexpr float &Vector2::operator[](BYTE InIndex)
 {
 	assert(InIndex < Dimension);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		return (InIndex == 0) ? X : Y;
+	}
+
 	return Scalars[InIndex];
 }
 
@@ -177,7 +210,7 @@ FORCEINLINE Vector2 Vector2::ToPolarCoordinate() const
 
 FORCEINLINE constexpr Vector2 Vector2::ToCartesianCoordinate() const
 {
-	// ǥ迡 X , Y (rad) Ȱ
+	// 극좌표계에서 X는 반지름, Y는 각(rad)으로 활용
 	float sin = 0.f, cos = 0.f;
 	Math::GetSinCosRad(sin, cos, Y);
 	return Vector2(X * cos, X * sin);
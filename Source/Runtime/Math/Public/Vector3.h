@@ -6,12 +6,12 @@ namespace CK
 struct Vector3
 {
 public:
-	//  
+	// 생성자 
 	FORCEINLINE constexpr Vector3() = default;
 	FORCEINLINE explicit constexpr Vector3(const Vector2& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y) { Z = IsPoint ? 1.f : 0.f; }
 	FORCEINLINE explicit constexpr Vector3(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) { }
 
-	//  
+	// 연산자 
 	FORCEINLINE constexpr float operator[](BYTE InIndex) const;
 	FORCEINLINE constexpr float& operator[](BYTE InIndex);
 	FORCEINLINE constexpr Vector3 operator-() const;
@@ -25,12 +25,12 @@ public:
 	FORCEINLINE constexpr Vector3& operator+=(const Vector3& InVector);
 	FORCEINLINE constexpr Vector3& operator-=(const Vector3& InVector);
 
-	// Լ 
+	// 멤버함수 
 	FORCEINLINE constexpr Vector2 ToVector2() const;
-	FORCEINLINE float Size() const;
+	FORCEINLINE constexpr float Size() const;
 	FORCEINLINE constexpr float SizeSquared() const;
-	void Normalize();
-	[[nodiscard]] Vector3 GetNormalize() const;
+	FORCEINLINE constexpr void Normalize();
+	[[nodiscard]] FORCEINLINE constexpr Vector3 GetNormalize() const;
 	FORCEINLINE constexpr bool EqualsInTolerance(const Vector3& InVector, float InTolerance = SMALL_NUMBER) const;
 	FORCEINLINE constexpr float Max() const;
 	FORCEINLINE constexpr float Dot(const Vector3& InVector) const;
@@ -39,7 +39,7 @@ public:
 	std::string ToString() const;
 
 
-	//  
+	// 정적멤버변수 
 	static const Vector3 UnitX;
 	static const Vector3 UnitY;
 	static const Vector3 UnitZ;
@@ -47,7 +47,7 @@ public:
 	static const Vector3 Zero;
 	static constexpr BYTE Dimension = 3;
 
-	// 
+	// 멤버변수
 	union
 	{
 		struct
@@ -59,14 +59,21 @@ public:
 	};
 };
 
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Vector3 Vector3::UnitX(1.f, 0.f, 0.f);
+constexpr Vector3 Vector3::UnitY(0.f, 1.f, 0.f);
+constexpr Vector3 Vector3::UnitZ(0.f, 0.f, 1.f);
+constexpr Vector3 Vector3::Zero(0.f, 0.f, 0.f);
+constexpr Vector3 Vector3::One(1.f, 1.f, 1.f);
+
 FORCEINLINE constexpr Vector2 Vector3::ToVector2() const
 {
 	return Vector2(X, Y);
 }
 
-FORCEINLINE float Vector3::Size() const
+FORCEINLINE constexpr float Vector3::Size() const
 {
-	return sqrtf(SizeSquared());
+	return Math::Sqrt(SizeSquared());
 }
 
 FORCEINLINE constexpr float Vector3::SizeSquared() const
@@ -74,20 +81,47 @@ FORCEINLINE constexpr float Vector3::SizeSquared() const
 	return X * X + Y * Y + Z * Z;
 }
 
-FORCEINLINE void Vector3::Normalize()
+FORCEINLINE constexpr void Vector3::Normalize()
 {
 	*this = GetNormalize();
 }
 
+FORCEINLINE constexpr Vector3 Vector3::GetNormalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 1.f)
+	{
+		return *this;
+	}
+	else if (squareSum == 0.f)
+	{
+		return Vector3(0.f, 0.f, 0.f);
+	}
+
+	float invLength = Math::InvSqrt(squareSum);
+	return Vector3(X * invLength, Y * invLength, Z * invLength);
+}
+
 FORCEINLINE constexpr float Vector3::operator[](BYTE InIndex) const
 {
 	assert(InIndex < Dimension);
+	// 컴파일 타임에는 공용체에서 초기화되지 않은 멤버를 읽을 수 없으므로 성분 이름으로 접근
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		return (InIndex == 0) ? X : ((InIndex == 1) ? Y : Z);
+	}
+
 	return Scalars[InIndex];
 }
 
 FORCEINLINE constexpr float &Vector3::operator[](BYTE InIndex)
 {
 	assert(InIndex < Dimension);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		return (InIndex == 0) ? X : ((InIndex == 1) ? Y : Z);
+	}
+
 	return Scalars[InIndex];
 }
 
@@ -6,14 +6,14 @@ namespace CK
 struct Vector4
 {
 public:
-	//  
+	// 생성자 
 	FORCEINLINE constexpr Vector4() = default;
 	FORCEINLINE explicit constexpr Vector4(const Vector2& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(0.f) { W = IsPoint ? 1.f : 0.f; }
 	FORCEINLINE explicit constexpr Vector4(const Vector3& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(InV.Z) { W = IsPoint ? 1.f : 0.f; }
 	FORCEINLINE explicit constexpr Vector4(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) { }
 	FORCEINLINE explicit constexpr Vector4(float InX, float InY, float InZ, bool IsPoint = true) : X(InX), Y(InY), Z(InZ) { W = IsPoint ? 1.f : 0.f; }
 
-	//  
+	// 연산자 
 	FORCEINLINE constexpr float operator[](BYTE InIndex) const;
 	FORCEINLINE constexpr float& operator[](BYTE InIndex);
 	FORCEINLINE constexpr Vector4 operator-() const;
@@ -27,20 +27,20 @@ public:
 	FORCEINLINE constexpr Vector4& operator+=(const Vector4& InVector);
 	FORCEINLINE constexpr Vector4& operator-=(const Vector4& InVector);
 
-	// Լ 
+	// 멤버함수 
 	FORCEINLINE constexpr Vector2 ToVector2() const;
 	FORCEINLINE constexpr Vector3 ToVector3() const;
-	FORCEINLINE float Size() const;
+	FORCEINLINE constexpr float Size() const;
 	FORCEINLINE constexpr float SizeSquared() const;
-	void Normalize();
-	[[nodiscard]] Vector4 GetNormalize() const;
+	FORCEINLINE constexpr void Normalize();
+	[[nodiscard]] FORCEINLINE constexpr Vector4 GetNormalize() const;
 	FORCEINLINE constexpr bool EqualsInTolerance(const Vector4& InVector, float InTolerance = SMALL_NUMBER) const;
 	FORCEINLINE constexpr float Max() const;
 	FORCEINLINE constexpr float Dot(const Vector4& InVector) const;
 
 	std::string ToString() const;
 
-	//  
+	// 정적멤버변수 
 	static const Vector4 UnitX;
 	static const Vector4 UnitY;
 	static const Vector4 UnitZ;
@@ -49,7 +49,7 @@ public:
 	static const Vector4 Zero;
 	static constexpr BYTE Dimension = 4;
 
-	// 
+	// 멤버변수
 	union
 	{
 		struct
@@ -61,6 +61,14 @@ public:
 	};
 };
 
+// 정적 상수는 컴파일 타임에도 사용할 수 있도록 헤더에서 정의
+constexpr Vector4 Vector4::UnitX(1.f, 0.f, 0.f, 0.f);
+constexpr Vector4 Vector4::UnitY(0.f, 1.f, 0.f, 0.f);
+constexpr Vector4 Vector4::UnitZ(0.f, 0.f, 1.f, 0.f);
+constexpr Vector4 Vector4::UnitW(0.f, 0.f, 0.f, 1.f);
+constexpr Vector4 Vector4::Zero(0.f, 0.f, 0.f, 0.f);
+constexpr Vector4 Vector4::One(1.f, 1.f, 1.f, 1.f);
+
 FORCEINLINE constexpr Vector2 Vector4::ToVector2() const
 {
 	return Vector2(X, Y);
@@ -71,9 +79,9 @@ FORCEINLINE constexpr Vector3 Vector4::ToVector3() const
 	return Vector3(X, Y, Z);
 }
 
-FORCEINLINE float Vector4::Size() const
+FORCEINLINE constexpr float Vector4::Size() const
 {
-	return sqrtf(SizeSquared());
+	return Math::Sqrt(SizeSquared());
 }
 
 FORCEINLINE constexpr float Vector4::SizeSquared() const
@@ -81,20 +89,47 @@ FORCEINLINE constexpr float Vector4::SizeSquared() const
 	return X * X + Y * Y + Z * Z + W * W;
 }
 
-FORCEINLINE void Vector4::Normalize()
+FORCEINLINE constexpr void Vector4::Normalize()
 {
 	*this = GetNormalize();
 }
 
+FORCEINLINE constexpr Vector4 Vector4::GetNormalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 1.f)
+	{
+		return *this;
+	}
+	else if (squareSum == 0.f)
+	{
+		return Vector4(0.f, 0.f, 0.f, 0.f);
+	}
+
+	float invLength = Math::InvSqrt(squareSum);
+	return Vector4(X * invLength, Y * invLength, Z * invLength, W * invLength);
+}
+
 FORCEINLINE constexpr float Vector4::operator[](BYTE InIndex) const
 {
 	assert(InIndex < Dimension);
+	// 컴파일 타임에는 공용체에서 초기화되지 않은 멤버를 읽을 수 없으므로 성분 이름으로 접근
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		return (InIndex == 0) ? X : ((InIndex == 1) ? Y : ((InIndex == 2) ? Z : W));
+	}
+
 	return Scalars[InIndex];
 }
 
 FORCEINLINE constexpr float& Vector4::operator[](BYTE InIndex)
 {
 	assert(InIndex < Dimension);
+	if (CK_IS_CONSTANT_EVALUATED())
+	{
+		return (InIndex == 0) ? X : ((InIndex == 1) ? Y : ((InIndex == 2) ? Z : W));
+	}
+
 	return Scalars[InIndex];
 }
 
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace CK
+{
+
+struct Affine3x4;
+
+// 성분별로 나눈 배열(SoA)에 행렬을 일괄 적용하는 함수 모음. 입력과 출력 배열은 같아도 된다.
+struct VectorBatch
+{
+	// 4차원 벡터 배열에 4x4 행렬 적용
+	static void Transform(const Matrix4x4& InMatrix,
+		const float* InX, const float* InY, const float* InZ, const float* InW,
+		float* OutX, float* OutY, float* OutZ, float* OutW, size_t InCount);
+
+	// 3차원 벡터 배열에 3x3 행렬 적용
+	static void Transform(const Matrix3x3& InMatrix,
+		const float* InX, const float* InY, const float* InZ,
+		float* OutX, float* OutY, float* OutZ, size_t InCount);
+
+	// 3차원 점 배열에 아핀 행렬 적용. W를 1로 간주한다.
+	static void TransformPoints(const Affine3x4& InAffine,
+		const float* InX, const float* InY, const float* InZ,
+		float* OutX, float* OutY, float* OutZ, size_t InCount);
+
+	// 2차원 점 배열에 3x3 행렬 적용. Z를 1로 간주하고 X, Y만 기록한다.
+	static void TransformPoints(const Matrix3x3& InMatrix,
+		const float* InX, const float* InY,
+		float* OutX, float* OutY, size_t InCount);
+};
+
+}
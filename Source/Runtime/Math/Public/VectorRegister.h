@@ -0,0 +1,428 @@
+#pragma once
+
+// 플랫폼별 SIMD 명령어 선택
+#if defined(_M_ARM64) || defined(_M_ARM) || defined(__ARM_NEON)
+#define CK_SIMD_NEON 1
+#include <arm_neon.h>
+#elif defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define CK_SIMD_SSE 1
+#endif
+
+namespace CK
+{
+
+// 4개의 float를 담는 SIMD 레지스터. 언리얼 엔진의 VectorRegister 함수 구성을 참고함.
+#if defined(CK_SIMD_SSE)
+typedef __m128 VectorRegister;
+#elif defined(CK_SIMD_NEON)
+typedef float32x4_t VectorRegister;
+#else
+struct alignas(16) VectorRegister
+{
+	float V[4];
+};
+#endif
+
+// 16바이트 정렬되지 않은 메모리에서 4개의 값을 읽기
+FORCEINLINE VectorRegister VectorLoad(const float* InPtr)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_loadu_ps(InPtr);
+#elif defined(CK_SIMD_NEON)
+	return vld1q_f32(InPtr);
+#else
+	return VectorRegister{ { InPtr[0], InPtr[1], InPtr[2], InPtr[3] } };
+#endif
+}
+
+// 16바이트 정렬된 메모리에서 4개의 값을 읽기
+FORCEINLINE VectorRegister VectorLoadAligned(const float* InPtr)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_load_ps(InPtr);
+#else
+	return VectorLoad(InPtr);
+#endif
+}
+
+// 3개의 값을 읽고 W는 0으로 채움. 배열 끝을 넘어 읽지 않는다.
+// double 포인터로 읽으면 float로 기록한 직후의 값을 컴파일러가 무시할 수 있으므로 앨리어싱이 허용되는 정수 로드를 사용한다.
+FORCEINLINE VectorRegister VectorLoadFloat3(const float* InPtr)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(InPtr))), _mm_load_ss(InPtr + 2));
+#elif defined(CK_SIMD_NEON)
+	return vcombine_f32(vld1_f32(InPtr), vset_lane_f32(InPtr[2], vdup_n_f32(0.f), 0));
+#else
+	return VectorRegister{ { InPtr[0], InPtr[1], InPtr[2], 0.f } };
+#endif
+}
+
+FORCEINLINE void VectorStore(const VectorRegister& InVector, float* OutPtr)
+{
+#if defined(CK_SIMD_SSE)
+	_mm_storeu_ps(OutPtr, InVector);
+#elif defined(CK_SIMD_NEON)
+	vst1q_f32(OutPtr, InVector);
+#else
+	OutPtr[0] = InVector.V[0]; OutPtr[1] = InVector.V[1]; OutPtr[2] = InVector.V[2]; OutPtr[3] = InVector.V[3];
+#endif
+}
+
+FORCEINLINE void VectorStoreAligned(const VectorRegister& InVector, float* OutPtr)
+{
+#if defined(CK_SIMD_SSE)
+	_mm_store_ps(OutPtr, InVector);
+#else
+	VectorStore(InVector, OutPtr);
+#endif
+}
+
+// X, Y, Z 3개의 값만 기록
+FORCEINLINE void VectorStoreFloat3(const VectorRegister& InVector, float* OutPtr)
+{
+#if defined(CK_SIMD_SSE)
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(OutPtr), _mm_castps_si128(InVector));
+	_mm_store_ss(OutPtr + 2, _mm_movehl_ps(InVector, InVector));
+#elif defined(CK_SIMD_NEON)
+	vst1_f32(OutPtr, vget_low_f32(InVector));
+	vst1q_lane_f32(OutPtr + 2, InVector, 2);
+#else
+	OutPtr[0] = InVector.V[0]; OutPtr[1] = InVector.V[1]; OutPtr[2] = InVector.V[2];
+#endif
+}
+
+FORCEINLINE VectorRegister VectorSet(float InX, float InY, float InZ, float InW)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_setr_ps(InX, InY, InZ, InW);
+#elif defined(CK_SIMD_NEON)
+	const float values[4] = { InX, InY, InZ, InW };
+	return vld1q_f32(values);
+#else
+	return VectorRegister{ { InX, InY, InZ, InW } };
+#endif
+}
+
+// 모든 성분을 같은 값으로 채우기
+FORCEINLINE VectorRegister VectorSetFloat1(float InValue)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_set1_ps(InValue);
+#elif defined(CK_SIMD_NEON)
+	return vdupq_n_f32(InValue);
+#else
+	return VectorRegister{ { InValue, InValue, InValue, InValue } };
+#endif
+}
+
+FORCEINLINE VectorRegister VectorZero()
+{
+	return VectorSetFloat1(0.f);
+}
+
+// 지정한 성분의 값을 모든 성분으로 복제
+template<int InIndex>
+FORCEINLINE VectorRegister VectorReplicate(const VectorRegister& InVector)
+{
+	static_assert(InIndex >= 0 && InIndex < 4, "Invalid VectorRegister index");
+#if defined(CK_SIMD_SSE)
+	return _mm_shuffle_ps(InVector, InVector, _MM_SHUFFLE(InIndex, InIndex, InIndex, InIndex));
+#elif defined(CK_SIMD_NEON)
+	return vdupq_n_f32(vgetq_lane_f32(InVector, InIndex));
+#else
+	return VectorSetFloat1(InVector.V[InIndex]);
+#endif
+}
+
+FORCEINLINE VectorRegister VectorAdd(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_add_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vaddq_f32(InA, InB);
+#else
+	return VectorRegister{ { InA.V[0] + InB.V[0], InA.V[1] + InB.V[1], InA.V[2] + InB.V[2], InA.V[3] + InB.V[3] } };
+#endif
+}
+
+FORCEINLINE VectorRegister VectorSubtract(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_sub_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vsubq_f32(InA, InB);
+#else
+	return VectorRegister{ { InA.V[0] - InB.V[0], InA.V[1] - InB.V[1], InA.V[2] - InB.V[2], InA.V[3] - InB.V[3] } };
+#endif
+}
+
+FORCEINLINE VectorRegister VectorMultiply(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_mul_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vmulq_f32(InA, InB);
+#else
+	return VectorRegister{ { InA.V[0] * InB.V[0], InA.V[1] * InB.V[1], InA.V[2] * InB.V[2], InA.V[3] * InB.V[3] } };
+#endif
+}
+
+// InA * InB + InC
+FORCEINLINE VectorRegister VectorMultiplyAdd(const VectorRegister& InA, const VectorRegister& InB, const VectorRegister& InC)
+{
+#if defined(CK_SIMD_NEON)
+	return vmlaq_f32(InC, InA, InB);
+#else
+	return VectorAdd(VectorMultiply(InA, InB), InC);
+#endif
+}
+
+FORCEINLINE VectorRegister VectorDivide(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_div_ps(InA, InB);
+#elif defined(CK_SIMD_NEON) && (defined(_M_ARM64) || defined(__aarch64__))
+	return vdivq_f32(InA, InB);
+#else
+	return VectorRegister{ { InA.V[0] / InB.V[0], InA.V[1] / InB.V[1], InA.V[2] / InB.V[2], InA.V[3] / InB.V[3] } };
+#endif
+}
+
+FORCEINLINE VectorRegister VectorMin(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_min_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vminq_f32(InA, InB);
+#else
+	return VectorRegister{ { InA.V[0] < InB.V[0] ? InA.V[0] : InB.V[0], InA.V[1] < InB.V[1] ? InA.V[1] : InB.V[1], InA.V[2] < InB.V[2] ? InA.V[2] : InB.V[2], InA.V[3] < InB.V[3] ? InA.V[3] : InB.V[3] } };
+#endif
+}
+
+FORCEINLINE VectorRegister VectorMax(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_max_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vmaxq_f32(InA, InB);
+#else
+	return VectorRegister{ { InA.V[0] > InB.V[0] ? InA.V[0] : InB.V[0], InA.V[1] > InB.V[1] ? InA.V[1] : InB.V[1], InA.V[2] > InB.V[2] ? InA.V[2] : InB.V[2], InA.V[3] > InB.V[3] ? InA.V[3] : InB.V[3] } };
+#endif
+}
+
+FORCEINLINE VectorRegister VectorAbs(const VectorRegister& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_andnot_ps(_mm_set1_ps(-0.f), InVector);
+#elif defined(CK_SIMD_NEON)
+	return vabsq_f32(InVector);
+#else
+	return VectorRegister{ { fabsf(InVector.V[0]), fabsf(InVector.V[1]), fabsf(InVector.V[2]), fabsf(InVector.V[3]) } };
+#endif
+}
+
+// 가장 가까운 정수로 반올림. 절대값이 2^31보다 작은 값에만 사용한다.
+FORCEINLINE VectorRegister VectorRound(const VectorRegister& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_cvtepi32_ps(_mm_cvtps_epi32(InVector));
+#elif defined(CK_SIMD_NEON) && (defined(_M_ARM64) || defined(__aarch64__))
+	return vrndnq_f32(InVector);
+#elif defined(CK_SIMD_NEON)
+	const float32x4_t half = vbslq_f32(vdupq_n_u32(0x80000000u), InVector, vdupq_n_f32(0.5f));
+	return vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(InVector, half)));
+#else
+	return VectorRegister{ { nearbyintf(InVector.V[0]), nearbyintf(InVector.V[1]), nearbyintf(InVector.V[2]), nearbyintf(InVector.V[3]) } };
+#endif
+}
+
+// 정수 값을 가진 성분 N에 대해 2^N을 지수 비트로 직접 만들기. N은 [-126, 127] 범위여야 한다.
+FORCEINLINE VectorRegister VectorPow2Int(const VectorRegister& InExponent)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(InExponent), _mm_set1_epi32(127)), 23));
+#elif defined(CK_SIMD_NEON)
+	return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(InExponent), vdupq_n_s32(127)), 23));
+#else
+	VectorRegister result;
+	for (int i = 0; i < 4; ++i)
+	{
+		UINT32 bits = static_cast<UINT32>(static_cast<int>(InExponent.V[i]) + 127) << 23;
+		std::memcpy(&result.V[i], &bits, sizeof(float));
+	}
+	return result;
+#endif
+}
+
+FORCEINLINE VectorRegister VectorSqrt(const VectorRegister& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_sqrt_ps(InVector);
+#elif defined(CK_SIMD_NEON) && (defined(_M_ARM64) || defined(__aarch64__))
+	return vsqrtq_f32(InVector);
+#elif defined(CK_SIMD_NEON)
+	float values[4];
+	vst1q_f32(values, InVector);
+	return VectorSet(sqrtf(values[0]), sqrtf(values[1]), sqrtf(values[2]), sqrtf(values[3]));
+#else
+	return VectorRegister{ { sqrtf(InVector.V[0]), sqrtf(InVector.V[1]), sqrtf(InVector.V[2]), sqrtf(InVector.V[3]) } };
+#endif
+}
+
+// 역제곱근의 하드웨어 근사값. 상대 오차는 약 1/4096 이므로 뉴턴-랩슨 보정과 함께 사용한다.
+FORCEINLINE VectorRegister VectorReciprocalSqrtEstimate(const VectorRegister& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_rsqrt_ps(InVector);
+#elif defined(CK_SIMD_NEON)
+	return vrsqrteq_f32(InVector);
+#else
+	return VectorRegister{ { 1.f / sqrtf(InVector.V[0]), 1.f / sqrtf(InVector.V[1]), 1.f / sqrtf(InVector.V[2]), 1.f / sqrtf(InVector.V[3]) } };
+#endif
+}
+
+// 비교 결과는 참인 성분의 모든 비트가 1로 채워진 마스크로 반환된다.
+FORCEINLINE VectorRegister VectorCompareGT(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_cmpgt_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vreinterpretq_f32_u32(vcgtq_f32(InA, InB));
+#else
+	VectorRegister result;
+	for (int i = 0; i < 4; ++i)
+	{
+		UINT32 bits = (InA.V[i] > InB.V[i]) ? 0xFFFFFFFFu : 0u;
+		std::memcpy(&result.V[i], &bits, sizeof(float));
+	}
+	return result;
+#endif
+}
+
+FORCEINLINE VectorRegister VectorCompareLT(const VectorRegister& InA, const VectorRegister& InB)
+{
+	return VectorCompareGT(InB, InA);
+}
+
+FORCEINLINE VectorRegister VectorBitwiseOr(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_or_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(InA), vreinterpretq_u32_f32(InB)));
+#else
+	VectorRegister result;
+	for (int i = 0; i < 4; ++i)
+	{
+		UINT32 a, b;
+		std::memcpy(&a, &InA.V[i], sizeof(float));
+		std::memcpy(&b, &InB.V[i], sizeof(float));
+		a |= b;
+		std::memcpy(&result.V[i], &a, sizeof(float));
+	}
+	return result;
+#endif
+}
+
+FORCEINLINE VectorRegister VectorBitwiseAnd(const VectorRegister& InA, const VectorRegister& InB)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_and_ps(InA, InB);
+#elif defined(CK_SIMD_NEON)
+	return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(InA), vreinterpretq_u32_f32(InB)));
+#else
+	VectorRegister result;
+	for (int i = 0; i < 4; ++i)
+	{
+		UINT32 a, b;
+		std::memcpy(&a, &InA.V[i], sizeof(float));
+		std::memcpy(&b, &InB.V[i], sizeof(float));
+		a &= b;
+		std::memcpy(&result.V[i], &a, sizeof(float));
+	}
+	return result;
+#endif
+}
+
+// 마스크가 참인 성분은 InTrue에서, 거짓인 성분은 InFalse에서 가져오기
+FORCEINLINE VectorRegister VectorSelect(const VectorRegister& InMask, const VectorRegister& InTrue, const VectorRegister& InFalse)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_or_ps(_mm_and_ps(InMask, InTrue), _mm_andnot_ps(InMask, InFalse));
+#elif defined(CK_SIMD_NEON)
+	return vbslq_f32(vreinterpretq_u32_f32(InMask), InTrue, InFalse);
+#else
+	VectorRegister result;
+	for (int i = 0; i < 4; ++i)
+	{
+		UINT32 mask;
+		std::memcpy(&mask, &InMask.V[i], sizeof(float));
+		result.V[i] = (mask != 0) ? InTrue.V[i] : InFalse.V[i];
+	}
+	return result;
+#endif
+}
+
+// 각 성분의 부호 비트를 모아 4비트 정수로 반환. 비교 마스크를 비트마스크로 바꿀 때 사용한다.
+FORCEINLINE int VectorMaskBits(const VectorRegister& InVector)
+{
+#if defined(CK_SIMD_SSE)
+	return _mm_movemask_ps(InVector);
+#elif defined(CK_SIMD_NEON)
+	const uint32x4_t signs = vshrq_n_u32(vreinterpretq_u32_f32(InVector), 31);
+	return static_cast<int>(vgetq_lane_u32(signs, 0) | (vgetq_lane_u32(signs, 1) << 1) | (vgetq_lane_u32(signs, 2) << 2) | (vgetq_lane_u32(signs, 3) << 3));
+#else
+	int result = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		UINT32 bits;
+		std::memcpy(&bits, &InVector.V[i], sizeof(float));
+		result |= static_cast<int>(bits >> 31) << i;
+	}
+	return result;
+#endif
+}
+
+// 네 레지스터를 4x4 행렬로 보고 전치. 구조체 배열(AoS)과 성분별 배열(SoA)을 서로 바꿀 때 사용한다.
+FORCEINLINE void VectorTranspose4x4(VectorRegister& InOutA, VectorRegister& InOutB, VectorRegister& InOutC, VectorRegister& InOutD)
+{
+#if defined(CK_SIMD_SSE)
+	_MM_TRANSPOSE4_PS(InOutA, InOutB, InOutC, InOutD);
+#elif defined(CK_SIMD_NEON)
+	const float32x4x2_t ab = vtrnq_f32(InOutA, InOutB);
+	const float32x4x2_t cd = vtrnq_f32(InOutC, InOutD);
+	InOutA = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+	InOutB = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+	InOutC = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+	InOutD = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+#else
+	VectorRegister* rows[4] = { &InOutA, &InOutB, &InOutC, &InOutD };
+	for (int r = 0; r < 4; ++r)
+	{
+		for (int c = r + 1; c < 4; ++c)
+		{
+			std::swap(rows[r]->V[c], rows[c]->V[r]);
+		}
+	}
+#endif
+}
+
+// 열 기준 4x4 행렬과 벡터의 곱. 각 열에 벡터의 성분을 복제해 곱한 후 더한다.
+FORCEINLINE VectorRegister VectorTransformVector(const VectorRegister& InVector, const VectorRegister& InCol0, const VectorRegister& InCol1, const VectorRegister& InCol2, const VectorRegister& InCol3)
+{
+	VectorRegister result = VectorMultiply(InCol0, VectorReplicate<0>(InVector));
+	result = VectorMultiplyAdd(InCol1, VectorReplicate<1>(InVector), result);
+	result = VectorMultiplyAdd(InCol2, VectorReplicate<2>(InVector), result);
+	return VectorMultiplyAdd(InCol3, VectorReplicate<3>(InVector), result);
+}
+
+// 열 기준 3x3 행렬과 벡터의 곱. W 성분은 무시된다.
+FORCEINLINE VectorRegister VectorTransformVector(const VectorRegister& InVector, const VectorRegister& InCol0, const VectorRegister& InCol1, const VectorRegister& InCol2)
+{
+	VectorRegister result = VectorMultiply(InCol0, VectorReplicate<0>(InVector));
+	result = VectorMultiplyAdd(InCol1, VectorReplicate<1>(InVector), result);
+	return VectorMultiplyAdd(InCol2, VectorReplicate<2>(InVector), result);
+}
+
+}
@@ -0,0 +1,269 @@
+#include "Precompiled.h"
+
+HeadlessRSI::~HeadlessRSI()
+{
+}
+
+bool HeadlessRSI::Init(const ScreenPoint& InScreenSize)
+{
+	Shutdown();
+
+	if (InScreenSize.HasZero())
+	{
+		return false;
+	}
+
+	_ScreenSize = InScreenSize;
+	size_t totalCount = static_cast<size_t>(_ScreenSize.X) * _ScreenSize.Y;
+	_ScreenBuffer.resize(totalCount);
+	_DepthBuffer.resize(totalCount, INFINITY);
+
+	_Initialized = true;
+	return true;
+}
+
+void HeadlessRSI::Shutdown()
+{
+	_ScreenBuffer.clear();
+	_DepthBuffer.clear();
+	_StatisticTexts.Clear();
+	_Initialized = false;
+}
+
+void HeadlessRSI::Clear(const LinearColor& InClearColor)
+{
+	std::fill(_ScreenBuffer.begin(), _ScreenBuffer.end(), InClearColor.ToColor32());
+	std::fill(_DepthBuffer.begin(), _DepthBuffer.end(), INFINITY);
+
+	// 플레이어는 BeginFrame을 호출하지 않고 매 프레임 화면을 지우므로 여기서 이전 프레임의 통계 문자열도 비운다.
+	_StatisticTexts.Clear();
+}
+
+void HeadlessRSI::BeginFrame()
+{
+	_StatisticTexts.Clear();
+}
+
+void HeadlessRSI::EndFrame()
+{
+	// 화면으로 보낼 필요가 없으므로 마지막 프레임의 결과를 그대로 유지한다.
+}
+
+void HeadlessRSI::DrawFullVerticalLine(int InX, const LinearColor& InColor)
+{
+	if (InX < 0 || InX >= _ScreenSize.X)
+	{
+		return;
+	}
+
+	for (int y = 0; y < _ScreenSize.Y; ++y)
+	{
+		SetPixel(ScreenPoint(InX, y), InColor);
+	}
+}
+
+void HeadlessRSI::DrawFullHorizontalLine(int InY, const LinearColor& InColor)
+{
+	if (InY < 0 || InY >= _ScreenSize.Y)
+	{
+		return;
+	}
+
+	for (int x = 0; x < _ScreenSize.X; ++x)
+	{
+		SetPixel(ScreenPoint(x, InY), InColor);
+	}
+}
+
+void HeadlessRSI::DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor)
+{
+	SetPixel(ScreenPoint::ToScreenCoordinate(_ScreenSize, InVectorPos), InColor);
+}
+
+void HeadlessRSI::DrawPoint(const ScreenPoint& InScreenPos, const LinearColor& InColor)
+{
+	SetPixel(InScreenPos, InColor);
+}
+
+void HeadlessRSI::DrawLine(const Vector4& InStartPos, const Vector4& InEndPos, const LinearColor& InColor)
+{
+	DrawLine(InStartPos.ToVector2(), InEndPos.ToVector2(), InColor);
+}
+
+void HeadlessRSI::DrawLine(const Vector2& InStartPos, const Vector2& InEndPos, const LinearColor& InColor)
+{
+	LineRasterizer::DrawLine(_ScreenSize, InStartPos, InEndPos, [&](const ScreenPoint& InPos) { SetPixel(InPos, InColor); });
+}
+
+float HeadlessRSI::GetDepthBufferValue(const ScreenPoint& InPos) const
+{
+	if (!IsInScreen(InPos))
+	{
+		return INFINITY;
+	}
+
+	return _DepthBuffer[GetScreenBufferIndex(InPos)];
+}
+
+void HeadlessRSI::SetDepthBufferValue(const ScreenPoint& InPos, float InDepthValue)
+{
+	if (!IsInScreen(InPos))
+	{
+		return;
+	}
+
+	_DepthBuffer[GetScreenBufferIndex(InPos)] = InDepthValue;
+}
+
+void HeadlessRSI::PushStatisticText(std::string_view InText)
+{
+	_StatisticTexts.Push(InText);
+}
+
+void HeadlessRSI::PushStatisticTexts(const std::vector<std::string>& InTexts)
+{
+	for (const std::string& text : InTexts)
+	{
+		_StatisticTexts.Push(text);
+	}
+}
+
+// 비트맵 파일 헤더. 패딩이 없도록 바이트 단위로 직접 기록한다.
+static constexpr UINT32 BitmapFileHeaderSize = 14;
+static constexpr UINT32 BitmapInfoHeaderSize = 40;
+
+static void WriteBytes(std::ofstream& InStream, UINT32 InValue, int InByteCount)
+{
+	for (int i = 0; i < InByteCount; ++i)
+	{
+		InStream.put(static_cast<char>((InValue >> (i * 8)) & 0xFF));
+	}
+}
+
+static UINT32 ReadBytes(const BYTE* InData, int InByteCount)
+{
+	UINT32 result = 0;
+	for (int i = 0; i < InByteCount; ++i)
+	{
+		result |= static_cast<UINT32>(InData[i]) << (i * 8);
+	}
+	return result;
+}
+
+bool HeadlessRSI::SaveScreenBuffer(const std::string& InFilePath) const
+{
+	if (!_Initialized)
+	{
+		return false;
+	}
+
+	std::ofstream stream(InFilePath, std::ios::binary);
+	if (!stream)
+	{
+		return false;
+	}
+
+	UINT32 imageSize = static_cast<UINT32>(_ScreenBuffer.size() * sizeof(Color32));
+	UINT32 dataOffset = BitmapFileHeaderSize + BitmapInfoHeaderSize;
+
+	// BITMAPFILEHEADER
+	stream.put('B');
+	stream.put('M');
+	WriteBytes(stream, dataOffset + imageSize, 4);
+	WriteBytes(stream, 0, 4);
+	WriteBytes(stream, dataOffset, 4);
+
+	// BITMAPINFOHEADER. 높이를 음수로 기록해 위에서부터 아래로 저장한다.
+	WriteBytes(stream, BitmapInfoHeaderSize, 4);
+	WriteBytes(stream, static_cast<UINT32>(_ScreenSize.X), 4);
+	WriteBytes(stream, static_cast<UINT32>(-_ScreenSize.Y), 4);
+	WriteBytes(stream, 1, 2);
+	WriteBytes(stream, 32, 2);
+	WriteBytes(stream, 0, 4);
+	WriteBytes(stream, imageSize, 4);
+	WriteBytes(stream, 0, 4);
+	WriteBytes(stream, 0, 4);
+	WriteBytes(stream, 0, 4);
+	WriteBytes(stream, 0, 4);
+
+	for (const Color32& c : _ScreenBuffer)
+	{
+		stream.put(static_cast<char>(c.B));
+		stream.put(static_cast<char>(c.G));
+		stream.put(static_cast<char>(c.R));
+		stream.put(static_cast<char>(c.A));
+	}
+
+	return stream.good();
+}
+
+bool HeadlessRSI::LoadImageBuffer(const std::string& InFilePath, ScreenPoint& OutSize, std::vector<Color32>& OutBuffer)
+{
+	std::ifstream stream(InFilePath, std::ios::binary);
+	if (!stream)
+	{
+		return false;
+	}
+
+	std::vector<BYTE> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	if (data.size() < BitmapFileHeaderSize + BitmapInfoHeaderSize || data[0] != 'B' || data[1] != 'M')
+	{
+		return false;
+	}
+
+	UINT32 dataOffset = ReadBytes(&data[10], 4);
+	int width = static_cast<int>(ReadBytes(&data[18], 4));
+	int height = static_cast<int>(ReadBytes(&data[22], 4));
+	UINT32 bitCount = ReadBytes(&data[28], 2);
+	if (bitCount != 32 || width <= 0 || height == 0)
+	{
+		return false;
+	}
+
+	// 높이가 양수이면 아래에서부터 위로 저장된 이미지다.
+	bool isBottomUp = (height > 0);
+	height = Math::Abs(height);
+
+	size_t totalCount = static_cast<size_t>(width) * height;
+	if (data.size() < dataOffset + totalCount * sizeof(Color32))
+	{
+		return false;
+	}
+
+	OutSize = ScreenPoint(width, height);
+	OutBuffer.resize(totalCount);
+	for (int y = 0; y < height; ++y)
+	{
+		int srcRow = isBottomUp ? (height - 1 - y) : y;
+		const BYTE* src = &data[dataOffset + static_cast<size_t>(srcRow) * width * sizeof(Color32)];
+		for (int x = 0; x < width; ++x)
+		{
+			const BYTE* p = src + x * sizeof(Color32);
+			OutBuffer[static_cast<size_t>(y) * width + x] = Color32(p[2], p[1], p[0], p[3]);
+		}
+	}
+
+	return true;
+}
+
+size_t HeadlessRSI::CountMismatchedPixels(const ScreenPoint& InReferenceSize, const std::vector<Color32>& InReference, BYTE InTolerance) const
+{
+	// 픽셀 수가 같아도 가로 세로가 바뀐 이미지는 다른 이미지이므로 크기를 축마다 비교한다.
+	if (InReferenceSize.X != _ScreenSize.X || InReferenceSize.Y != _ScreenSize.Y || InReference.size() != _ScreenBuffer.size())
+	{
+		return _ScreenBuffer.size();
+	}
+
+	size_t result = 0;
+	for (size_t i = 0; i < _ScreenBuffer.size(); ++i)
+	{
+		const Color32& c = _ScreenBuffer[i];
+		const Color32& r = InReference[i];
+		if (Math::Abs(c.R - r.R) > InTolerance || Math::Abs(c.G - r.G) > InTolerance || Math::Abs(c.B - r.B) > InTolerance)
+		{
+			++result;
+		}
+	}
+
+	return result;
+}
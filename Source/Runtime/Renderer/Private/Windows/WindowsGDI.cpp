@@ -136,7 +136,7 @@ Color32* WindowsGDI::GetScreenBuffer() const
 
 void WindowsGDI::DrawStatisticTexts()
 {
-	if (_StatisticTexts.size() == 0)
+	if (_StatisticTexts.IsEmpty())
 	{
 		return;
 	}
@@ -149,9 +149,10 @@ void WindowsGDI::DrawStatisticTexts()
 		static const int topPosition = 10;
 		static const int rowHeight = 20;
 		int currentPosition = topPosition;
-		for (std::vector<std::string>::const_iterator it = _StatisticTexts.begin(); it != _StatisticTexts.end(); ++it)
+		for (size_t ti = 0; ti < _StatisticTexts.GetCount(); ++ti)
 		{
-			TextOut(_MemoryDC, leftPosition, currentPosition, (*it).c_str(), (int)((*it).length()));
+			const std::string_view text = _StatisticTexts.GetText(ti);
+			TextOut(_MemoryDC, leftPosition, currentPosition, text.data(), (int)text.length());
 			currentPosition += rowHeight;
 		}
 
@@ -169,7 +170,7 @@ void WindowsGDI::SwapBuffer()
 	DrawStatisticTexts();
 	BitBlt(_ScreenDC, 0, 0, _ScreenSize.X, _ScreenSize.Y, _MemoryDC, 0, 0, SRCCOPY);
 
-	_StatisticTexts.clear();
+	_StatisticTexts.Clear();
 }
 
 void WindowsGDI::CreateDepthBuffer()
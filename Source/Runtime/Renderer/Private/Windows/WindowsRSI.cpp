@@ -66,113 +66,6 @@ void WindowsRSI::DrawPoint(const ScreenPoint& InScreenPos, const LinearColor& In
 	SetPixel(InScreenPos, InColor);
 }
 
-int WindowsRSI::TestRegion(const Vector2& InVectorPos, const Vector2& InMinPos, const Vector2& InMaxPos)
-{
-	int result = 0;
-	if (InVectorPos.X < InMinPos.X)
-	{
-		result = result | 0b0001;
-	}
-	else if (InVectorPos.X > InMaxPos.X)
-	{
-		result = result | 0b0010;
-	}
-
-	if (InVectorPos.Y < InMinPos.Y)
-	{
-		result = result | 0b0100;
-	}
-	else if (InVectorPos.Y > InMaxPos.Y)
-	{
-		result = result | 0b1000;
-	}
-
-	return result;
-}
-
-bool WindowsRSI::CohenSutherlandLineClip(Vector2& InOutStartPos, Vector2& InOutEndPos, const Vector2& InMinPos, const Vector2& InMaxPos)
-{
-	int startTest = TestRegion(InOutStartPos, InMinPos, InMaxPos);
-	int endTest = TestRegion(InOutEndPos, InMinPos, InMaxPos);
-
-	float width = (InOutEndPos.X - InOutStartPos.X);
-	float height = (InOutEndPos.Y - InOutStartPos.Y);
-
-	while (true)
-	{
-		if ((startTest == 0) && (endTest == 0)) // ȭ ȿ    ٷ ׸
-		{
-			return true;
-		}
-		else if (startTest & endTest) // ȭ ۿ  Ƿ ׸ ʿ䰡 
-		{
-			return false;
-		}
-		else //   Ŭ 
-		{
-			Vector2 clippedPosition;
-			bool isStartTest = (startTest != 0);
-			int currentTest = isStartTest ? startTest : endTest;
-
-			if (currentTest < 0b0100)
-			{
-				if (currentTest & 1)
-				{
-					clippedPosition.X = InMinPos.X;
-				}
-				else
-				{
-					clippedPosition.X = InMaxPos.X;
-				}
-
-				if (Math::EqualsInTolerance(height, 0.0f))
-				{
-					clippedPosition.Y = InOutStartPos.Y;
-
-				}
-				else
-				{
-					clippedPosition.Y = InOutStartPos.Y + height * (clippedPosition.X - InOutStartPos.X) / width;
-				}
-			}
-			else
-			{
-				if (currentTest & 0b0100)
-				{
-					clippedPosition.Y = InMinPos.Y;
-				}
-				else
-				{
-					clippedPosition.Y = InMaxPos.Y;
-				}
-
-				if (Math::EqualsInTolerance(width, 0.0f))
-				{
-					clippedPosition.X = InOutStartPos.X;
-				}
-				else
-				{
-					clippedPosition.X = InOutStartPos.X + width * (clippedPosition.Y - InOutStartPos.Y) / height;
-				}
-			}
-
-			// Ŭ  ٽ ׽Ʈ .
-			if (isStartTest)
-			{
-				InOutStartPos = clippedPosition;
-				startTest = TestRegion(InOutStartPos, InMinPos, InMaxPos);
-			}
-			else
-			{
-				InOutEndPos = clippedPosition;
-				endTest = TestRegion(InOutEndPos, InMinPos, InMaxPos);
-			}
-		}
-	}
-
-	return true;
-}
-
 void WindowsRSI::DrawLine(const Vector4& InStartPos, const Vector4& InEndPos, const LinearColor& InColor)
 {
 	DrawLine(InStartPos.ToVector2(), InEndPos.ToVector2(), InColor);
@@ -211,80 +104,18 @@ void WindowsRSI::SetDepthBufferValue(const ScreenPoint& InPos, float InDepthValu
 
 void WindowsRSI::DrawLine(const Vector2& InStartPos, const Vector2& InEndPos, const LinearColor& InColor)
 {
-	Vector2 clippedStart = InStartPos;
-	Vector2 clippedEnd = InEndPos;
-	Vector2 screenExtend = Vector2(_ScreenSize.X, _ScreenSize.Y) * 0.5f;
-	Vector2 minScreen = -screenExtend;
-	Vector2 maxScreen = screenExtend;
-	if (!CohenSutherlandLineClip(clippedStart, clippedEnd, minScreen, maxScreen))
-	{
-		return;
-	}
-
-	ScreenPoint startPosition = ScreenPoint::ToScreenCoordinate(_ScreenSize, clippedStart);
-	ScreenPoint endPosition = ScreenPoint::ToScreenCoordinate(_ScreenSize, clippedEnd);
-
-	int width = endPosition.X - startPosition.X;
-	int height = endPosition.Y - startPosition.Y;
-
-	bool isGradualSlope = (Math::Abs(width) >= Math::Abs(height));
-	int dx = (width >= 0) ? 1 : -1;
-	int dy = (height > 0) ? 1 : -1;
-	int fw = dx * width;
-	int fh = dy * height;
-
-	int f = isGradualSlope ? fh * 2 - fw : 2 * fw - fh;
-	int f1 = isGradualSlope ? 2 * fh : 2 * fw;
-	int f2 = isGradualSlope ? 2 * (fh - fw) : 2 * (fw - fh);
-	int x = startPosition.X;
-	int y = startPosition.Y;
-
-	if (isGradualSlope)
-	{
-		while (x != endPosition.X)
-		{
-			SetPixel(ScreenPoint(x, y), InColor);
-
-			if (f < 0)
-			{
-				f += f1;
-			}
-			else
-			{
-				f += f2;
-				y += dy;
-			}
-
-			x += dx;
-		}
-	}
-	else
-	{
-		while (y != endPosition.Y)
-		{
-			SetPixel(ScreenPoint(x, y), InColor);
-
-			if (f < 0)
-			{
-				f += f1;
-			}
-			else
-			{
-				f += f2;
-				x += dx;
-			}
-
-			y += dy;
-		}
-	}
+	LineRasterizer::DrawLine(_ScreenSize, InStartPos, InEndPos, [&](const ScreenPoint& InPos) { SetPixel(InPos, InColor); });
 }
 
-void WindowsRSI::PushStatisticText(std::string && InText)
+void WindowsRSI::PushStatisticText(std::string_view InText)
 {
-	_StatisticTexts.emplace_back(InText);
+	_StatisticTexts.Push(InText);
 }
 
-void WindowsRSI::PushStatisticTexts(std::vector<std::string> && InTexts)
+void WindowsRSI::PushStatisticTexts(const std::vector<std::string>& InTexts)
 {
-	std::move(InTexts.begin(), InTexts.end(), std::back_inserter(_StatisticTexts));
+	for (const std::string& text : InTexts)
+	{
+		_StatisticTexts.Push(text);
+	}
 }
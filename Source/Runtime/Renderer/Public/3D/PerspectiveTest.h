@@ -12,7 +12,8 @@ struct PerspectiveTest
 	std::function<Vertex3D(const Vertex3D& InStartVertex, const Vertex3D& InEndVertex)> GetEdgeVertexFunc;
 	std::array<bool, 3> TestResult;
 
-	void ClipTriangles(std::vector<Vertex3D>& InOutVertices)
+	template <class TVertexArray>
+	void ClipTriangles(TVertexArray& InOutVertices)
 	{
 		size_t triangles = InOutVertices.size() / 3;
 		for (size_t ti = 0; ti < triangles; ++ti)
@@ -51,10 +52,11 @@ struct PerspectiveTest
 	}
 
 private:
-	//  ϳ  ٱ ־ ﰢ 2 ɰ 
-	void DivideIntoTwoTriangles(std::vector<Vertex3D>& InOutVertices, size_t StartIndex, size_t NonPassCount)
+	// 점 하나가 평면의 바깥에 있어 삼각형이 2개로 쪼개지는 경우
+	template <class TVertexArray>
+	void DivideIntoTwoTriangles(TVertexArray& InOutVertices, size_t StartIndex, size_t NonPassCount)
 	{
-		//  ٱ ġ  ã
+		// 평면의 바깥에 위치한 점 찾기
 		BYTE index = 0; 
 		if (!TestResult[0])
 		{
@@ -75,10 +77,11 @@ private:
 		InOutVertices.push_back(clipped2);
 	}
 
-	//     ٱ ־ ﰢ   ϴ 
-	void ClipTriangle(std::vector<Vertex3D>& InOutVertices, size_t StartIndex, size_t NonPassCount)
+	// 점 두 개가 평면의 바깥에 있어 삼각형의 두 점이 변하는 경우
+	template <class TVertexArray>
+	void ClipTriangle(TVertexArray& InOutVertices, size_t StartIndex, size_t NonPassCount)
 	{
-		//  ʿ ġ  ã
+		// 평면의 안쪽에 위치한 점 찾기
 		BYTE index = 0;
 		if (TestResult[0])
 		{
@@ -6,17 +6,34 @@ namespace CK
 namespace DDD
 {
 
-//  ȯ ڵ
-FORCEINLINE void VertexShader3D(std::vector<Vertex3D>& InVertices, const Matrix4x4& InMatrix)
+// 정점 변환 코드. 성분별 배열에 최종 행렬을 바로 적용한다.
+FORCEINLINE void VertexShader3D(PositionArray& InOutPositions, const Matrix4x4& InMatrix)
 {
-	// ġ     ȯ
-	for (Vertex3D& v : InVertices)
+	VectorBatch::Transform(InMatrix,
+		InOutPositions.X.data(), InOutPositions.Y.data(), InOutPositions.Z.data(), InOutPositions.W.data(),
+		InOutPositions.X.data(), InOutPositions.Y.data(), InOutPositions.Z.data(), InOutPositions.W.data(), InOutPositions.Size());
+}
+
+// 같은 메시를 여러 행렬로 그리는 인스턴싱용 정점 변환 코드.
+// 인스턴스 i의 정점 v를 (i * 정점 수 + v)번 항목으로 펼쳐서 [InBegin, InEnd) 구간만 변환해 OutPositions의 같은 항목에 기록한다.
+// 원본 위치는 그리기마다 한 번만 준비하고 여러 작업이 읽기 전용으로 함께 사용한다.
+FORCEINLINE void VertexShaderInstanced3D(const PositionArray& InPositions, const Matrix4x4* InMatrices, size_t InBegin, size_t InEnd, PositionArray& OutPositions)
+{
+	const size_t vertexCount = InPositions.Size();
+	size_t current = InBegin;
+	while (current < InEnd)
 	{
-		v.Position = InMatrix * v.Position;
+		const size_t instanceIndex = current / vertexCount;
+		const size_t vertexBegin = current - instanceIndex * vertexCount;
+		const size_t count = Math::Min(vertexCount - vertexBegin, InEnd - current);
+		VectorBatch::Transform(InMatrices[instanceIndex],
+			&InPositions.X[vertexBegin], &InPositions.Y[vertexBegin], &InPositions.Z[vertexBegin], &InPositions.W[vertexBegin],
+			&OutPositions.X[current], &OutPositions.Y[current], &OutPositions.Z[current], &OutPositions.W[current], count);
+		current += count;
 	}
 }
 
-// ȼ ȯ ڵ
+// 픽셀 변환 코드
 FORCEINLINE LinearColor FragmentShader3D(LinearColor& InColor, const LinearColor& InColorParam)
 {
 	return InColor * InColorParam;
@@ -37,5 +37,40 @@ public:
 	Vector2 UV;
 };
 
+// 정점의 위치를 성분별 배열(SoA)로 저장하는 버퍼. 정점 셰이더는 이 배열에 행렬을 바로 적용한다.
+// 그리는 동안에만 사용하므로 프레임 아레나에 할당한다.
+struct PositionArray
+{
+public:
+	// 멤버함수
+	FORCEINLINE size_t Size() const { return X.size(); }
+	FORCEINLINE void Resize(size_t InCount);
+	FORCEINLINE void Set(size_t InIndex, const Vector4& InPosition);
+	FORCEINLINE Vector4 Get(size_t InIndex) const;
+
+	// 멤버변수
+	FrameVector<float> X, Y, Z, W;
+};
+
+FORCEINLINE void PositionArray::Resize(size_t InCount)
+{
+	for (auto* stream : { &X, &Y, &Z, &W })
+	{
+		stream->resize(InCount);
+	}
+}
+
+FORCEINLINE void PositionArray::Set(size_t InIndex, const Vector4& InPosition)
+{
+	assert(InIndex < Size());
+	X[InIndex] = InPosition.X; Y[InIndex] = InPosition.Y; Z[InIndex] = InPosition.Z; W[InIndex] = InPosition.W;
+}
+
+FORCEINLINE Vector4 PositionArray::Get(size_t InIndex) const
+{
+	assert(InIndex < Size());
+	return Vector4(X[InIndex], Y[InIndex], Z[InIndex], W[InIndex]);
+}
+
 }
 }
\ No newline at end of file
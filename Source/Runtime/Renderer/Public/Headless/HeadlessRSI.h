@@ -0,0 +1,98 @@
+#pragma once
+
+namespace CK
+{
+
+// 창 없이 메모리 버퍼에만 그리는 렌더러. 고정 씬을 그려 기준 이미지와 비교하는 회귀 검사에 사용한다.
+class HeadlessRSI : public RendererInterface
+{
+public:
+	HeadlessRSI() = default;
+	~HeadlessRSI();
+
+public:
+	virtual bool Init(const ScreenPoint& InScreenSize) override;
+	virtual void Shutdown() override;
+	virtual bool IsInitialized() const { return _Initialized; }
+
+	virtual void Clear(const LinearColor& InClearColor) override;
+	virtual void BeginFrame() override;
+	virtual void EndFrame() override;
+
+	virtual void DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor) override;
+	virtual void DrawPoint(const ScreenPoint& InScreenPos, const LinearColor& InColor) override;
+	virtual void DrawLine(const Vector2& InStartPos, const Vector2& InEndPos, const LinearColor& InColor) override;
+	virtual void DrawLine(const Vector4& InStartPos, const Vector4& InEndPos, const LinearColor& InColor) override;
+
+	virtual float GetDepthBufferValue(const ScreenPoint& InPos) const override;
+	virtual void SetDepthBufferValue(const ScreenPoint& InPos, float InDepthValue) override;
+
+	virtual void DrawFullVerticalLine(int InX, const LinearColor& InColor) override;
+	virtual void DrawFullHorizontalLine(int InY, const LinearColor& InColor) override;
+
+	virtual void PushStatisticText(std::string_view InText) override;
+	virtual void PushStatisticTexts(const std::vector<std::string>& InTexts) override;
+
+public:
+	// 결과 버퍼 접근
+	const ScreenPoint& GetScreenSize() const { return _ScreenSize; }
+	const std::vector<Color32>& GetScreenBuffer() const { return _ScreenBuffer; }
+	const StatisticTextBuffer& GetStatisticTexts() const { return _StatisticTexts; }
+	FORCEINLINE LinearColor GetPixel(const ScreenPoint& InPos) const;
+
+	// 기준 이미지 저장 및 비교. 이미지는 32비트 BGRA 비트맵 파일을 사용한다.
+	bool SaveScreenBuffer(const std::string& InFilePath) const;
+	static bool LoadImageBuffer(const std::string& InFilePath, ScreenPoint& OutSize, std::vector<Color32>& OutBuffer);
+	// 기준 이미지와 채널 차이가 InTolerance를 넘는 픽셀의 수. 크기가 다르면 전체 픽셀 수를 반환한다.
+	size_t CountMismatchedPixels(const ScreenPoint& InReferenceSize, const std::vector<Color32>& InReference, BYTE InTolerance) const;
+
+private:
+	FORCEINLINE bool IsInScreen(const ScreenPoint& InPos) const;
+	FORCEINLINE int GetScreenBufferIndex(const ScreenPoint& InPos) const;
+	FORCEINLINE void SetPixel(const ScreenPoint& InPos, const LinearColor& InColor);
+
+private:
+	bool _Initialized = false;
+	ScreenPoint _ScreenSize;
+
+	std::vector<Color32> _ScreenBuffer;
+	std::vector<float> _DepthBuffer;
+	StatisticTextBuffer _StatisticTexts;
+};
+
+FORCEINLINE bool HeadlessRSI::IsInScreen(const ScreenPoint& InPos) const
+{
+	if ((InPos.X < 0 || InPos.X >= _ScreenSize.X) || (InPos.Y < 0 || InPos.Y >= _ScreenSize.Y))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+FORCEINLINE int HeadlessRSI::GetScreenBufferIndex(const ScreenPoint& InPos) const
+{
+	return InPos.Y * _ScreenSize.X + InPos.X;
+}
+
+FORCEINLINE void HeadlessRSI::SetPixel(const ScreenPoint& InPos, const LinearColor& InColor)
+{
+	if (!IsInScreen(InPos))
+	{
+		return;
+	}
+
+	_ScreenBuffer[GetScreenBufferIndex(InPos)] = InColor.ToColor32();
+}
+
+FORCEINLINE LinearColor HeadlessRSI::GetPixel(const ScreenPoint& InPos) const
+{
+	if (!IsInScreen(InPos))
+	{
+		return LinearColor::Error;
+	}
+
+	return LinearColor(_ScreenBuffer[GetScreenBufferIndex(InPos)]);
+}
+
+}
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <functional>
+#include <fstream>
+#include <cstdio>
+#include <string_view>
 
 #include "2D/Vertex.h"
 #include "2D/Shader.h"
@@ -8,7 +11,10 @@
 #include "3D/Shader.h"
 #include "3D/PerspectiveTest.h"
 
+#include "StatisticTextBuffer.h"
 #include "RendererInterface.h"
+#include "LineRasterizer.h"
+#include "Headless/HeadlessRSI.h"
 
 #if defined(PLATFORM_WINDOWS)
 #include <windows.h>
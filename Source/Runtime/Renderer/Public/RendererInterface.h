@@ -26,8 +26,27 @@ public:
 	virtual void DrawFullVerticalLine(int InX, const LinearColor& InColor) = 0;
 	virtual void DrawFullHorizontalLine(int InY, const LinearColor& InColor) = 0;
 
-	virtual void PushStatisticText(std::string && InText) = 0;
-	virtual void PushStatisticTexts(std::vector<std::string> && InTexts) = 0;
+	virtual void PushStatisticText(std::string_view InText) = 0;
+	virtual void PushStatisticTexts(const std::vector<std::string>& InTexts) = 0;
+
+	// 고정 크기 스택 버퍼에 서식 문자열을 기록하고 그 내용만 렌더러에 넘긴다. 매 프레임 호출해도 문자열을 할당하지 않는다.
+	template<class... TArgs>
+	void PushStatisticTextFormat(const char* InFormat, TArgs... InArgs);
+
+	static constexpr size_t MaxStatisticTextLength = 128;
 };
 
+template<class... TArgs>
+void RendererInterface::PushStatisticTextFormat(const char* InFormat, TArgs... InArgs)
+{
+	char text[MaxStatisticTextLength];
+	const int length = std::snprintf(text, sizeof(text), InFormat, InArgs...);
+	if (length < 0)
+	{
+		return;
+	}
+
+	PushStatisticText(std::string_view(text, Math::Min(static_cast<size_t>(length), sizeof(text) - 1)));
+}
+
 }
\ No newline at end of file
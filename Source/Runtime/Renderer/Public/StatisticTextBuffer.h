@@ -0,0 +1,48 @@
+#pragma once
+
+namespace CK
+{
+
+// 한 프레임 동안 쌓이는 통계 문자열을 하나의 문자 버퍼에 이어 붙여 보관한다.
+// 비워도 용량은 유지되므로 매 프레임 문자열을 넣을 때 힙 할당이 일어나지 않는다.
+class StatisticTextBuffer
+{
+public:
+	StatisticTextBuffer() = default;
+
+public:
+	// 멤버함수
+	FORCEINLINE void Push(std::string_view InText);
+	FORCEINLINE void Clear();
+
+	FORCEINLINE size_t GetCount() const { return _Offsets.size(); }
+	FORCEINLINE bool IsEmpty() const { return _Offsets.empty(); }
+	FORCEINLINE std::string_view GetText(size_t InIndex) const;
+
+private:
+	// 멤버변수
+	std::vector<char> _Chars;
+	std::vector<size_t> _Offsets;
+};
+
+FORCEINLINE void StatisticTextBuffer::Push(std::string_view InText)
+{
+	_Offsets.push_back(_Chars.size());
+	_Chars.insert(_Chars.end(), InText.begin(), InText.end());
+}
+
+FORCEINLINE void StatisticTextBuffer::Clear()
+{
+	_Chars.clear();
+	_Offsets.clear();
+}
+
+FORCEINLINE std::string_view StatisticTextBuffer::GetText(size_t InIndex) const
+{
+	assert(InIndex < _Offsets.size());
+	const size_t start = _Offsets[InIndex];
+	const size_t end = (InIndex + 1 < _Offsets.size()) ? _Offsets[InIndex + 1] : _Chars.size();
+	return std::string_view(_Chars.data() + start, end - start);
+}
+
+}
@@ -47,7 +47,7 @@ protected:
 	float* _DepthBuffer = nullptr;
 
 	ScreenPoint _ScreenSize;
-	std::vector<std::string> _StatisticTexts;
+	StatisticTextBuffer _StatisticTexts;
 };
 
 FORCEINLINE void WindowsGDI::SetPixelOpaque(const ScreenPoint& InPos, const LinearColor& InColor)
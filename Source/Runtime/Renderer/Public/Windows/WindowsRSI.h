@@ -30,13 +30,10 @@ public:
 	virtual void DrawFullVerticalLine(int InX, const LinearColor& InColor) override;
 	virtual void DrawFullHorizontalLine(int InY, const LinearColor& InColor) override;
 
-	virtual void PushStatisticText(std::string && InText) override;
-	virtual void PushStatisticTexts(std::vector<std::string> && InTexts) override;
+	virtual void PushStatisticText(std::string_view InText) override;
+	virtual void PushStatisticTexts(const std::vector<std::string>& InTexts) override;
 
 private:
-	int TestRegion(const Vector2& InVectorPos, const Vector2& InMinPos, const Vector2& InMaxPos);
-	bool CohenSutherlandLineClip(Vector2& InOutStartPos, Vector2& InOutEndPos, const Vector2& InMinPos, const Vector2& InMaxPos);
-
 	FORCEINLINE void SetPixel(const ScreenPoint& InPos, const LinearColor& InColor);
 };
 
@@ -0,0 +1,201 @@
+#include "Precompiled.h"
+#include <cstdio>
+
+// 절차적으로 만든 메시의 LOD를 생성하고 단계마다 삼각형 수와 인덱스, LOD 선택 결과를 검사하는 프로그램.
+using namespace CK::DDD;
+
+// 검사용 격자 메시. 모든 정점을 이웃한 삼각형이 공유하므로 고정되는 정점 없이 간략화할 수 있다.
+static constexpr size_t GridQuadCount = 32;
+static constexpr float GridSpacing = 10.f;
+static constexpr float GridWaveHeight = 15.f;
+
+// 격자의 왼쪽 절반과 오른쪽 절반에 서로 다른 텍스처를 지정해 LOD의 텍스처 범위도 확인한다.
+static const std::size_t LeftTextureKey = std::hash<std::wstring>()(L"LeftTexture");
+static const std::size_t RightTextureKey = std::hash<std::wstring>()(L"RightTexture");
+
+static int FailedCount = 0;
+
+static void Check(bool InCondition, const char* InCaseName, const char* InMessage, size_t InLODIndex)
+{
+	if (!InCondition)
+	{
+		std::printf("[FAIL] %s : LOD %zu %s\n", InCaseName, InLODIndex, InMessage);
+		FailedCount++;
+	}
+}
+
+static void CreateGridMesh(Mesh& OutMesh)
+{
+	const size_t rowVertexCount = GridQuadCount + 1;
+	auto& v = OutMesh.GetVertices();
+	auto& i = OutMesh.GetIndices();
+	auto& uv = OutMesh.GetUVs();
+	auto& t = OutMesh.GetTextureIndices();
+
+	v.reserve(rowVertexCount * rowVertexCount);
+	uv.reserve(rowVertexCount * rowVertexCount);
+	for (size_t y = 0; y < rowVertexCount; ++y)
+	{
+		for (size_t x = 0; x < rowVertexCount; ++x)
+		{
+			// 평평하면 모든 합치기의 오차가 같으므로 완만한 굴곡을 준다.
+			const float height = GridWaveHeight * Math::Sin(static_cast<float>(x) * 0.3f) * Math::Cos(static_cast<float>(y) * 0.2f);
+			v.emplace_back(static_cast<float>(x) * GridSpacing, height, static_cast<float>(y) * GridSpacing);
+			uv.emplace_back(static_cast<float>(x) / GridQuadCount, static_cast<float>(y) / GridQuadCount);
+		}
+	}
+
+	// 텍스처마다 삼각형이 연속되도록 왼쪽 절반을 먼저 넣는다.
+	const size_t halfQuadCount = GridQuadCount / 2;
+	for (size_t half = 0; half < 2; ++half)
+	{
+		const size_t startIndex = i.size();
+		for (size_t y = 0; y < GridQuadCount; ++y)
+		{
+			for (size_t x = half * halfQuadCount; x < (half + 1) * halfQuadCount; ++x)
+			{
+				const size_t v0 = y * rowVertexCount + x;
+				const size_t v1 = v0 + 1;
+				const size_t v2 = v0 + rowVertexCount;
+				const size_t v3 = v2 + 1;
+				i.insert(i.end(), { v0, v2, v1, v1, v2, v3 });
+			}
+		}
+		t.emplace_back(half == 0 ? LeftTextureKey : RightTextureKey, startIndex, i.size());
+	}
+
+	OutMesh.CalculateBounds();
+}
+
+static void CheckLODs(const Mesh& InMesh, const char* InCaseName)
+{
+	const size_t vertexCount = InMesh.GetVertices().size();
+	const size_t triangleCount = InMesh.GetIndices().size() / 3;
+
+	// 격자는 고정된 정점이 없으므로 최소 삼각형 수에 닿기 전까지 단계마다 목표대로 줄어야 한다.
+	size_t expectedLODCount = 1;
+	float targetRatio = 1.f;
+	while (expectedLODCount < Mesh::DefaultLODCount)
+	{
+		targetRatio *= Mesh::LODTriangleRatio;
+		if (static_cast<size_t>(triangleCount * targetRatio) < Mesh::LODMinTriangleCount)
+		{
+			break;
+		}
+		expectedLODCount++;
+	}
+
+	if (InMesh.GetLODCount() != expectedLODCount)
+	{
+		std::printf("[FAIL] %s : %zu LODs, expected %zu\n", InCaseName, InMesh.GetLODCount(), expectedLODCount);
+		FailedCount++;
+		return;
+	}
+
+	size_t previousCount = triangleCount;
+	float previousScreenSize = Mesh::FullDetailScreenSize;
+	targetRatio = 1.f;
+	for (size_t li = 1; li < InMesh.GetLODCount(); ++li)
+	{
+		const MeshLOD& lod = InMesh.GetLOD(li);
+		const size_t lodTriangleCount = lod.Indices.size() / 3;
+		targetRatio *= Mesh::LODTriangleRatio;
+
+		// 삼각형 수
+		Check(lod.Indices.size() % 3 == 0, InCaseName, "index count is not a multiple of 3", li);
+		Check(lodTriangleCount > 0, InCaseName, "has no triangles", li);
+		Check(lodTriangleCount <= static_cast<size_t>(triangleCount * targetRatio), InCaseName, "has more triangles than its target", li);
+		Check(lodTriangleCount <= previousCount * Mesh::LODMinReduction, InCaseName, "is not smaller than the previous LOD", li);
+
+		// 인덱스는 LOD의 정점을, LOD의 정점은 원본 메시의 정점을 가리켜야 한다.
+		const bool indicesValid = std::all_of(lod.Indices.begin(), lod.Indices.end(), [&lod](size_t InIndex) { return InIndex < lod.Vertices.size(); });
+		const bool verticesValid = std::all_of(lod.Vertices.begin(), lod.Vertices.end(), [vertexCount](size_t InVertex) { return InVertex < vertexCount; });
+		Check(indicesValid, InCaseName, "has an index out of its vertex range", li);
+		Check(verticesValid, InCaseName, "refers to a vertex out of the source mesh", li);
+		Check(lod.Vertices.size() <= vertexCount, InCaseName, "has more vertices than the source mesh", li);
+
+		bool hasDegenerate = false;
+		for (size_t ii = 0; ii + 2 < lod.Indices.size(); ii += 3)
+		{
+			const size_t i0 = lod.Indices[ii], i1 = lod.Indices[ii + 1], i2 = lod.Indices[ii + 2];
+			hasDegenerate |= (i0 == i1 || i1 == i2 || i2 == i0);
+		}
+		Check(!hasDegenerate, InCaseName, "has a degenerate triangle", li);
+
+		// 텍스처 범위는 원본과 같은 순서로 인덱스 버퍼 전체를 빈틈없이 덮어야 한다.
+		const auto& sourceTextures = InMesh.GetTextureIndices();
+		bool texturesValid = (lod.TextureIndices.size() == sourceTextures.size());
+		size_t nextStart = 0;
+		for (size_t ti = 0; texturesValid && ti < lod.TextureIndices.size(); ++ti)
+		{
+			const TexturesIndice& t = lod.TextureIndices[ti];
+			texturesValid = (t.TextureKey == sourceTextures[ti].TextureKey) && (t.StartIndex == nextStart) && (t.StartIndex <= t.EndIndex) && (t.EndIndex % 3 == 0);
+			nextStart = t.EndIndex;
+		}
+		Check(texturesValid && nextStart == lod.Indices.size(), InCaseName, "has texture ranges that do not cover its indices", li);
+
+		// 화면 크기는 단계마다 작아져야 한다.
+		Check(lod.ScreenSize > 0.f && lod.ScreenSize < previousScreenSize, InCaseName, "screen size is not below the previous LOD", li);
+
+		std::printf("%s : LOD %zu has %zu triangles and %zu vertices, screen size %.3f\n", InCaseName, li, lodTriangleCount, lod.Vertices.size(), lod.ScreenSize);
+		previousCount = lodTriangleCount;
+		previousScreenSize = lod.ScreenSize;
+	}
+}
+
+static void CheckSelection(const Mesh& InMesh, float InScreenSize, size_t InExpectedLOD, const char* InCaseName)
+{
+	const size_t selectedLOD = InMesh.SelectLOD(InScreenSize);
+	if (selectedLOD != InExpectedLOD)
+	{
+		std::printf("[FAIL] %s : screen size %.4f selects LOD %zu, expected %zu\n", InCaseName, InScreenSize, selectedLOD, InExpectedLOD);
+		FailedCount++;
+	}
+}
+
+static void CheckSelectLOD(const Mesh& InMesh, const char* InCaseName)
+{
+	const size_t lastLOD = InMesh.GetLODCount() - 1;
+
+	// 화면을 크게 차지하면 원본, 보이지 않을 만큼 작으면 마지막 LOD
+	CheckSelection(InMesh, 1.f, 0, InCaseName);
+	CheckSelection(InMesh, Mesh::FullDetailScreenSize, 0, InCaseName);
+	CheckSelection(InMesh, 0.f, lastLOD, InCaseName);
+
+	// 각 LOD의 화면 크기를 경계로 그 값에서는 이전 단계를, 조금 작아지면 그 단계를 고른다.
+	for (size_t li = 1; li <= lastLOD; ++li)
+	{
+		const float screenSize = InMesh.GetLOD(li).ScreenSize;
+		CheckSelection(InMesh, screenSize, li - 1, InCaseName);
+		CheckSelection(InMesh, screenSize * 0.99f, li, InCaseName);
+	}
+}
+
+int main()
+{
+	const char* caseName = "Grid";
+
+	Mesh grid;
+	CreateGridMesh(grid);
+	grid.BuildLODs();
+
+	const int previousFailedCount = FailedCount;
+	CheckLODs(grid, caseName);
+	CheckSelectLOD(grid, caseName);
+	if (FailedCount == previousFailedCount)
+	{
+		std::printf("[PASS] %s : %zu triangles simplified into %zu LODs\n", caseName, grid.GetIndices().size() / 3, grid.GetLODCount());
+	}
+
+	// 다시 만들어도 이전 결과가 남지 않아야 한다.
+	const size_t lodCount = grid.GetLODCount();
+	grid.BuildLODs();
+	if (grid.GetLODCount() != lodCount)
+	{
+		std::printf("[FAIL] %s : rebuilding changed the LOD count from %zu to %zu\n", caseName, lodCount, grid.GetLODCount());
+		FailedCount++;
+	}
+
+	std::printf("%d failure(s)\n", FailedCount);
+	return (FailedCount == 0) ? 0 : 1;
+}
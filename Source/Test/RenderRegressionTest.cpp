@@ -0,0 +1,455 @@
+#include "Precompiled.h"
+#include "SoftRenderer.h"
+#include <chrono>
+#include <cstdio>
+
+// 고정된 씬을 HeadlessRSI로 그려 기준 이미지와 비교하는 회귀 검사 프로그램.
+// Resource 폴더에서 실행한다.
+// --update : 기준 이미지와 기준 프레임 시간을 새로 기록한다.
+// --check-frame-time : 기준 프레임 시간과의 비교도 진행한다. 측정 환경에 따라 흔들리므로 기본으로는 하지 않는다.
+
+// 검사 환경
+static const ScreenPoint TestScreenSize(400, 300);
+static constexpr int WarmupFrameCount = 10;
+static constexpr int MeasureFrameCount = 30;
+
+// 시뮬레이션은 매 프레임 같은 시간만큼 진행시켜 측정 환경과 무관하게 같은 화면이 나오도록 한다.
+static constexpr float TestCyclesPerMilliSeconds = 1000.f;
+static constexpr INT64 FixedFrameCycles = 16667;
+
+// 판정 기준
+static constexpr BYTE ChannelTolerance = 2;
+static constexpr float MaxMismatchRatio = 0.001f;
+static constexpr float FrameTimeBudgetScale = 1.5f;
+
+// 프레임 시간은 같은 실행에서 잰 기준 작업 시간에 대한 비율로 기록해 기계의 빠르기를 상쇄한다.
+static constexpr int CalibrationIterationCount = 1 << 20;
+
+// 기준 파일 경로
+static const std::string ReferenceFolder("Test/");
+static const std::string FrameTimeBaselinePath("Test/FrameTimeBaseline.txt");
+
+struct DrawModeCase
+{
+	const char* Name;
+	SystemInputButton Button;
+};
+
+static const std::array<DrawModeCase, 3> DrawModeCases = {
+	DrawModeCase{ "Normal", SystemInputButton::F1 },
+	DrawModeCase{ "Wireframe", SystemInputButton::F2 },
+	DrawModeCase{ "DepthBuffer", SystemInputButton::F3 }
+};
+
+using FrameTimeTable = std::vector<std::pair<std::string, float>>;
+
+// 검사 전체에서 공유하는 상태
+struct RegressionContext
+{
+	bool IsUpdating = false;
+	bool IsCheckingFrameTime = false;
+	float CalibrationTime = 0.f;
+	FrameTimeTable Baselines;
+	FrameTimeTable Measured;
+	int FailedCount = 0;
+};
+
+// 3D 검사 씬의 리소스 이름
+static const std::size_t TestCubeMesh = std::hash<std::wstring>()(L"SM_TestCube");
+static const std::size_t TestChainMesh = std::hash<std::wstring>()(L"SK_TestChain");
+static const Name TestCubeGo(L"TestCube");
+static const Name TestChainGo(L"TestChain");
+static const std::array<Name, 4> TestChainBones = { L"ChainRoot", L"ChainBone1", L"ChainBone2", L"ChainTip" };
+
+// 본 체인을 감싸는 원통의 모양
+static constexpr float ChainBoneLength = 40.f;
+static constexpr float ChainRadius = 12.f;
+static constexpr size_t ChainSideCount = 8;
+static constexpr size_t ChainRingPerBone = 4;
+
+static bool LoadFrameTimeBaselines(const std::string& InFilePath, FrameTimeTable& OutBaselines)
+{
+	std::ifstream stream(InFilePath);
+	if (!stream)
+	{
+		return false;
+	}
+
+	std::string name;
+	float ratio = 0.f;
+	while (stream >> name >> ratio)
+	{
+		OutBaselines.emplace_back(name, ratio);
+	}
+
+	return true;
+}
+
+static bool SaveFrameTimeBaselines(const std::string& InFilePath, const FrameTimeTable& InBaselines)
+{
+	std::ofstream stream(InFilePath);
+	if (!stream)
+	{
+		return false;
+	}
+
+	for (const auto& baseline : InBaselines)
+	{
+		stream << baseline.first << ' ' << baseline.second << '\n';
+	}
+
+	return stream.good();
+}
+
+static const float* FindFrameTime(const FrameTimeTable& InTable, const std::string& InName)
+{
+	auto it = std::find_if(InTable.begin(), InTable.end(), [&InName](const auto& InEntry) { return InEntry.first == InName; });
+	return (it == InTable.end()) ? nullptr : &it->second;
+}
+
+static float GetMedian(std::vector<float>& InValues)
+{
+	// 측정값은 튀는 값의 영향을 받지 않도록 중앙값을 사용한다.
+	std::nth_element(InValues.begin(), InValues.begin() + InValues.size() / 2, InValues.end());
+	return InValues[InValues.size() / 2];
+}
+
+// 엔진 코드와 무관한 고정 연산의 수행 시간을 밀리초로 측정한다.
+static float MeasureCalibrationTime()
+{
+	std::vector<float> times(MeasureFrameCount);
+	volatile float sink = 0.f;
+	for (float& time : times)
+	{
+		auto startTime = std::chrono::steady_clock::now();
+		float value = 1.f;
+		for (int i = 0; i < CalibrationIterationCount; ++i)
+		{
+			value = value * 0.999f + 1.f / (1.f + value);
+		}
+		sink = value;
+		auto endTime = std::chrono::steady_clock::now();
+		time = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+	}
+
+	return GetMedian(times);
+}
+
+// 한 프레임을 진행하고 걸린 시간을 밀리초로 반환
+static float TickFrame(SoftRenderer& InInstance)
+{
+	auto startTime = std::chrono::steady_clock::now();
+	InInstance.OnTick();
+	auto endTime = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::milli>(endTime - startTime).count();
+}
+
+// 버튼을 한 프레임 누른 후 떼어 그리기 모드를 바꾼다. 모드는 뗀 프레임부터 적용된다.
+static void PressSystemButton(SoftRenderer& InInstance, std::array<bool, static_cast<size_t>(SystemInputButton::LastButton)>& InOutButtonStates, SystemInputButton InButton)
+{
+	InOutButtonStates[static_cast<size_t>(InButton)] = true;
+	InInstance.OnTick();
+	InOutButtonStates[static_cast<size_t>(InButton)] = false;
+	InInstance.OnTick();
+}
+
+// 저장소의 정육면체 정보에 면마다 UV를 붙여 텍스처를 입힌 메시를 만든다.
+static void CreateTestCubeMesh(DDD::GameEngine& InGameEngine)
+{
+	static const std::array<Vector2, 4> faceUVs = { Vector2(0.f, 1.f), Vector2(0.f, 0.f), Vector2(1.f, 0.f), Vector2(1.f, 1.f) };
+
+	DDD::Mesh& cube = InGameEngine.CreateMesh(TestCubeMesh);
+	cube.GetVertices().assign(DDD::cubeMeshPositions.begin(), DDD::cubeMeshPositions.end());
+	cube.GetIndices().assign(DDD::cubeMeshIndice.begin(), DDD::cubeMeshIndice.end());
+	for (size_t vi = 0; vi < DDD::cubeMeshPositions.size(); ++vi)
+	{
+		cube.GetUVs().push_back(faceUVs[vi % faceUVs.size()]);
+	}
+	cube.GetTextureIndices().emplace_back(DDD::GameEngine::BaseTexture, 0, cube.GetIndices().size());
+	cube.CalculateBounds();
+}
+
+// 본 체인을 감싸는 원통 메시를 만든다. 정점은 높이에 따라 인접한 두 본에 나눠 붙인다.
+static void CreateTestChainMesh(DDD::GameEngine& InGameEngine)
+{
+	DDD::Mesh& chain = InGameEngine.CreateMesh(TestChainMesh);
+	chain.SetMeshType(MeshType::Skinned);
+
+	// 본은 모델링 공간의 위치를 바인드포즈로 사용하고 바로 앞의 본을 부모로 연결한다.
+	chain.AddBone(TestChainBones[0], Transform(Vector3::Zero));
+	for (size_t bi = 1; bi < TestChainBones.size(); ++bi)
+	{
+		Vector3 bonePosition(0.f, ChainBoneLength * bi, 0.f);
+		chain.AddBone(TestChainBones[bi], Transform(bonePosition), TestChainBones[bi - 1]);
+	}
+
+	const size_t ringCount = (TestChainBones.size() - 1) * ChainRingPerBone + 1;
+	for (size_t ri = 0; ri < ringCount; ++ri)
+	{
+		float ringRatio = static_cast<float>(ri) / ChainRingPerBone;
+		size_t lowerBone = Math::Min(static_cast<size_t>(ringRatio), TestChainBones.size() - 2);
+		float upperWeight = ringRatio - lowerBone;
+
+		for (size_t si = 0; si <= ChainSideCount; ++si)
+		{
+			float sin = 0.f, cos = 0.f;
+			Math::GetSinCos(sin, cos, 360.f * si / ChainSideCount);
+			chain.GetVertices().emplace_back(cos * ChainRadius, ChainBoneLength * ringRatio, sin * ChainRadius);
+			chain.GetUVs().emplace_back(static_cast<float>(si) / ChainSideCount, 1.f - static_cast<float>(ri) / (ringCount - 1));
+			chain.GetWeights().push_back(DDD::Weight{ { TestChainBones[lowerBone], TestChainBones[lowerBone + 1] }, { 1.f - upperWeight, upperWeight } });
+			chain.GetConnectedBones().push_back(2);
+		}
+	}
+
+	const size_t ringVertexCount = ChainSideCount + 1;
+	for (size_t ri = 0; ri + 1 < ringCount; ++ri)
+	{
+		for (size_t si = 0; si < ChainSideCount; ++si)
+		{
+			size_t v0 = ri * ringVertexCount + si;
+			size_t v1 = v0 + 1;
+			size_t v2 = v0 + ringVertexCount;
+			size_t v3 = v2 + 1;
+			std::array<size_t, 6> quad = { v0, v2, v1, v1, v2, v3 };
+			chain.GetIndices().insert(chain.GetIndices().end(), quad.begin(), quad.end());
+		}
+	}
+
+	chain.GetTextureIndices().emplace_back(DDD::GameEngine::BaseTexture, 0, chain.GetIndices().size());
+	chain.CalculateBounds();
+
+	// 검사 화면에서는 원본을 쓸 만큼 크게 보이지 않으므로 줄인 LOD로 그려진다.
+	chain.BuildLODs();
+}
+
+// 3D 검사 씬. 저장소에 포함되지 않은 캐릭터 모델 대신 절차적으로 만든 메시만 사용한다.
+static void LoadTestScene3D(DDD::GameEngine& InGameEngine)
+{
+	CreateTestCubeMesh(InGameEngine);
+	CreateTestChainMesh(InGameEngine);
+
+	// 텍스처를 입힌 물체
+	DDD::GameObject& goCube = InGameEngine.CreateNewGameObject(TestCubeGo);
+	goCube.SetMesh(TestCubeMesh);
+	goCube.GetTransform().SetWorldPosition(Vector3(-140.f, 40.f, 0.f));
+	goCube.GetTransform().SetWorldScale(Vector3::One * 40.f);
+
+	DDD::GameObject& goChain = InGameEngine.CreateNewGameObject(TestChainGo);
+	goChain.SetMesh(TestChainMesh);
+	goChain.GetTransform().SetWorldPosition(Vector3(120.f, 0.f, 0.f));
+
+	// 선으로 그려지는 기본 메시. 선은 깊이 테스트를 하지 않으므로 그리는 순서에 결과가 달라지지 않도록 칠해진 물체와 겹치지 않게 둔다.
+	// 마지막 화살표는 카메라 뒤에 두어 절두체 컬링을 거친다.
+	DDD::GameObject& goPlane = InGameEngine.CreateNewGameObject(L"TestPlane");
+	goPlane.SetMesh(DDD::GameEngine::PlaneMesh);
+	goPlane.GetTransform().SetWorldPosition(Vector3(0.f, 0.f, -150.f));
+	goPlane.GetTransform().SetWorldScale(Vector3::One * 15.f);
+
+	static const std::array<Vector3, 4> arrowPositions = { Vector3(-40.f, 20.f, 80.f), Vector3(0.f, 140.f, -60.f), Vector3(200.f, 60.f, 60.f), Vector3(0.f, 100.f, 900.f) };
+	static const std::array<LinearColor, 4> arrowColors = { LinearColor::Red, LinearColor::Green, LinearColor::Blue, LinearColor::Red };
+	for (size_t ai = 0; ai < arrowPositions.size(); ++ai)
+	{
+		DDD::GameObject& goArrow = InGameEngine.CreateNewGameObject(L"TestArrow" + std::to_wstring(ai));
+		goArrow.SetMesh(DDD::GameEngine::ArrowMesh);
+		goArrow.SetColor(arrowColors[ai]);
+		goArrow.GetTransform().SetWorldPosition(arrowPositions[ai]);
+		goArrow.GetTransform().SetWorldRotation(Rotator(45.f * ai, 0.f, 30.f));
+		goArrow.GetTransform().SetWorldScale(Vector3::One * 20.f);
+	}
+
+	DDD::CameraObject& mainCamera = InGameEngine.GetMainCamera();
+	mainCamera.GetTransform().SetWorldPosition(Vector3(0.f, 200.f, 400.f));
+	mainCamera.SetLookAtRotation(Vector3(0.f, 50.f, 0.f));
+}
+
+// 고정된 시간 간격으로 진행하므로 매 실행마다 같은 자세가 나온다.
+static void UpdateTestScene3D(DDD::GameEngine& InGameEngine, float InDeltaSeconds)
+{
+	static float cubeRotateSpeed = 30.f;
+	static float chainSwingDegree = 35.f;
+
+	InGameEngine.GetGameObject(TestCubeGo).GetTransform().AddWorldYawRotation(cubeRotateSpeed * InDeltaSeconds);
+
+	DDD::GameObject& goChain = InGameEngine.GetGameObject(TestChainGo);
+	DDD::Mesh& chain = InGameEngine.GetMesh(goChain.GetMeshKey());
+	static float elapsedTime = 0.f;
+	elapsedTime += InDeltaSeconds;
+	DDD::TransformHierarchy& skeleton = chain.GetSkeleton();
+	skeleton.SetLocalRotation(chain.GetBone(TestChainBones[1]).GetNodeIndex(), Rotator(0.f, sinf(elapsedTime * 2.f) * chainSwingDegree, 0.f));
+	skeleton.SetLocalRotation(chain.GetBone(TestChainBones[2]).GetNodeIndex(), Rotator(0.f, sinf(elapsedTime * 2.f + 1.f) * chainSwingDegree, 0.f));
+	skeleton.UpdateWorld();
+}
+
+static void CheckImage(RegressionContext& InOutContext, const HeadlessRSI& InRSI, const std::string& InCaseName)
+{
+	const std::string referencePath = ReferenceFolder + InCaseName + ".bmp";
+	if (InOutContext.IsUpdating)
+	{
+		if (!InRSI.SaveScreenBuffer(referencePath))
+		{
+			std::printf("[FAIL] %s : cannot write %s\n", InCaseName.c_str(), referencePath.c_str());
+			++InOutContext.FailedCount;
+		}
+		return;
+	}
+
+	ScreenPoint referenceSize;
+	std::vector<Color32> referenceBuffer;
+	if (!HeadlessRSI::LoadImageBuffer(referencePath, referenceSize, referenceBuffer))
+	{
+		std::printf("[FAIL] %s : cannot read reference image %s. Run from the Resource folder or record it with --update.\n", InCaseName.c_str(), referencePath.c_str());
+		++InOutContext.FailedCount;
+		return;
+	}
+
+	const size_t totalCount = InRSI.GetScreenBuffer().size();
+	const size_t mismatchedCount = InRSI.CountMismatchedPixels(referenceSize, referenceBuffer, ChannelTolerance);
+	const size_t allowedCount = static_cast<size_t>(totalCount * MaxMismatchRatio);
+	if (mismatchedCount > allowedCount)
+	{
+		// 비교할 수 있도록 실제 결과를 기준 이미지 옆에 남긴다.
+		const std::string actualPath = ReferenceFolder + InCaseName + "_Actual.bmp";
+		InRSI.SaveScreenBuffer(actualPath);
+		std::printf("[FAIL] %s : %zu of %zu pixels differ (allowed %zu), result saved to %s\n", InCaseName.c_str(), mismatchedCount, totalCount, allowedCount, actualPath.c_str());
+		++InOutContext.FailedCount;
+		return;
+	}
+
+	std::printf("[PASS] %s : %zu of %zu pixels differ\n", InCaseName.c_str(), mismatchedCount, totalCount);
+}
+
+static void CheckFrameTime(RegressionContext& InOutContext, const std::string& InCaseName, std::vector<float>& InFrameTimes)
+{
+	const float medianTime = GetMedian(InFrameTimes);
+	const float ratio = medianTime / InOutContext.CalibrationTime;
+	InOutContext.Measured.emplace_back(InCaseName, ratio);
+
+	if (InOutContext.IsUpdating)
+	{
+		std::printf("[UPDATE] %s : %.3f ms (%.3f of calibration)\n", InCaseName.c_str(), medianTime, ratio);
+		return;
+	}
+
+	const float* baselineRatio = FindFrameTime(InOutContext.Baselines, InCaseName);
+	if (baselineRatio == nullptr)
+	{
+		std::printf("[FAIL] %s : no frame time baseline in %s\n", InCaseName.c_str(), FrameTimeBaselinePath.c_str());
+		++InOutContext.FailedCount;
+		return;
+	}
+
+	const float budgetRatio = *baselineRatio * FrameTimeBudgetScale;
+	if (ratio > budgetRatio)
+	{
+		std::printf("[FAIL] %s : frame time %.3f ms is %.3f of calibration, exceeds budget %.3f (baseline %.3f)\n", InCaseName.c_str(), medianTime, ratio, budgetRatio, *baselineRatio);
+		++InOutContext.FailedCount;
+		return;
+	}
+
+	std::printf("[PASS] %s : frame time %.3f ms is %.3f of calibration (budget %.3f)\n", InCaseName.c_str(), medianTime, ratio, budgetRatio);
+}
+
+static void RunScene(RegressionContext& InOutContext, GameEngineType InGameEngineType, const std::string& InSceneName)
+{
+	// SoftRenderer가 렌더러를 소유하므로 결과 확인용 포인터만 따로 보관한다.
+	HeadlessRSI* rsi = new HeadlessRSI();
+	SoftRenderer instance(InGameEngineType, rsi);
+
+	INT64 timeStamp = 0;
+	instance._PerformanceInitFunc = []() { return TestCyclesPerMilliSeconds; };
+	instance._PerformanceMeasureFunc = [&timeStamp]() { timeStamp += FixedFrameCycles; return timeStamp; };
+	instance._InputBindingFunc = [](InputManager& InInputManager) {
+		for (UINT32 ai = 0; ai < static_cast<UINT32>(InputAxis::LastAxis); ++ai)
+		{
+			InInputManager.SetInputAxis(static_cast<InputAxis>(ai), []() { return 0.f; });
+		}
+		for (UINT32 bi = 0; bi < static_cast<UINT32>(InputButton::LastButton); ++bi)
+		{
+			InInputManager.SetInputButton(static_cast<InputButton>(bi), []() { return false; });
+		}
+	};
+	instance._LoadScene3DFunc = LoadTestScene3D;
+	instance._Update3DFunc = UpdateTestScene3D;
+
+	std::array<bool, static_cast<size_t>(SystemInputButton::LastButton)> buttonStates = { 0 };
+	for (size_t bi = 0; bi < buttonStates.size(); ++bi)
+	{
+		instance.GetSystemInput().SetSystemInputButton(static_cast<SystemInputButton>(bi), [&buttonStates, bi]() { return buttonStates[bi]; });
+	}
+
+	// 첫 틱은 초기화와 씬 로딩만 진행한다.
+	instance.OnResize(TestScreenSize);
+	instance.OnTick();
+
+	for (int fi = 0; fi < WarmupFrameCount; ++fi)
+	{
+		instance.OnTick();
+	}
+
+	const bool isTiming = InOutContext.IsUpdating || InOutContext.IsCheckingFrameTime;
+	std::vector<float> frameTimes(MeasureFrameCount);
+	for (const DrawModeCase& modeCase : DrawModeCases)
+	{
+		const std::string caseName = InSceneName + "_" + modeCase.Name;
+		PressSystemButton(instance, buttonStates, modeCase.Button);
+
+		for (float& frameTime : frameTimes)
+		{
+			frameTime = TickFrame(instance);
+		}
+
+		CheckImage(InOutContext, *rsi, caseName);
+		if (isTiming)
+		{
+			CheckFrameTime(InOutContext, caseName, frameTimes);
+		}
+	}
+
+	instance.OnShutdown();
+}
+
+int main(int argc, char* argv[])
+{
+	RegressionContext context;
+	for (int ai = 1; ai < argc; ++ai)
+	{
+		const std::string argument(argv[ai]);
+		if (argument == "--update")
+		{
+			context.IsUpdating = true;
+		}
+		else if (argument == "--check-frame-time")
+		{
+			context.IsCheckingFrameTime = true;
+		}
+		else
+		{
+			std::printf("unknown argument %s\n", argument.c_str());
+			return 1;
+		}
+	}
+
+	if (context.IsCheckingFrameTime && !context.IsUpdating && !LoadFrameTimeBaselines(FrameTimeBaselinePath, context.Baselines))
+	{
+		std::printf("[FAIL] cannot read %s. Run from the Resource folder or record it with --update.\n", FrameTimeBaselinePath.c_str());
+		return 1;
+	}
+
+	if (context.IsUpdating || context.IsCheckingFrameTime)
+	{
+		context.CalibrationTime = MeasureCalibrationTime();
+		std::printf("calibration : %.3f ms\n", context.CalibrationTime);
+	}
+
+	RunScene(context, GameEngineType::DD, "2D");
+	RunScene(context, GameEngineType::DDD, "3D");
+
+	if (context.IsUpdating && !SaveFrameTimeBaselines(FrameTimeBaselinePath, context.Measured))
+	{
+		std::printf("[FAIL] cannot write %s\n", FrameTimeBaselinePath.c_str());
+		++context.FailedCount;
+	}
+
+	std::printf("%d failure(s)\n", context.FailedCount);
+	return (context.FailedCount == 0) ? 0 : 1;
+}